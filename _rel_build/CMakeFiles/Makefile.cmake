@@ -0,0 +1,218 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/modules/CheckHeaders.cmake"
+  "/root/repo/cmake/modules/CreateVersionFile.cmake"
+  "/root/repo/cmake/modules/FindQuickBook.cmake"
+  "/root/repo/cmake/modules/FindXSLTPROC.cmake"
+  "/root/repo/cmake/modules/ForwardingHeader.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/api/CMakeLists.txt"
+  "/root/repo/examples/artificial_ant/CMakeLists.txt"
+  "/root/repo/examples/artificial_ant/detail/CMakeLists.txt"
+  "/root/repo/examples/dynamical_system/CMakeLists.txt"
+  "/root/repo/examples/simplification/CMakeLists.txt"
+  "/root/repo/examples/symbolic_regression/CMakeLists.txt"
+  "/root/repo/include/gpcxx/forwarding_header.hpp.cmake"
+  "/root/repo/performance/CMakeLists.txt"
+  "/root/repo/performance/allocation/CMakeLists.txt"
+  "/root/repo/performance/any_genetic_operator/CMakeLists.txt"
+  "/root/repo/performance/benchmarks/CMakeLists.txt"
+  "/root/repo/performance/checkpoint/CMakeLists.txt"
+  "/root/repo/performance/crossover/CMakeLists.txt"
+  "/root/repo/performance/eval_basic/CMakeLists.txt"
+  "/root/repo/performance/eval_service/CMakeLists.txt"
+  "/root/repo/performance/generate/CMakeLists.txt"
+  "/root/repo/performance/iterator/CMakeLists.txt"
+  "/root/repo/performance/mutation/CMakeLists.txt"
+  "/root/repo/performance/pagie2/CMakeLists.txt"
+  "/root/repo/performance/pipelining/CMakeLists.txt"
+  "/root/repo/performance/rng/CMakeLists.txt"
+  "/root/repo/performance/selection/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/app/CMakeLists.txt"
+  "/root/repo/test/canonic/CMakeLists.txt"
+  "/root/repo/test/eval/CMakeLists.txt"
+  "/root/repo/test/evolve/CMakeLists.txt"
+  "/root/repo/test/generate/CMakeLists.txt"
+  "/root/repo/test/io/CMakeLists.txt"
+  "/root/repo/test/operator/CMakeLists.txt"
+  "/root/repo/test/stat/CMakeLists.txt"
+  "/root/repo/test/tree/CMakeLists.txt"
+  "/root/repo/test/util/CMakeLists.txt"
+  "/root/repo/third_party/install/lib/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/root/repo/third_party/install/lib/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/root/repo/third_party/install/lib/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_atomic-1.74.0/boost_atomic-config-version.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_atomic-1.74.0/boost_atomic-config.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_atomic-1.74.0/libboost_atomic-variant-shared.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_atomic-1.74.0/libboost_atomic-variant-static.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_program_options-1.74.0/boost_program_options-config-version.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_program_options-1.74.0/boost_program_options-config.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_program_options-1.74.0/libboost_program_options-variant-shared.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_program_options-1.74.0/libboost_program_options-variant-static.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_thread-1.74.0/boost_thread-config-version.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_thread-1.74.0/boost_thread-config.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_thread-1.74.0/libboost_thread-variant-shared.cmake"
+  "/root/repo/third_party/install/lib/cmake/boost_thread-1.74.0/libboost_thread-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "generated_includes/root/repo/_rel_build/generated_includes/include/gpcxx/app.hpp"
+  "generated_includes/include/gpcxx/benchmark_problems.hpp"
+  "generated_includes/include/gpcxx/primitive_sets.hpp"
+  "generated_includes/include/gpcxx/eval.hpp"
+  "generated_includes/include/gpcxx/evolve.hpp"
+  "generated_includes/include/gpcxx/generate.hpp"
+  "generated_includes/include/gpcxx/io.hpp"
+  "generated_includes/include/gpcxx/operator.hpp"
+  "generated_includes/include/gpcxx/stat.hpp"
+  "generated_includes/include/gpcxx/tree.hpp"
+  "generated_includes/include/gpcxx/intrusive_nodes.hpp"
+  "generated_includes/include/gpcxx/util.hpp"
+  "generated_includes/include/gpcxx/gpcxx.hpp"
+  "generated_includes/include/gpcxx/canonic.hpp"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/symbolic_regression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/artificial_ant/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/artificial_ant/detail/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/simplification/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dynamical_system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/eval_basic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/pagie2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/iterator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/rng/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/eval_service/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/allocation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/any_genetic_operator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/selection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/checkpoint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/pipelining/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/crossover/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/mutation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/generate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "performance/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/app/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/operator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/tree/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/generate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/eval/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/stat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/canonic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/evolve/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/gtest.dir/DependInfo.cmake"
+  "CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "CMakeFiles/gmock.dir/DependInfo.cmake"
+  "examples/symbolic_regression/CMakeFiles/symb_reg.dir/DependInfo.cmake"
+  "examples/symbolic_regression/CMakeFiles/symb_reg_erc.dir/DependInfo.cmake"
+  "examples/symbolic_regression/CMakeFiles/symb_reg_basic_tree.dir/DependInfo.cmake"
+  "examples/symbolic_regression/CMakeFiles/symb_reg_simplify.dir/DependInfo.cmake"
+  "examples/artificial_ant/CMakeFiles/artificial_ant.dir/DependInfo.cmake"
+  "examples/artificial_ant/detail/CMakeFiles/artificial_ant_tests.dir/DependInfo.cmake"
+  "examples/artificial_ant/detail/CMakeFiles/artificial_ant_plots.dir/DependInfo.cmake"
+  "examples/simplification/CMakeFiles/simplification.dir/DependInfo.cmake"
+  "examples/api/CMakeFiles/tree_io.dir/DependInfo.cmake"
+  "examples/api/CMakeFiles/tree_methods.dir/DependInfo.cmake"
+  "examples/api/CMakeFiles/tree_traversal.dir/DependInfo.cmake"
+  "examples/api/CMakeFiles/tree_algebra.dir/DependInfo.cmake"
+  "examples/api/CMakeFiles/fitness.dir/DependInfo.cmake"
+  "examples/dynamical_system/CMakeFiles/lorenz.dir/DependInfo.cmake"
+  "examples/dynamical_system/CMakeFiles/dynsys_lorenz.dir/DependInfo.cmake"
+  "examples/dynamical_system/CMakeFiles/lorenz_multi.dir/DependInfo.cmake"
+  "examples/dynamical_system/CMakeFiles/lorenz_single.dir/DependInfo.cmake"
+  "examples/dynamical_system/CMakeFiles/lorenz_reconstruct.dir/DependInfo.cmake"
+  "performance/eval_basic/CMakeFiles/performance_eval_basic.dir/DependInfo.cmake"
+  "performance/eval_basic/CMakeFiles/performance_eval_basic_virtual.dir/DependInfo.cmake"
+  "performance/eval_basic/CMakeFiles/performance_eval_basic_intrusive.dir/DependInfo.cmake"
+  "performance/pagie2/CMakeFiles/performance_pagie2.dir/DependInfo.cmake"
+  "performance/pagie2/CMakeFiles/performance_pagie2_intrusive.dir/DependInfo.cmake"
+  "performance/iterator/CMakeFiles/preorder_iterator.dir/DependInfo.cmake"
+  "performance/rng/CMakeFiles/performance_tournament_rng.dir/DependInfo.cmake"
+  "performance/eval_service/CMakeFiles/performance_evaluation_service.dir/DependInfo.cmake"
+  "performance/allocation/CMakeFiles/performance_allocation_count.dir/DependInfo.cmake"
+  "performance/any_genetic_operator/CMakeFiles/performance_any_genetic_operator.dir/DependInfo.cmake"
+  "performance/selection/CMakeFiles/performance_tournament_selection.dir/DependInfo.cmake"
+  "performance/selection/CMakeFiles/performance_lexicase_selection.dir/DependInfo.cmake"
+  "performance/checkpoint/CMakeFiles/performance_checkpoint.dir/DependInfo.cmake"
+  "performance/pipelining/CMakeFiles/performance_pipelined_symbolic_regression.dir/DependInfo.cmake"
+  "performance/crossover/CMakeFiles/performance_splice_crossover.dir/DependInfo.cmake"
+  "performance/crossover/CMakeFiles/performance_crossover_bloat.dir/DependInfo.cmake"
+  "performance/mutation/CMakeFiles/performance_point_mutation.dir/DependInfo.cmake"
+  "performance/mutation/CMakeFiles/performance_node_generation.dir/DependInfo.cmake"
+  "performance/mutation/CMakeFiles/performance_mutation_bloat.dir/DependInfo.cmake"
+  "performance/generate/CMakeFiles/performance_ptc2.dir/DependInfo.cmake"
+  "performance/benchmarks/CMakeFiles/symbolic_regression.dir/DependInfo.cmake"
+  "test/app/CMakeFiles/app_tests.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/io_tests.dir/DependInfo.cmake"
+  "test/operator/CMakeFiles/operator_tests.dir/DependInfo.cmake"
+  "test/tree/CMakeFiles/tree_tests.dir/DependInfo.cmake"
+  "test/util/CMakeFiles/util_tests.dir/DependInfo.cmake"
+  "test/generate/CMakeFiles/generate_tests.dir/DependInfo.cmake"
+  "test/eval/CMakeFiles/eval_tests.dir/DependInfo.cmake"
+  "test/stat/CMakeFiles/stat_tests.dir/DependInfo.cmake"
+  "test/canonic/CMakeFiles/canonic_tests.dir/DependInfo.cmake"
+  "test/evolve/CMakeFiles/evolve_tests.dir/DependInfo.cmake"
+  )
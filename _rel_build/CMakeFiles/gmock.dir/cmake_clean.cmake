@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmock.dir/third_party/googletest/googlemock/src/gmock-all.cc.o"
+  "CMakeFiles/gmock.dir/third_party/googletest/googlemock/src/gmock-all.cc.o.d"
+  "libgmock.a"
+  "libgmock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
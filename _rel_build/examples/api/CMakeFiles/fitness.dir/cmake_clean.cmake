@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fitness.dir/fitness.cpp.o"
+  "CMakeFiles/fitness.dir/fitness.cpp.o.d"
+  "fitness"
+  "fitness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fitness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_algebra.dir/tree_algebra.cpp.o"
+  "CMakeFiles/tree_algebra.dir/tree_algebra.cpp.o.d"
+  "tree_algebra"
+  "tree_algebra.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_algebra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
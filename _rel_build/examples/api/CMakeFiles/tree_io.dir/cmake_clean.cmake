@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_io.dir/tree_io.cpp.o"
+  "CMakeFiles/tree_io.dir/tree_io.cpp.o.d"
+  "tree_io"
+  "tree_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
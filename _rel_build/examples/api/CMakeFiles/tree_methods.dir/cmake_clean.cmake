@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_methods.dir/tree_methods.cpp.o"
+  "CMakeFiles/tree_methods.dir/tree_methods.cpp.o.d"
+  "tree_methods"
+  "tree_methods.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_methods.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
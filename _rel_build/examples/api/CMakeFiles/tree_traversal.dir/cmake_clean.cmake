@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_traversal.dir/tree_traversal.cpp.o"
+  "CMakeFiles/tree_traversal.dir/tree_traversal.cpp.o.d"
+  "tree_traversal"
+  "tree_traversal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_traversal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/artificial_ant.dir/artificial_ant.cpp.o"
+  "CMakeFiles/artificial_ant.dir/artificial_ant.cpp.o.d"
+  "artificial_ant"
+  "artificial_ant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/artificial_ant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
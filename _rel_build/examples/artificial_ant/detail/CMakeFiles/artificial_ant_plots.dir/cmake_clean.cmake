@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/artificial_ant_plots.dir/artificial_ant_plots.cpp.o"
+  "CMakeFiles/artificial_ant_plots.dir/artificial_ant_plots.cpp.o.d"
+  "artificial_ant_plots"
+  "artificial_ant_plots.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/artificial_ant_plots.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/artificial_ant_tests.dir/artificial_ant_tests.cpp.o"
+  "CMakeFiles/artificial_ant_tests.dir/artificial_ant_tests.cpp.o.d"
+  "artificial_ant_tests"
+  "artificial_ant_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/artificial_ant_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
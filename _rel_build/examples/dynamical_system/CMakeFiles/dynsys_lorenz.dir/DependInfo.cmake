@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/dynamical_system/generate_data.cpp" "examples/dynamical_system/CMakeFiles/dynsys_lorenz.dir/generate_data.cpp.o" "gcc" "examples/dynamical_system/CMakeFiles/dynsys_lorenz.dir/generate_data.cpp.o.d"
+  "/root/repo/examples/dynamical_system/serialize.cpp" "examples/dynamical_system/CMakeFiles/dynsys_lorenz.dir/serialize.cpp.o" "gcc" "examples/dynamical_system/CMakeFiles/dynsys_lorenz.dir/serialize.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dynsys_lorenz.dir/generate_data.cpp.o"
+  "CMakeFiles/dynsys_lorenz.dir/generate_data.cpp.o.d"
+  "CMakeFiles/dynsys_lorenz.dir/serialize.cpp.o"
+  "CMakeFiles/dynsys_lorenz.dir/serialize.cpp.o.d"
+  "libdynsys_lorenz.a"
+  "libdynsys_lorenz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynsys_lorenz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libdynsys_lorenz.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lorenz.dir/lorenz.cpp.o"
+  "CMakeFiles/lorenz.dir/lorenz.cpp.o.d"
+  "lorenz"
+  "lorenz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lorenz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
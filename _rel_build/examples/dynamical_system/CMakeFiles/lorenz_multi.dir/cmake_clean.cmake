@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lorenz_multi.dir/lorenz_multi.cpp.o"
+  "CMakeFiles/lorenz_multi.dir/lorenz_multi.cpp.o.d"
+  "lorenz_multi"
+  "lorenz_multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lorenz_multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lorenz_reconstruct.dir/lorenz_reconstruct.cpp.o"
+  "CMakeFiles/lorenz_reconstruct.dir/lorenz_reconstruct.cpp.o.d"
+  "lorenz_reconstruct"
+  "lorenz_reconstruct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lorenz_reconstruct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lorenz_single.dir/lorenz_single.cpp.o"
+  "CMakeFiles/lorenz_single.dir/lorenz_single.cpp.o.d"
+  "lorenz_single"
+  "lorenz_single.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lorenz_single.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simplification.dir/simplification.cpp.o"
+  "CMakeFiles/simplification.dir/simplification.cpp.o.d"
+  "simplification"
+  "simplification.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simplification.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symb_reg.dir/symb_reg.cpp.o"
+  "CMakeFiles/symb_reg.dir/symb_reg.cpp.o.d"
+  "symb_reg"
+  "symb_reg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symb_reg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symb_reg_basic_tree.dir/symb_reg_basic_tree.cpp.o"
+  "CMakeFiles/symb_reg_basic_tree.dir/symb_reg_basic_tree.cpp.o.d"
+  "symb_reg_basic_tree"
+  "symb_reg_basic_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symb_reg_basic_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
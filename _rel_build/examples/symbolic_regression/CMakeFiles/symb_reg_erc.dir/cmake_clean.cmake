@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symb_reg_erc.dir/symb_reg_erc.cpp.o"
+  "CMakeFiles/symb_reg_erc.dir/symb_reg_erc.cpp.o.d"
+  "symb_reg_erc"
+  "symb_reg_erc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symb_reg_erc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symb_reg_simplify.dir/symb_reg_simplify.cpp.o"
+  "CMakeFiles/symb_reg_simplify.dir/symb_reg_simplify.cpp.o.d"
+  "symb_reg_simplify"
+  "symb_reg_simplify.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symb_reg_simplify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
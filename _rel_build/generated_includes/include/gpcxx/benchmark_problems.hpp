@@ -0,0 +1,24 @@
+/*
+ * gpcxx/benchmark_problems.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_BENCHMARK_PROBLEMS_HPP_DEFINED
+#define GPCXX_BENCHMARK_PROBLEMS_HPP_DEFINED
+
+
+#include <gpcxx/app/benchmark_problems/keijzer.hpp>
+#include <gpcxx/app/benchmark_problems/korns.hpp>
+#include <gpcxx/app/benchmark_problems/koza.hpp>
+#include <gpcxx/app/benchmark_problems/nguyen.hpp>
+#include <gpcxx/app/benchmark_problems/pagie.hpp>
+#include <gpcxx/app/benchmark_problems/vladislavleva.hpp>
+
+
+#endif // GPCXX_BENCHMARK_PROBLEMS_HPP_DEFINED
@@ -0,0 +1,27 @@
+/*
+ * gpcxx/canonic.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_CANONIC_HPP_DEFINED
+#define GPCXX_CANONIC_HPP_DEFINED
+
+
+#include <gpcxx/canonic/algebraic_node.hpp>
+#include <gpcxx/canonic/algebras.hpp>
+#include <gpcxx/canonic/algebras_rule.hpp>
+#include <gpcxx/canonic/group.hpp>
+#include <gpcxx/canonic/left_lift.hpp>
+#include <gpcxx/canonic/remove_double_inverse_functions.hpp>
+#include <gpcxx/canonic/remove_inverse_operations.hpp>
+#include <gpcxx/canonic/sort_commutative.hpp>
+#include <gpcxx/canonic/summarize_constants.hpp>
+
+
+#endif // GPCXX_CANONIC_HPP_DEFINED
@@ -0,0 +1,22 @@
+/*
+  gpcxx/config_version.hpp
+
+  Copyright 2013 Karsten Ahnert
+
+  Distributed under the Boost Software License, Version 1.0.
+  (See accompanying file LICENSE_1_0.txt or
+  copy at http://www.boost.org/LICENSE_1_0.txt)
+
+  This is a template file filled with values by cmake and git, then placed in /root/repo/_rel_build/GeneratedIncludes e.g. ../../build/GeneratedIncludes
+*/
+
+
+#ifndef GPCXX_CONFIG_VERSION_HPP_DEFINED
+#define GPCXX_CONFIG_VERSION_HPP_DEFINED
+
+#define GPCXX_VERSION_MAJOR 0
+#define GPCXX_VERSION_MINOR 1
+#define GPCXX_VERSION_PATCH 1
+#define GPCXX_VERSION_SHA1 25.g6cf2
+
+#endif // GPCXX_CONFIG_VERSION_HPP_DEFINED
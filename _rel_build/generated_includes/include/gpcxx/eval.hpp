@@ -0,0 +1,28 @@
+/*
+ * gpcxx/eval.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVAL_HPP_DEFINED
+#define GPCXX_EVAL_HPP_DEFINED
+
+
+#include <gpcxx/eval/adjusted_fitness.hpp>
+#include <gpcxx/eval/error_matrix.hpp>
+#include <gpcxx/eval/evaluation_service.hpp>
+#include <gpcxx/eval/fitness_cache.hpp>
+#include <gpcxx/eval/hits.hpp>
+#include <gpcxx/eval/multi_regression_fitness.hpp>
+#include <gpcxx/eval/normalized_fitness.hpp>
+#include <gpcxx/eval/regression_fitness.hpp>
+#include <gpcxx/eval/static_eval.hpp>
+#include <gpcxx/eval/static_eval_erc.hpp>
+
+
+#endif // GPCXX_EVAL_HPP_DEFINED
@@ -0,0 +1,27 @@
+/*
+ * gpcxx/evolve.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_HPP_DEFINED
+#define GPCXX_EVOLVE_HPP_DEFINED
+
+
+#include <gpcxx/evolve/async_steady_state.hpp>
+#include <gpcxx/evolve/double_buffered_population.hpp>
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/evolve/island_model.hpp>
+#include <gpcxx/evolve/lineage_table.hpp>
+#include <gpcxx/evolve/pipelined_evolution.hpp>
+#include <gpcxx/evolve/process_island.hpp>
+#include <gpcxx/evolve/static_pipeline.hpp>
+#include <gpcxx/evolve/steady_state_pipeline.hpp>
+
+
+#endif // GPCXX_EVOLVE_HPP_DEFINED
@@ -0,0 +1,26 @@
+/*
+ * gpcxx/generate.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_GENERATE_HPP_DEFINED
+#define GPCXX_GENERATE_HPP_DEFINED
+
+
+#include <gpcxx/generate/basic_generate_strategy.hpp>
+#include <gpcxx/generate/generate_population.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ptc2.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/generate/static_node_generator.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/uniform_symbol_erc.hpp>
+
+
+#endif // GPCXX_GENERATE_HPP_DEFINED
@@ -0,0 +1,33 @@
+/*
+ * gpcxx/gpcxx.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_GPCXX_HPP_DEFINED
+#define GPCXX_GPCXX_HPP_DEFINED
+
+
+#include <gpcxx/app.hpp>
+#include <gpcxx/benchmark_problems.hpp>
+#include <gpcxx/canonic.hpp>
+#include <gpcxx/config_version.hpp>
+#include <gpcxx/eval.hpp>
+#include <gpcxx/evolve.hpp>
+#include <gpcxx/generate.hpp>
+#include <gpcxx/gpcxx.hpp>
+#include <gpcxx/intrusive_nodes.hpp>
+#include <gpcxx/io.hpp>
+#include <gpcxx/operator.hpp>
+#include <gpcxx/primitive_sets.hpp>
+#include <gpcxx/stat.hpp>
+#include <gpcxx/tree.hpp>
+#include <gpcxx/util.hpp>
+
+
+#endif // GPCXX_GPCXX_HPP_DEFINED
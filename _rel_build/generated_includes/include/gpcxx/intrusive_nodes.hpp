@@ -0,0 +1,24 @@
+/*
+ * gpcxx/intrusive_nodes.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_INTRUSIVE_NODES_HPP_DEFINED
+#define GPCXX_INTRUSIVE_NODES_HPP_DEFINED
+
+
+#include <gpcxx/tree/intrusive_nodes/intrusive_func_node.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_named_func_node.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_nary_func_node.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_nary_named_func_node.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_nary_node.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_node.hpp>
+
+
+#endif // GPCXX_INTRUSIVE_NODES_HPP_DEFINED
@@ -0,0 +1,29 @@
+/*
+ * gpcxx/io.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_IO_HPP_DEFINED
+#define GPCXX_IO_HPP_DEFINED
+
+
+#include <gpcxx/io/best_individuals.hpp>
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/io/bracket.hpp>
+#include <gpcxx/io/c_style.hpp>
+#include <gpcxx/io/checkpoint.hpp>
+#include <gpcxx/io/graphviz.hpp>
+#include <gpcxx/io/json.hpp>
+#include <gpcxx/io/latex.hpp>
+#include <gpcxx/io/polish.hpp>
+#include <gpcxx/io/population_json.hpp>
+#include <gpcxx/io/simple.hpp>
+
+
+#endif // GPCXX_IO_HPP_DEFINED
@@ -0,0 +1,40 @@
+/*
+ * gpcxx/operator.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_HPP_DEFINED
+#define GPCXX_OPERATOR_HPP_DEFINED
+
+
+#include <gpcxx/operator/any_genetic_operator.hpp>
+#include <gpcxx/operator/batch_tournament_selector.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/geometric_semantic_crossover_strategy.hpp>
+#include <gpcxx/operator/geometric_semantic_mutation_strategy.hpp>
+#include <gpcxx/operator/height_constrained_crossover_strategy.hpp>
+#include <gpcxx/operator/hoist_mutation.hpp>
+#include <gpcxx/operator/homologous_crossover_strategy.hpp>
+#include <gpcxx/operator/lexicase_selector.hpp>
+#include <gpcxx/operator/multi_crossover.hpp>
+#include <gpcxx/operator/multi_mutation.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/one_point_crossover_pip_strategy.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/point_mutation.hpp>
+#include <gpcxx/operator/random_selector.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/shrink_mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/size_fair_crossover_strategy.hpp>
+#include <gpcxx/operator/splice_crossover.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+
+#endif // GPCXX_OPERATOR_HPP_DEFINED
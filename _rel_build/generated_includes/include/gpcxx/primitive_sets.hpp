@@ -0,0 +1,20 @@
+/*
+ * gpcxx/primitive_sets.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_PRIMITIVE_SETS_HPP_DEFINED
+#define GPCXX_PRIMITIVE_SETS_HPP_DEFINED
+
+
+#include <gpcxx/app/primitive_sets/koza_algebraic.hpp>
+#include <gpcxx/app/primitive_sets/koza_intrusive.hpp>
+
+
+#endif // GPCXX_PRIMITIVE_SETS_HPP_DEFINED
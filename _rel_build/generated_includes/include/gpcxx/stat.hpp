@@ -0,0 +1,20 @@
+/*
+ * gpcxx/stat.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_STAT_HPP_DEFINED
+#define GPCXX_STAT_HPP_DEFINED
+
+
+#include <gpcxx/stat/node_statistics.hpp>
+#include <gpcxx/stat/population_statistics.hpp>
+
+
+#endif // GPCXX_STAT_HPP_DEFINED
@@ -0,0 +1,32 @@
+/*
+ * gpcxx/tree.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_TREE_HPP_DEFINED
+#define GPCXX_TREE_HPP_DEFINED
+
+
+#include <gpcxx/tree/basic_nary_tree.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/tree/cursor_equal.hpp>
+#include <gpcxx/tree/cursor_traits.hpp>
+#include <gpcxx/tree/hash_tree.hpp>
+#include <gpcxx/tree/intrusive_erc_generator.hpp>
+#include <gpcxx/tree/intrusive_functions.hpp>
+#include <gpcxx/tree/intrusive_tree.hpp>
+#include <gpcxx/tree/iterator/iterator_base.hpp>
+#include <gpcxx/tree/iterator/postorder_iterator.hpp>
+#include <gpcxx/tree/iterator/preorder_iterator.hpp>
+#include <gpcxx/tree/node_index.hpp>
+#include <gpcxx/tree/semantic_individual.hpp>
+#include <gpcxx/tree/transform_tree.hpp>
+
+
+#endif // GPCXX_TREE_HPP_DEFINED
@@ -0,0 +1,33 @@
+/*
+ * gpcxx/util.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_HPP_DEFINED
+#define GPCXX_UTIL_HPP_DEFINED
+
+
+#include <gpcxx/util/alias_table.hpp>
+#include <gpcxx/util/array_unpack.hpp>
+#include <gpcxx/util/assert.hpp>
+#include <gpcxx/util/create_random_indices.hpp>
+#include <gpcxx/util/exception.hpp>
+#include <gpcxx/util/identity.hpp>
+#include <gpcxx/util/indent.hpp>
+#include <gpcxx/util/iterate_until.hpp>
+#include <gpcxx/util/macros.hpp>
+#include <gpcxx/util/philox_engine.hpp>
+#include <gpcxx/util/rank_cache.hpp>
+#include <gpcxx/util/recycling_allocator.hpp>
+#include <gpcxx/util/shm_ring_buffer.hpp>
+#include <gpcxx/util/sort_indices.hpp>
+#include <gpcxx/util/version.hpp>
+
+
+#endif // GPCXX_UTIL_HPP_DEFINED
@@ -0,0 +1,24 @@
+/*
+ * po/_rel_build/generated_includes/include/gpcxx/app.hpp
+ *
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef PO__REL_BUILD_GENERATED_INCLUDES_INCLUDE_GPCXX_APP_HPP_DEFINED
+#define PO__REL_BUILD_GENERATED_INCLUDES_INCLUDE_GPCXX_APP_HPP_DEFINED
+
+
+#include <gpcxx/app/generate_evenly_spaced_test_data.hpp>
+#include <gpcxx/app/generate_normal_distributed_test_data.hpp>
+#include <gpcxx/app/generate_random_test_data.hpp>
+#include <gpcxx/app/generate_uniform_distributed_test_data.hpp>
+#include <gpcxx/app/normalize.hpp>
+#include <gpcxx/app/timer.hpp>
+
+
+#endif // PO__REL_BUILD_GENERATED_INCLUDES_INCLUDE_GPCXX_APP_HPP_DEFINED
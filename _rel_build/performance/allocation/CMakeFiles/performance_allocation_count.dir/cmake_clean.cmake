@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_allocation_count.dir/allocation_count.cpp.o"
+  "CMakeFiles/performance_allocation_count.dir/allocation_count.cpp.o.d"
+  "performance_allocation_count"
+  "performance_allocation_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_allocation_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/performance/any_genetic_operator/any_genetic_operator.cpp" "performance/any_genetic_operator/CMakeFiles/performance_any_genetic_operator.dir/any_genetic_operator.cpp.o" "gcc" "performance/any_genetic_operator/CMakeFiles/performance_any_genetic_operator.dir/any_genetic_operator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
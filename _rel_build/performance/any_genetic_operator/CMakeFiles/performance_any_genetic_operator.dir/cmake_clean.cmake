@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_any_genetic_operator.dir/any_genetic_operator.cpp.o"
+  "CMakeFiles/performance_any_genetic_operator.dir/any_genetic_operator.cpp.o.d"
+  "performance_any_genetic_operator"
+  "performance_any_genetic_operator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_any_genetic_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symbolic_regression.dir/symbolic_regression.cpp.o"
+  "CMakeFiles/symbolic_regression.dir/symbolic_regression.cpp.o.d"
+  "symbolic_regression"
+  "symbolic_regression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symbolic_regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_checkpoint.dir/checkpoint.cpp.o"
+  "CMakeFiles/performance_checkpoint.dir/checkpoint.cpp.o.d"
+  "performance_checkpoint"
+  "performance_checkpoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_checkpoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_crossover_bloat.dir/crossover_bloat.cpp.o"
+  "CMakeFiles/performance_crossover_bloat.dir/crossover_bloat.cpp.o.d"
+  "performance_crossover_bloat"
+  "performance_crossover_bloat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_crossover_bloat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_splice_crossover.dir/splice_crossover.cpp.o"
+  "CMakeFiles/performance_splice_crossover.dir/splice_crossover.cpp.o.d"
+  "performance_splice_crossover"
+  "performance_splice_crossover.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_splice_crossover.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_eval_basic.dir/eval_basic.cpp.o"
+  "CMakeFiles/performance_eval_basic.dir/eval_basic.cpp.o.d"
+  "performance_eval_basic"
+  "performance_eval_basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_eval_basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
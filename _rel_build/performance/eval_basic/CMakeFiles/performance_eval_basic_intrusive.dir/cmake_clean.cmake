@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_eval_basic_intrusive.dir/eval_basic_intrusive.cpp.o"
+  "CMakeFiles/performance_eval_basic_intrusive.dir/eval_basic_intrusive.cpp.o.d"
+  "performance_eval_basic_intrusive"
+  "performance_eval_basic_intrusive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_eval_basic_intrusive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
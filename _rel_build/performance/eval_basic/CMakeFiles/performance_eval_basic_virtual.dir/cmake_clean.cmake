@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_eval_basic_virtual.dir/eval_basic_virtual.cpp.o"
+  "CMakeFiles/performance_eval_basic_virtual.dir/eval_basic_virtual.cpp.o.d"
+  "performance_eval_basic_virtual"
+  "performance_eval_basic_virtual.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_eval_basic_virtual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
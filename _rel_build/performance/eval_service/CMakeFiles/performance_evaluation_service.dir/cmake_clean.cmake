@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_evaluation_service.dir/evaluation_service.cpp.o"
+  "CMakeFiles/performance_evaluation_service.dir/evaluation_service.cpp.o.d"
+  "performance_evaluation_service"
+  "performance_evaluation_service.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_evaluation_service.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_ptc2.dir/ptc2.cpp.o"
+  "CMakeFiles/performance_ptc2.dir/ptc2.cpp.o.d"
+  "performance_ptc2"
+  "performance_ptc2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_ptc2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
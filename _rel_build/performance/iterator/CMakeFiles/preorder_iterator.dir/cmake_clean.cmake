@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/preorder_iterator.dir/preorder_iterator.cpp.o"
+  "CMakeFiles/preorder_iterator.dir/preorder_iterator.cpp.o.d"
+  "preorder_iterator"
+  "preorder_iterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/preorder_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
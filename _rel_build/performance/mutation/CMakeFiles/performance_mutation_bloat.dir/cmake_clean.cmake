@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_mutation_bloat.dir/mutation_bloat.cpp.o"
+  "CMakeFiles/performance_mutation_bloat.dir/mutation_bloat.cpp.o.d"
+  "performance_mutation_bloat"
+  "performance_mutation_bloat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_mutation_bloat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
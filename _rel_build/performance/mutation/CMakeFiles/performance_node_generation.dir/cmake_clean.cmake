@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_node_generation.dir/node_generation.cpp.o"
+  "CMakeFiles/performance_node_generation.dir/node_generation.cpp.o.d"
+  "performance_node_generation"
+  "performance_node_generation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_node_generation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_point_mutation.dir/point_mutation.cpp.o"
+  "CMakeFiles/performance_point_mutation.dir/point_mutation.cpp.o.d"
+  "performance_point_mutation"
+  "performance_point_mutation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_point_mutation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
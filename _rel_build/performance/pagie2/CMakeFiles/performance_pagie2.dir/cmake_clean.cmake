@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_pagie2.dir/pagie2.cpp.o"
+  "CMakeFiles/performance_pagie2.dir/pagie2.cpp.o.d"
+  "performance_pagie2"
+  "performance_pagie2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_pagie2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_pagie2_intrusive.dir/pagie2_intrusive.cpp.o"
+  "CMakeFiles/performance_pagie2_intrusive.dir/pagie2_intrusive.cpp.o.d"
+  "performance_pagie2_intrusive"
+  "performance_pagie2_intrusive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_pagie2_intrusive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_pipelined_symbolic_regression.dir/pipelined_symbolic_regression.cpp.o"
+  "CMakeFiles/performance_pipelined_symbolic_regression.dir/pipelined_symbolic_regression.cpp.o.d"
+  "performance_pipelined_symbolic_regression"
+  "performance_pipelined_symbolic_regression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_pipelined_symbolic_regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_tournament_rng.dir/tournament_rng.cpp.o"
+  "CMakeFiles/performance_tournament_rng.dir/tournament_rng.cpp.o.d"
+  "performance_tournament_rng"
+  "performance_tournament_rng.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_tournament_rng.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
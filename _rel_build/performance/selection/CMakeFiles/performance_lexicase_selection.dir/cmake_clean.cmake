@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_lexicase_selection.dir/lexicase_selection.cpp.o"
+  "CMakeFiles/performance_lexicase_selection.dir/lexicase_selection.cpp.o.d"
+  "performance_lexicase_selection"
+  "performance_lexicase_selection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_lexicase_selection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/performance_tournament_selection.dir/tournament_selection.cpp.o"
+  "CMakeFiles/performance_tournament_selection.dir/tournament_selection.cpp.o.d"
+  "performance_tournament_selection"
+  "performance_tournament_selection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/performance_tournament_selection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_rel_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("app")
+subdirs("io")
+subdirs("operator")
+subdirs("tree")
+subdirs("util")
+subdirs("generate")
+subdirs("eval")
+subdirs("stat")
+subdirs("canonic")
+subdirs("evolve")
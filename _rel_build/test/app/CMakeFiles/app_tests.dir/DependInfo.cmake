@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/app/benchmark_problems.cpp" "test/app/CMakeFiles/app_tests.dir/benchmark_problems.cpp.o" "gcc" "test/app/CMakeFiles/app_tests.dir/benchmark_problems.cpp.o.d"
+  "/root/repo/test/app/generate_evenly_spaced_test_data.cpp" "test/app/CMakeFiles/app_tests.dir/generate_evenly_spaced_test_data.cpp.o" "gcc" "test/app/CMakeFiles/app_tests.dir/generate_evenly_spaced_test_data.cpp.o.d"
+  "/root/repo/test/app/generate_random_test_data.cpp" "test/app/CMakeFiles/app_tests.dir/generate_random_test_data.cpp.o" "gcc" "test/app/CMakeFiles/app_tests.dir/generate_random_test_data.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/app_tests.dir/benchmark_problems.cpp.o"
+  "CMakeFiles/app_tests.dir/benchmark_problems.cpp.o.d"
+  "CMakeFiles/app_tests.dir/generate_evenly_spaced_test_data.cpp.o"
+  "CMakeFiles/app_tests.dir/generate_evenly_spaced_test_data.cpp.o.d"
+  "CMakeFiles/app_tests.dir/generate_random_test_data.cpp.o"
+  "CMakeFiles/app_tests.dir/generate_random_test_data.cpp.o.d"
+  "app_tests"
+  "app_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/app_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/app
+# Build directory: /root/repo/_rel_build/test/app
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(app_tests "/root/repo/_rel_build/test/app/app_tests")
+set_tests_properties(app_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/app/CMakeLists.txt;16;add_test;/root/repo/test/app/CMakeLists.txt;0;")
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/canonic/algebraic_node.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/algebraic_node.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/algebraic_node.cpp.o.d"
+  "/root/repo/test/canonic/algebras.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/algebras.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/algebras.cpp.o.d"
+  "/root/repo/test/canonic/canonic_complete.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/canonic_complete.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/canonic_complete.cpp.o.d"
+  "/root/repo/test/canonic/group.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/group.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/group.cpp.o.d"
+  "/root/repo/test/canonic/left_lift.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/left_lift.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/left_lift.cpp.o.d"
+  "/root/repo/test/canonic/remove_double_inverse_functions.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/remove_double_inverse_functions.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/remove_double_inverse_functions.cpp.o.d"
+  "/root/repo/test/canonic/remove_inverse_operations.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/remove_inverse_operations.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/remove_inverse_operations.cpp.o.d"
+  "/root/repo/test/canonic/sort_commutative.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/sort_commutative.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/sort_commutative.cpp.o.d"
+  "/root/repo/test/canonic/summarize_constants.cpp" "test/canonic/CMakeFiles/canonic_tests.dir/summarize_constants.cpp.o" "gcc" "test/canonic/CMakeFiles/canonic_tests.dir/summarize_constants.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
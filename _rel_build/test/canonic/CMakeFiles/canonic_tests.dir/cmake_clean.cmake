@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/canonic_tests.dir/algebraic_node.cpp.o"
+  "CMakeFiles/canonic_tests.dir/algebraic_node.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/algebras.cpp.o"
+  "CMakeFiles/canonic_tests.dir/algebras.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/canonic_complete.cpp.o"
+  "CMakeFiles/canonic_tests.dir/canonic_complete.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/group.cpp.o"
+  "CMakeFiles/canonic_tests.dir/group.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/left_lift.cpp.o"
+  "CMakeFiles/canonic_tests.dir/left_lift.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/remove_double_inverse_functions.cpp.o"
+  "CMakeFiles/canonic_tests.dir/remove_double_inverse_functions.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/remove_inverse_operations.cpp.o"
+  "CMakeFiles/canonic_tests.dir/remove_inverse_operations.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/sort_commutative.cpp.o"
+  "CMakeFiles/canonic_tests.dir/sort_commutative.cpp.o.d"
+  "CMakeFiles/canonic_tests.dir/summarize_constants.cpp.o"
+  "CMakeFiles/canonic_tests.dir/summarize_constants.cpp.o.d"
+  "canonic_tests"
+  "canonic_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/canonic_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/canonic
+# Build directory: /root/repo/_rel_build/test/canonic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(canonic_tests "/root/repo/_rel_build/test/canonic/canonic_tests")
+set_tests_properties(canonic_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/canonic/CMakeLists.txt;22;add_test;/root/repo/test/canonic/CMakeLists.txt;0;")
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/eval/adjusted_fitness.cpp" "test/eval/CMakeFiles/eval_tests.dir/adjusted_fitness.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/adjusted_fitness.cpp.o.d"
+  "/root/repo/test/eval/error_matrix.cpp" "test/eval/CMakeFiles/eval_tests.dir/error_matrix.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/error_matrix.cpp.o.d"
+  "/root/repo/test/eval/evaluation_service.cpp" "test/eval/CMakeFiles/eval_tests.dir/evaluation_service.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/evaluation_service.cpp.o.d"
+  "/root/repo/test/eval/fitness_cache.cpp" "test/eval/CMakeFiles/eval_tests.dir/fitness_cache.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/fitness_cache.cpp.o.d"
+  "/root/repo/test/eval/hits.cpp" "test/eval/CMakeFiles/eval_tests.dir/hits.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/hits.cpp.o.d"
+  "/root/repo/test/eval/normalized_fitness.cpp" "test/eval/CMakeFiles/eval_tests.dir/normalized_fitness.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/normalized_fitness.cpp.o.d"
+  "/root/repo/test/eval/static_eval.cpp" "test/eval/CMakeFiles/eval_tests.dir/static_eval.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/static_eval.cpp.o.d"
+  "/root/repo/test/eval/static_eval_erc.cpp" "test/eval/CMakeFiles/eval_tests.dir/static_eval_erc.cpp.o" "gcc" "test/eval/CMakeFiles/eval_tests.dir/static_eval_erc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
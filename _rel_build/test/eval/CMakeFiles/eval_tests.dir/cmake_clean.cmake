@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eval_tests.dir/adjusted_fitness.cpp.o"
+  "CMakeFiles/eval_tests.dir/adjusted_fitness.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/error_matrix.cpp.o"
+  "CMakeFiles/eval_tests.dir/error_matrix.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/evaluation_service.cpp.o"
+  "CMakeFiles/eval_tests.dir/evaluation_service.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/fitness_cache.cpp.o"
+  "CMakeFiles/eval_tests.dir/fitness_cache.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/hits.cpp.o"
+  "CMakeFiles/eval_tests.dir/hits.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/normalized_fitness.cpp.o"
+  "CMakeFiles/eval_tests.dir/normalized_fitness.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/static_eval.cpp.o"
+  "CMakeFiles/eval_tests.dir/static_eval.cpp.o.d"
+  "CMakeFiles/eval_tests.dir/static_eval_erc.cpp.o"
+  "CMakeFiles/eval_tests.dir/static_eval_erc.cpp.o.d"
+  "eval_tests"
+  "eval_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eval_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
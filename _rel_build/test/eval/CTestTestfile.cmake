@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/eval
+# Build directory: /root/repo/_rel_build/test/eval
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(eval_tests "/root/repo/_rel_build/test/eval/eval_tests")
+set_tests_properties(eval_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/eval/CMakeLists.txt;21;add_test;/root/repo/test/eval/CMakeLists.txt;0;")
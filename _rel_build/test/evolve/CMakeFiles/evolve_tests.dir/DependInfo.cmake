@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/evolve/async_steady_state.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/async_steady_state.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/async_steady_state.cpp.o.d"
+  "/root/repo/test/evolve/double_buffered_population.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/double_buffered_population.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/double_buffered_population.cpp.o.d"
+  "/root/repo/test/evolve/dynamic_pipeline.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/dynamic_pipeline.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/dynamic_pipeline.cpp.o.d"
+  "/root/repo/test/evolve/island_model.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/island_model.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/island_model.cpp.o.d"
+  "/root/repo/test/evolve/pipelined_evolution.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/pipelined_evolution.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/pipelined_evolution.cpp.o.d"
+  "/root/repo/test/evolve/process_island.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/process_island.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/process_island.cpp.o.d"
+  "/root/repo/test/evolve/steady_state_pipeline.cpp" "test/evolve/CMakeFiles/evolve_tests.dir/steady_state_pipeline.cpp.o" "gcc" "test/evolve/CMakeFiles/evolve_tests.dir/steady_state_pipeline.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
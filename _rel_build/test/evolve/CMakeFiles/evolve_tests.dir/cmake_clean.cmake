@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/evolve_tests.dir/async_steady_state.cpp.o"
+  "CMakeFiles/evolve_tests.dir/async_steady_state.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/double_buffered_population.cpp.o"
+  "CMakeFiles/evolve_tests.dir/double_buffered_population.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/dynamic_pipeline.cpp.o"
+  "CMakeFiles/evolve_tests.dir/dynamic_pipeline.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/island_model.cpp.o"
+  "CMakeFiles/evolve_tests.dir/island_model.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/pipelined_evolution.cpp.o"
+  "CMakeFiles/evolve_tests.dir/pipelined_evolution.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/process_island.cpp.o"
+  "CMakeFiles/evolve_tests.dir/process_island.cpp.o.d"
+  "CMakeFiles/evolve_tests.dir/steady_state_pipeline.cpp.o"
+  "CMakeFiles/evolve_tests.dir/steady_state_pipeline.cpp.o.d"
+  "evolve_tests"
+  "evolve_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/evolve_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
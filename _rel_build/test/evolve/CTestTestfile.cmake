@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/evolve
+# Build directory: /root/repo/_rel_build/test/evolve
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(evolve_tests "/root/repo/_rel_build/test/evolve/evolve_tests")
+set_tests_properties(evolve_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/evolve/CMakeLists.txt;20;add_test;/root/repo/test/evolve/CMakeLists.txt;0;")
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/generate/basic_generate_strategy.cpp" "test/generate/CMakeFiles/generate_tests.dir/basic_generate_strategy.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/basic_generate_strategy.cpp.o.d"
+  "/root/repo/test/generate/generate_population.cpp" "test/generate/CMakeFiles/generate_tests.dir/generate_population.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/generate_population.cpp.o.d"
+  "/root/repo/test/generate/node_generator.cpp" "test/generate/CMakeFiles/generate_tests.dir/node_generator.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/node_generator.cpp.o.d"
+  "/root/repo/test/generate/ptc2.cpp" "test/generate/CMakeFiles/generate_tests.dir/ptc2.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/ptc2.cpp.o.d"
+  "/root/repo/test/generate/static_node_generator.cpp" "test/generate/CMakeFiles/generate_tests.dir/static_node_generator.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/static_node_generator.cpp.o.d"
+  "/root/repo/test/generate/uniform_symbol.cpp" "test/generate/CMakeFiles/generate_tests.dir/uniform_symbol.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/uniform_symbol.cpp.o.d"
+  "/root/repo/test/generate/uniform_symbol_erc.cpp" "test/generate/CMakeFiles/generate_tests.dir/uniform_symbol_erc.cpp.o" "gcc" "test/generate/CMakeFiles/generate_tests.dir/uniform_symbol_erc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_tests.dir/basic_generate_strategy.cpp.o"
+  "CMakeFiles/generate_tests.dir/basic_generate_strategy.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/generate_population.cpp.o"
+  "CMakeFiles/generate_tests.dir/generate_population.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/node_generator.cpp.o"
+  "CMakeFiles/generate_tests.dir/node_generator.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/ptc2.cpp.o"
+  "CMakeFiles/generate_tests.dir/ptc2.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/static_node_generator.cpp.o"
+  "CMakeFiles/generate_tests.dir/static_node_generator.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/uniform_symbol.cpp.o"
+  "CMakeFiles/generate_tests.dir/uniform_symbol.cpp.o.d"
+  "CMakeFiles/generate_tests.dir/uniform_symbol_erc.cpp.o"
+  "CMakeFiles/generate_tests.dir/uniform_symbol_erc.cpp.o.d"
+  "generate_tests"
+  "generate_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
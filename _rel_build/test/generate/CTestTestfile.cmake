@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/generate
+# Build directory: /root/repo/_rel_build/test/generate
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(generate_tests "/root/repo/_rel_build/test/generate/generate_tests")
+set_tests_properties(generate_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/generate/CMakeLists.txt;20;add_test;/root/repo/test/generate/CMakeLists.txt;0;")
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/io/best_individuals.cpp" "test/io/CMakeFiles/io_tests.dir/best_individuals.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/best_individuals.cpp.o.d"
+  "/root/repo/test/io/binary.cpp" "test/io/CMakeFiles/io_tests.dir/binary.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/binary.cpp.o.d"
+  "/root/repo/test/io/bracket.cpp" "test/io/CMakeFiles/io_tests.dir/bracket.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/bracket.cpp.o.d"
+  "/root/repo/test/io/checkpoint.cpp" "test/io/CMakeFiles/io_tests.dir/checkpoint.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/checkpoint.cpp.o.d"
+  "/root/repo/test/io/graphviz.cpp" "test/io/CMakeFiles/io_tests.dir/graphviz.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/graphviz.cpp.o.d"
+  "/root/repo/test/io/json.cpp" "test/io/CMakeFiles/io_tests.dir/json.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/json.cpp.o.d"
+  "/root/repo/test/io/polish.cpp" "test/io/CMakeFiles/io_tests.dir/polish.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/polish.cpp.o.d"
+  "/root/repo/test/io/population_json.cpp" "test/io/CMakeFiles/io_tests.dir/population_json.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/population_json.cpp.o.d"
+  "/root/repo/test/io/simple.cpp" "test/io/CMakeFiles/io_tests.dir/simple.cpp.o" "gcc" "test/io/CMakeFiles/io_tests.dir/simple.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
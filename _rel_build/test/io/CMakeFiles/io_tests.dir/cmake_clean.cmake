@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_tests.dir/best_individuals.cpp.o"
+  "CMakeFiles/io_tests.dir/best_individuals.cpp.o.d"
+  "CMakeFiles/io_tests.dir/binary.cpp.o"
+  "CMakeFiles/io_tests.dir/binary.cpp.o.d"
+  "CMakeFiles/io_tests.dir/bracket.cpp.o"
+  "CMakeFiles/io_tests.dir/bracket.cpp.o.d"
+  "CMakeFiles/io_tests.dir/checkpoint.cpp.o"
+  "CMakeFiles/io_tests.dir/checkpoint.cpp.o.d"
+  "CMakeFiles/io_tests.dir/graphviz.cpp.o"
+  "CMakeFiles/io_tests.dir/graphviz.cpp.o.d"
+  "CMakeFiles/io_tests.dir/json.cpp.o"
+  "CMakeFiles/io_tests.dir/json.cpp.o.d"
+  "CMakeFiles/io_tests.dir/polish.cpp.o"
+  "CMakeFiles/io_tests.dir/polish.cpp.o.d"
+  "CMakeFiles/io_tests.dir/population_json.cpp.o"
+  "CMakeFiles/io_tests.dir/population_json.cpp.o.d"
+  "CMakeFiles/io_tests.dir/simple.cpp.o"
+  "CMakeFiles/io_tests.dir/simple.cpp.o.d"
+  "io_tests"
+  "io_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
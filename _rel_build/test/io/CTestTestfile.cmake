@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/io
+# Build directory: /root/repo/_rel_build/test/io
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(io_tests "/root/repo/_rel_build/test/io/io_tests")
+set_tests_properties(io_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;22;add_test;/root/repo/test/io/CMakeLists.txt;0;")
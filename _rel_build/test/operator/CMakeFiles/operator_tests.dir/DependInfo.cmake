@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/operator/any_genetic_operator.cpp" "test/operator/CMakeFiles/operator_tests.dir/any_genetic_operator.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/any_genetic_operator.cpp.o.d"
+  "/root/repo/test/operator/batch_tournament_selector.cpp" "test/operator/CMakeFiles/operator_tests.dir/batch_tournament_selector.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/batch_tournament_selector.cpp.o.d"
+  "/root/repo/test/operator/crossover.cpp" "test/operator/CMakeFiles/operator_tests.dir/crossover.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/crossover.cpp.o.d"
+  "/root/repo/test/operator/geometric_semantic_operators.cpp" "test/operator/CMakeFiles/operator_tests.dir/geometric_semantic_operators.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/geometric_semantic_operators.cpp.o.d"
+  "/root/repo/test/operator/height_constrained_crossover_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/height_constrained_crossover_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/height_constrained_crossover_strategy.cpp.o.d"
+  "/root/repo/test/operator/hoist_mutation.cpp" "test/operator/CMakeFiles/operator_tests.dir/hoist_mutation.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/hoist_mutation.cpp.o.d"
+  "/root/repo/test/operator/homologous_crossover_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/homologous_crossover_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/homologous_crossover_strategy.cpp.o.d"
+  "/root/repo/test/operator/lexicase_selector.cpp" "test/operator/CMakeFiles/operator_tests.dir/lexicase_selector.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/lexicase_selector.cpp.o.d"
+  "/root/repo/test/operator/multi_mutation.cpp" "test/operator/CMakeFiles/operator_tests.dir/multi_mutation.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/multi_mutation.cpp.o.d"
+  "/root/repo/test/operator/mutation.cpp" "test/operator/CMakeFiles/operator_tests.dir/mutation.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/mutation.cpp.o.d"
+  "/root/repo/test/operator/one_point_crossover_pip_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/one_point_crossover_pip_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/one_point_crossover_pip_strategy.cpp.o.d"
+  "/root/repo/test/operator/one_point_crossover_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/one_point_crossover_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/one_point_crossover_strategy.cpp.o.d"
+  "/root/repo/test/operator/point_mutation.cpp" "test/operator/CMakeFiles/operator_tests.dir/point_mutation.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/point_mutation.cpp.o.d"
+  "/root/repo/test/operator/random_selector.cpp" "test/operator/CMakeFiles/operator_tests.dir/random_selector.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/random_selector.cpp.o.d"
+  "/root/repo/test/operator/reproduce.cpp" "test/operator/CMakeFiles/operator_tests.dir/reproduce.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/reproduce.cpp.o.d"
+  "/root/repo/test/operator/shrink_mutation.cpp" "test/operator/CMakeFiles/operator_tests.dir/shrink_mutation.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/shrink_mutation.cpp.o.d"
+  "/root/repo/test/operator/simple_mutation_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/simple_mutation_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/simple_mutation_strategy.cpp.o.d"
+  "/root/repo/test/operator/size_fair_crossover_strategy.cpp" "test/operator/CMakeFiles/operator_tests.dir/size_fair_crossover_strategy.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/size_fair_crossover_strategy.cpp.o.d"
+  "/root/repo/test/operator/splice_crossover.cpp" "test/operator/CMakeFiles/operator_tests.dir/splice_crossover.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/splice_crossover.cpp.o.d"
+  "/root/repo/test/operator/tournament_selector.cpp" "test/operator/CMakeFiles/operator_tests.dir/tournament_selector.cpp.o" "gcc" "test/operator/CMakeFiles/operator_tests.dir/tournament_selector.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/operator_tests.dir/any_genetic_operator.cpp.o"
+  "CMakeFiles/operator_tests.dir/any_genetic_operator.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/batch_tournament_selector.cpp.o"
+  "CMakeFiles/operator_tests.dir/batch_tournament_selector.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/crossover.cpp.o"
+  "CMakeFiles/operator_tests.dir/crossover.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/geometric_semantic_operators.cpp.o"
+  "CMakeFiles/operator_tests.dir/geometric_semantic_operators.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/height_constrained_crossover_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/height_constrained_crossover_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/hoist_mutation.cpp.o"
+  "CMakeFiles/operator_tests.dir/hoist_mutation.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/homologous_crossover_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/homologous_crossover_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/lexicase_selector.cpp.o"
+  "CMakeFiles/operator_tests.dir/lexicase_selector.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/multi_mutation.cpp.o"
+  "CMakeFiles/operator_tests.dir/multi_mutation.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/mutation.cpp.o"
+  "CMakeFiles/operator_tests.dir/mutation.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/one_point_crossover_pip_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/one_point_crossover_pip_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/one_point_crossover_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/one_point_crossover_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/point_mutation.cpp.o"
+  "CMakeFiles/operator_tests.dir/point_mutation.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/random_selector.cpp.o"
+  "CMakeFiles/operator_tests.dir/random_selector.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/reproduce.cpp.o"
+  "CMakeFiles/operator_tests.dir/reproduce.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/shrink_mutation.cpp.o"
+  "CMakeFiles/operator_tests.dir/shrink_mutation.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/simple_mutation_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/simple_mutation_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/size_fair_crossover_strategy.cpp.o"
+  "CMakeFiles/operator_tests.dir/size_fair_crossover_strategy.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/splice_crossover.cpp.o"
+  "CMakeFiles/operator_tests.dir/splice_crossover.cpp.o.d"
+  "CMakeFiles/operator_tests.dir/tournament_selector.cpp.o"
+  "CMakeFiles/operator_tests.dir/tournament_selector.cpp.o.d"
+  "operator_tests"
+  "operator_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/operator_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
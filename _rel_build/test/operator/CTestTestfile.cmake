@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/operator
+# Build directory: /root/repo/_rel_build/test/operator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(operator_tests "/root/repo/_rel_build/test/operator/operator_tests")
+set_tests_properties(operator_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/operator/CMakeLists.txt;33;add_test;/root/repo/test/operator/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stat_tests.dir/node_statistics.cpp.o"
+  "CMakeFiles/stat_tests.dir/node_statistics.cpp.o.d"
+  "stat_tests"
+  "stat_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stat_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/stat
+# Build directory: /root/repo/_rel_build/test/stat
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(stat_tests "/root/repo/_rel_build/test/stat/stat_tests")
+set_tests_properties(stat_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/stat/CMakeLists.txt;13;add_test;/root/repo/test/stat/CMakeLists.txt;0;")
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/tree/basic_nary_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/basic_nary_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/basic_nary_tree.cpp.o.d"
+  "/root/repo/test/tree/basic_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/basic_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/basic_tree.cpp.o.d"
+  "/root/repo/test/tree/general_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/general_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/general_tree.cpp.o.d"
+  "/root/repo/test/tree/hash_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/hash_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/hash_tree.cpp.o.d"
+  "/root/repo/test/tree/intrusive_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/intrusive_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/intrusive_tree.cpp.o.d"
+  "/root/repo/test/tree/node_index.cpp" "test/tree/CMakeFiles/tree_tests.dir/node_index.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/node_index.cpp.o.d"
+  "/root/repo/test/tree/postorder_iterator.cpp" "test/tree/CMakeFiles/tree_tests.dir/postorder_iterator.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/postorder_iterator.cpp.o.d"
+  "/root/repo/test/tree/preorder_iterator.cpp" "test/tree/CMakeFiles/tree_tests.dir/preorder_iterator.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/preorder_iterator.cpp.o.d"
+  "/root/repo/test/tree/semantic_individual.cpp" "test/tree/CMakeFiles/tree_tests.dir/semantic_individual.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/semantic_individual.cpp.o.d"
+  "/root/repo/test/tree/transform_tree.cpp" "test/tree/CMakeFiles/tree_tests.dir/transform_tree.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/transform_tree.cpp.o.d"
+  "/root/repo/test/tree/tree_base.cpp" "test/tree/CMakeFiles/tree_tests.dir/tree_base.cpp.o" "gcc" "test/tree/CMakeFiles/tree_tests.dir/tree_base.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
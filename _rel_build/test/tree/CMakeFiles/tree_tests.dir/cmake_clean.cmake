@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tree_tests.dir/basic_nary_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/basic_nary_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/basic_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/basic_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/general_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/general_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/hash_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/hash_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/intrusive_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/intrusive_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/node_index.cpp.o"
+  "CMakeFiles/tree_tests.dir/node_index.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/postorder_iterator.cpp.o"
+  "CMakeFiles/tree_tests.dir/postorder_iterator.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/preorder_iterator.cpp.o"
+  "CMakeFiles/tree_tests.dir/preorder_iterator.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/semantic_individual.cpp.o"
+  "CMakeFiles/tree_tests.dir/semantic_individual.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/transform_tree.cpp.o"
+  "CMakeFiles/tree_tests.dir/transform_tree.cpp.o.d"
+  "CMakeFiles/tree_tests.dir/tree_base.cpp.o"
+  "CMakeFiles/tree_tests.dir/tree_base.cpp.o.d"
+  "tree_tests"
+  "tree_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tree_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
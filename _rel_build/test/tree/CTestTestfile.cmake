@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/tree
+# Build directory: /root/repo/_rel_build/test/tree
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tree_tests "/root/repo/_rel_build/test/tree/tree_tests")
+set_tests_properties(tree_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/tree/CMakeLists.txt;24;add_test;/root/repo/test/tree/CMakeLists.txt;0;")
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/util/alias_table.cpp" "test/util/CMakeFiles/util_tests.dir/alias_table.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/alias_table.cpp.o.d"
+  "/root/repo/test/util/array_unpack.cpp" "test/util/CMakeFiles/util_tests.dir/array_unpack.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/array_unpack.cpp.o.d"
+  "/root/repo/test/util/create_random_indices.cpp" "test/util/CMakeFiles/util_tests.dir/create_random_indices.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/create_random_indices.cpp.o.d"
+  "/root/repo/test/util/exception.cpp" "test/util/CMakeFiles/util_tests.dir/exception.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/exception.cpp.o.d"
+  "/root/repo/test/util/iterate_until.cpp" "test/util/CMakeFiles/util_tests.dir/iterate_until.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/iterate_until.cpp.o.d"
+  "/root/repo/test/util/philox_engine.cpp" "test/util/CMakeFiles/util_tests.dir/philox_engine.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/philox_engine.cpp.o.d"
+  "/root/repo/test/util/rank_cache.cpp" "test/util/CMakeFiles/util_tests.dir/rank_cache.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/rank_cache.cpp.o.d"
+  "/root/repo/test/util/recycling_allocator.cpp" "test/util/CMakeFiles/util_tests.dir/recycling_allocator.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/recycling_allocator.cpp.o.d"
+  "/root/repo/test/util/shm_ring_buffer.cpp" "test/util/CMakeFiles/util_tests.dir/shm_ring_buffer.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/shm_ring_buffer.cpp.o.d"
+  "/root/repo/test/util/sort_indices.cpp" "test/util/CMakeFiles/util_tests.dir/sort_indices.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/sort_indices.cpp.o.d"
+  "/root/repo/test/util/version.cpp" "test/util/CMakeFiles/util_tests.dir/version.cpp.o" "gcc" "test/util/CMakeFiles/util_tests.dir/version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/util_tests.dir/alias_table.cpp.o"
+  "CMakeFiles/util_tests.dir/alias_table.cpp.o.d"
+  "CMakeFiles/util_tests.dir/array_unpack.cpp.o"
+  "CMakeFiles/util_tests.dir/array_unpack.cpp.o.d"
+  "CMakeFiles/util_tests.dir/create_random_indices.cpp.o"
+  "CMakeFiles/util_tests.dir/create_random_indices.cpp.o.d"
+  "CMakeFiles/util_tests.dir/exception.cpp.o"
+  "CMakeFiles/util_tests.dir/exception.cpp.o.d"
+  "CMakeFiles/util_tests.dir/iterate_until.cpp.o"
+  "CMakeFiles/util_tests.dir/iterate_until.cpp.o.d"
+  "CMakeFiles/util_tests.dir/philox_engine.cpp.o"
+  "CMakeFiles/util_tests.dir/philox_engine.cpp.o.d"
+  "CMakeFiles/util_tests.dir/rank_cache.cpp.o"
+  "CMakeFiles/util_tests.dir/rank_cache.cpp.o.d"
+  "CMakeFiles/util_tests.dir/recycling_allocator.cpp.o"
+  "CMakeFiles/util_tests.dir/recycling_allocator.cpp.o.d"
+  "CMakeFiles/util_tests.dir/shm_ring_buffer.cpp.o"
+  "CMakeFiles/util_tests.dir/shm_ring_buffer.cpp.o.d"
+  "CMakeFiles/util_tests.dir/sort_indices.cpp.o"
+  "CMakeFiles/util_tests.dir/sort_indices.cpp.o.d"
+  "CMakeFiles/util_tests.dir/version.cpp.o"
+  "CMakeFiles/util_tests.dir/version.cpp.o.d"
+  "util_tests"
+  "util_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/util_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/util
+# Build directory: /root/repo/_rel_build/test/util
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(util_tests "/root/repo/_rel_build/test/util/util_tests")
+set_tests_properties(util_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/util/CMakeLists.txt;13;add_test;/root/repo/test/util/CMakeLists.txt;0;")
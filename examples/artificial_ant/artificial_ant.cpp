@@ -26,7 +26,7 @@
 #include <random>
 #include <algorithm>
 #include <iterator>
-#include <unordered_set>
+#include <thread>
 #include <chrono>
 
 
@@ -114,25 +114,16 @@ int main( int argc , char *argv[] )
 
     //[tree_generator
     auto tree_generator      = gpcxx::make_basic_generate_strategy( rng , node_generator , min_tree_height , max_tree_height );
-    auto init_tree_generator = gpcxx::make_basic_generate_strategy( rng , node_generator , min_tree_height , init_max_tree_height );
     
     {
-        std::unordered_set<population_type::value_type> unique_init_population;
-
-        auto const unique_collision_clearance_factor = 3;
-        auto iteration = 0u;
-        auto const max_iteration = unsigned(population_size * unique_collision_clearance_factor);
-        while( unique_init_population.size() < population_size && iteration++ < max_iteration )
-        {
-            population_type::value_type individum;
-            init_tree_generator( individum );
-            unique_init_population.insert( std::move( individum ) );
-        }
-        if ( unique_init_population.size() != population_size )
-            throw gpcxx::gpcxx_exception( "Could not create unique population with the requested size" );
-        //population = population_type{ std::make_move_iterator( begin( unique_init_population ) ) , std::make_move_iterator( end( unique_init_population ) ) };
-        //std::make_move_iterator( begin( ... ) ) clang 3.6 does have an issue with this https://llvm.org/bugs/show_bug.cgi?id=19917
-        population = population_type{ begin( unique_init_population ) , end( unique_init_population ) };
+        gpcxx::generate_population_options options;
+        options.number_of_threads = std::max( std::thread::hardware_concurrency() , 1u );
+        options.unique = true;
+        options.seed = rng();
+        population = gpcxx::generate_population< population_type , rng_type >( population_size ,
+            [&node_generator]( rng_type& thread_rng ) {
+                return gpcxx::make_basic_generate_strategy( thread_rng , node_generator , min_tree_height , init_max_tree_height ); } ,
+            options );
     }
     //]
     
@@ -145,7 +136,7 @@ int main( int argc , char *argv[] )
          gpcxx::make_tournament_selector( rng , tournament_size ) );
     
     evolver.crossover_function() = gpcxx::make_crossover( 
-        gpcxx::make_one_point_crossover_pip_strategy( rng , max_tree_height, crossover_internal_point_rate ) ,
+        gpcxx::make_one_point_crossover_pip_strategy( rng , max_tree_height , 100 , crossover_internal_point_rate ) ,
         gpcxx::make_tournament_selector( rng , tournament_size ) );
     
     evolver.reproduction_function() = gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , tournament_size ) );
@@ -224,7 +224,7 @@ ant_result ant_simulation_gp(
 
     if(crossover_use_pip)
         evolver.crossover_function() = gpcxx::make_crossover(
-                gpcxx::make_one_point_crossover_pip_strategy(rng, max_tree_height, crossover_pip_rate ),
+                gpcxx::make_one_point_crossover_pip_strategy(rng, max_tree_height, 100, crossover_pip_rate ),
                 gpcxx::make_tournament_selector(rng, tournament_size));
     else
         evolver.crossover_function() = gpcxx::make_crossover(
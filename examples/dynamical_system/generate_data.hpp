@@ -13,6 +13,7 @@
 #define GPCXX_EXAMPLES_DYNAMICAL_SYSTEM_GENERATE_DATA_HPP_INCLUDED
 
 #include <array>
+#include <cstddef>
 #include <vector>
 #include <utility>
 
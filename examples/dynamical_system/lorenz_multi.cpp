@@ -27,6 +27,8 @@
 #include <boost/program_options.hpp>
 
 #include <iostream>
+#include <map>
+#include <string>
 
 namespace po = boost::program_options;
 
@@ -34,6 +36,11 @@ namespace po = boost::program_options;
 int main( int argc , char** argv )
 {
     auto options = dynsys::get_options();
+    options.add_options()
+    ( "checkpoint" , po::value< std::string >() , "file for the checkpoints of the evolution" )
+    ( "checkpoint_interval" , po::value< size_t >()->default_value( 50 ) , "number of generations between two checkpoints" )
+    ( "restart" , po::value< std::string >() , "resume the evolution from a checkpoint" )
+    ;
     auto positional_options = dynsys::get_positional_options();
     
     po::options_description cmdline_options;
@@ -91,6 +98,13 @@ int main( int argc , char** argv )
     size_t tournament_size = 15;
     //]
     
+    // stored in the checkpoints, a restart has to use the same parameters
+    std::map< std::string , std::string > parameters {
+        { "population_size" , std::to_string( population_size ) } ,
+        { "generation_size" , std::to_string( generation_size ) } ,
+        { "tournament_size" , std::to_string( tournament_size ) } ,
+        { "normalize" , std::to_string( vm.count( "normalize" ) ) } };
+    
     
     //[ define_population_and_fitness
     using population_type = std::vector< dynsys::individual_type >;
@@ -148,8 +162,26 @@ int main( int argc , char** argv )
                     
                     
     //[init_population
-    std::ofstream fout { vm[ "evolution" ].as< std::string >() };
-    for( size_t i=0 ; i<population.size() ; )
+    // a restart continues the evolution log
+    std::ofstream fout { vm[ "evolution" ].as< std::string >() , vm.count( "restart" ) ? std::ios::app : std::ios::out };
+    size_t first_generation = 0;
+    if( vm.count( "restart" ) )
+    {
+        gpcxx::checkpoint_state state;
+        gpcxx::read_checkpoint( gpcxx::read_checkpoint_file( vm[ "restart" ].as< std::string >() ) ,
+                                population , fitness , state , dynsys::checkpoint_node_mapper() );
+        if( state.parameters != parameters )
+        {
+            std::cerr << "Error the parameters of the checkpoint differ from the current ones:\n";
+            for( auto const& p : state.parameters )
+                std::cerr << "  " << p.first << " = " << p.second << "\n";
+            return -1;
+        }
+        gpcxx::restore_rng_state( rng , state.rng_state );
+        first_generation = size_t( state.generation );
+        std::cout << "Resuming from generation " << first_generation << std::endl;
+    }
+    for( size_t i=( first_generation == 0 ? 0 : population.size() ) ; i<population.size() ; )
     {
         for( size_t j=0 ; j<dynsys::dim ; ++j )
         {
@@ -164,18 +196,32 @@ int main( int argc , char** argv )
         ++i;
     }
     
-    std::cout << "Initial population" << std::endl;
-    dynsys::write_best_individuals( std::cout , population , fitness , 10 );
-    dynsys::write_best_individuals( fout , population , fitness , 10 , true );
+    if( first_generation == 0 )
+    {
+        std::cout << "Initial population" << std::endl;
+        dynsys::write_best_individuals( std::cout , population , fitness , 10 );
+        dynsys::write_best_individuals( fout , population , fitness , 10 , true );
+    }
     //]
     
     //[main_loop
-    for( size_t i=0 ; i<generation_size ; ++i )
+    gpcxx::async_checkpoint_writer checkpoint_writer;
+    for( size_t i=first_generation ; i<generation_size ; ++i )
     {
         evolver.next_generation( population , fitness );
         for( size_t i=0 ; i<population.size() ; ++i )
             fitness[i] = fitness_f( population[i] , training_data.first , training_data.second );
         
+        if( vm.count( "checkpoint" ) && ( ( i + 1 ) % vm[ "checkpoint_interval" ].as< size_t >() == 0 ) )
+        {
+            gpcxx::checkpoint_state state;
+            state.generation = i + 1;
+            state.rng_state = gpcxx::rng_state( rng );
+            state.parameters = parameters;
+            checkpoint_writer.write( vm[ "checkpoint" ].as< std::string >() , population , fitness , state ,
+                                     []( dynsys::node_type const& n ) { return dynsys::checkpoint_symbol( n ); } );
+        }
+        
         std::cout << "Iteration " << i << std::endl;
         dynsys::write_best_individuals( std::cout , population , fitness , 10 );
         dynsys::write_best_individuals( fout , population , fitness , 10 , true );
@@ -14,6 +14,8 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <cstdio>
+#include <cstdlib>
 #include <sstream>
 #include <functional>
 #include <unordered_map>
@@ -50,16 +52,15 @@ std::string serialize_winner( std::array< dynsys::tree_type , dim > const& winne
     return str.str();
 }
 
-deserialized_system deserialize_winner(const std::string& str )
+namespace {
+
+using map_type = std::unordered_map< std::string , mapped_func >;
+
+map_type const& symbol_map( void )
 {
     using namespace gpcxx;
     
-    using mapped_func = std::pair< size_t , std::function< node_type() > > ;
-    using map_type = std::unordered_map< std::string , mapped_func > ;
-    // using mapper_type = std::function< mapped_func( std::string const& ) > ;
-
-    
-    auto map = map_type {
+    static const map_type map = map_type {
         std::make_pair( "+" , std::make_pair( 2 , []() { return node_type( plus_func {} , "+" ); } ) ) ,
         std::make_pair( "-" , std::make_pair( 2 , []() { return node_type( minus_func {} , "-" ); } ) ) ,
         std::make_pair( "*" , std::make_pair( 2 , []() { return node_type( multiplies_func {} , "*" ); } ) ) ,
@@ -72,20 +73,55 @@ deserialized_system deserialize_winner(const std::string& str )
         std::make_pair( "y" , std::make_pair( 0 , []() { return node_type( array_terminal<1> {} , "y" ); } ) ) ,
         std::make_pair( "z" , std::make_pair( 0 , []() { return node_type( array_terminal<2> { } , "z" ); } ) ) 
     };
-    
-    auto mapper = [map]( std::string const& str ) {
-        auto iter = map.find( str );
-        if( iter != map.end() )
-        {
+    return map;
+}
+
+mapped_func constant( std::string const& name , double value )
+{
+    auto func = [name,value]() { return node_type( gpcxx::double_terminal< double > { value } , name ); };
+    return mapped_func { std::make_pair( 0 , func ) };
+}
+
+} // namespace
+
+
+node_mapper_type node_mapper( void )
+{
+    return []( std::string const& str ) {
+        auto iter = symbol_map().find( str );
+        if( iter != symbol_map().end() )
             return iter->second;
-        }
         else
-        {
-            auto value = std::stod( str );
-            auto func = [str,value]() { return node_type( double_terminal< double > { value } , str ); };
-            return mapped_func { std::make_pair( 0 , func ) };
-        }
+            return constant( str , std::stod( str ) );
     };
+}
+
+std::string checkpoint_symbol( node_type const& node )
+{
+    if( symbol_map().count( node.name() ) ) return node.name();
+
+    // constants are written with their exact value as hexfloat behind their name
+    context_type context {};
+    char value[64];
+    std::snprintf( value , sizeof( value ) , "%a" , node.eval( context ) );
+    return node.name() + "#" + value;
+}
+
+node_mapper_type checkpoint_node_mapper( void )
+{
+    return []( std::string const& str ) {
+        auto iter = symbol_map().find( str );
+        if( iter != symbol_map().end() ) return iter->second;
+        auto pos = str.rfind( '#' );
+        if( pos == std::string::npos ) return constant( str , std::stod( str ) );
+        return constant( str.substr( 0 , pos ) , std::strtod( str.c_str() + pos + 1 , nullptr ) );
+    };
+}
+
+
+deserialized_system deserialize_winner(const std::string& str )
+{
+    auto mapper = node_mapper();
     
     deserialized_system winner;
     boost::property_tree::ptree pt;
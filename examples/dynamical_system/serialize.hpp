@@ -16,7 +16,10 @@
 #include "generate_data.hpp"
 
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <utility>
 
 
 namespace dynsys {
@@ -31,6 +34,16 @@ struct deserialized_system
 std::string serialize_winner( std::array< tree_type , dim > const& winner , norm_type const& xnorm , norm_type const& ynorm );
 
 deserialized_system deserialize_winner( std::string const& );
+
+using mapped_func = std::pair< size_t , std::function< node_type() > >;
+using node_mapper_type = std::function< mapped_func( std::string const& ) >;
+
+// maps the names of the nodes to ( arity , node generator ), as needed by read_polish
+node_mapper_type node_mapper( void );
+
+// symbol and node mapper for checkpoints, the constants are restored exactly
+std::string checkpoint_symbol( node_type const& node );
+node_mapper_type checkpoint_node_mapper( void );
     
 
 
@@ -0,0 +1,117 @@
+/*
+ * gpcxx/eval/error_matrix.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVAL_ERROR_MATRIX_HPP_INCLUDED
+#define GPCXX_EVAL_ERROR_MATRIX_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Errors of every individual on every fitness case. The storage is column-major, the errors of all individuals on
+ * one case are contiguous, which is the access pattern of case-wise selection like lexicase selection. resize() keeps
+ * the capacity, hence the matrix does not allocate once it has been filled.
+ */
+template< typename Value = double >
+class error_matrix
+{
+public:
+
+    using value_type = Value;
+    using column_type = boost::iterator_range< value_type const* >;
+
+    /// Proxy for the errors of one individual, errors[c] is the error on case c.
+    class row_type
+    {
+    public:
+        row_type( value_type* first , size_t stride , size_t cases ) : m_first( first ) , m_stride( stride ) , m_cases( cases ) { }
+        value_type& operator[]( size_t c ) const { return m_first[ c * m_stride ]; }
+        size_t size( void ) const { return m_cases; }
+    private:
+        value_type* m_first;
+        size_t m_stride;
+        size_t m_cases;
+    };
+
+    error_matrix( void ) : m_individuals( 0 ) , m_cases( 0 ) , m_data() { }
+
+    error_matrix( size_t individuals , size_t cases )
+    : m_individuals( individuals ) , m_cases( cases ) , m_data( individuals * cases ) { }
+
+    void resize( size_t individuals , size_t cases )
+    {
+        m_individuals = individuals;
+        m_cases = cases;
+        m_data.resize( individuals * cases );
+    }
+
+    size_t individuals( void ) const { return m_individuals; }
+    size_t cases( void ) const { return m_cases; }
+
+    value_type& operator()( size_t individual , size_t c )
+    {
+        GPCXX_ASSERT( ( individual < m_individuals ) && ( c < m_cases ) );
+        return m_data[ c * m_individuals + individual ];
+    }
+
+    value_type const& operator()( size_t individual , size_t c ) const
+    {
+        GPCXX_ASSERT( ( individual < m_individuals ) && ( c < m_cases ) );
+        return m_data[ c * m_individuals + individual ];
+    }
+
+    column_type column( size_t c ) const
+    {
+        GPCXX_ASSERT( c < m_cases );
+        value_type const* first = m_data.data() + c * m_individuals;
+        return column_type( first , first + m_individuals );
+    }
+
+    row_type row( size_t individual )
+    {
+        GPCXX_ASSERT( individual < m_individuals );
+        return row_type( m_data.data() + individual , m_individuals , m_cases );
+    }
+
+    value_type const* data( void ) const { return m_data.data(); }
+
+private:
+
+    size_t m_individuals;
+    size_t m_cases;
+    std::vector< value_type > m_data;
+};
+
+
+/// Evaluates all individuals of pop with f( individual , errors ), which has to write the error on case c to errors[c]
+/// and returns the fitness of the individual. Fills the error matrix and the fitness vector.
+template< typename Pop , typename Fitness , typename Value , typename F >
+void evaluate_errors( Pop const& pop , Fitness& fitness , error_matrix< Value >& errors , size_t cases , F f )
+{
+    errors.resize( pop.size() , cases );
+    fitness.resize( pop.size() );
+    for( size_t i=0 ; i<pop.size() ; ++i )
+        fitness[i] = f( pop[i] , errors.row( i ) );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVAL_ERROR_MATRIX_HPP_INCLUDED
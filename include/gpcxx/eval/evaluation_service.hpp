@@ -0,0 +1,135 @@
+/*
+ * gpcxx/eval/evaluation_service.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVAL_EVALUATION_SERVICE_HPP_INCLUDED
+#define GPCXX_EVAL_EVALUATION_SERVICE_HPP_INCLUDED
+
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Master/worker evaluation: Serialized individuals are submitted to a queue, a pool of worker threads evaluates them
+ * and the fitness is returned by a future. Every worker thread owns a copy of the worker function, hence the worker can
+ * keep state like integration buffers. Exceptions of the worker are propagated through the future.
+ */
+template< typename Result = double >
+class evaluation_service
+{
+public:
+
+    using result_type = Result;
+    using worker_type = std::function< result_type( std::string const& ) >;
+
+    evaluation_service( size_t number_of_workers , worker_type worker )
+    : m_tasks() , m_mutex() , m_cond() , m_stop( false ) , m_threads()
+    {
+        GPCXX_ASSERT( number_of_workers > 0 );
+        for( size_t i=0 ; i<number_of_workers ; ++i )
+            m_threads.emplace_back( [this,worker]() { run_worker( worker ); } );
+    }
+
+    evaluation_service( evaluation_service const& ) = delete;
+    evaluation_service& operator=( evaluation_service const& ) = delete;
+
+    ~evaluation_service( void )
+    {
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        for( auto& t : m_threads ) t.join();
+    }
+
+    size_t number_of_workers( void ) const { return m_threads.size(); }
+
+    std::future< result_type > submit( std::string payload )
+    {
+        task_type task( std::move( payload ) , std::promise< result_type >() );
+        auto future = task.second.get_future();
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_tasks.push_back( std::move( task ) );
+        }
+        m_cond.notify_one();
+        return future;
+    }
+
+private:
+
+    using task_type = std::pair< std::string , std::promise< result_type > >;
+
+    void run_worker( worker_type worker )
+    {
+        while( true )
+        {
+            task_type task;
+            {
+                std::unique_lock< std::mutex > lock( m_mutex );
+                m_cond.wait( lock , [this]() { return m_stop || ! m_tasks.empty(); } );
+                if( m_tasks.empty() ) return;
+                task = std::move( m_tasks.front() );
+                m_tasks.pop_front();
+            }
+            try
+            {
+                task.second.set_value( worker( task.first ) );
+            }
+            catch( ... )
+            {
+                task.second.set_exception( std::current_exception() );
+            }
+        }
+    }
+
+    std::deque< task_type > m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_stop;
+    std::vector< std::thread > m_threads;
+};
+
+
+/**
+ * Local loopback worker: deserializes the tree with read_binary and evaluates it. Exercises exactly the path of a
+ * remote worker, such that serialization costs are measured and the mappers are tested.
+ */
+template< typename Tree , typename Evaluator , typename NodeMapper >
+std::function< typename std::result_of< Evaluator( Tree const& ) >::type ( std::string const& ) >
+make_loopback_worker( Evaluator eval , NodeMapper mapper )
+{
+    return [eval,mapper]( std::string const& payload ) {
+        Tree tree;
+        read_binary( payload , tree , mapper );
+        return eval( tree );
+    };
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVAL_EVALUATION_SERVICE_HPP_INCLUDED
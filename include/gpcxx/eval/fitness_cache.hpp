@@ -0,0 +1,208 @@
+/*
+ * gpcxx/eval/fitness_cache.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVAL_FITNESS_CACHE_HPP_INCLUDED
+#define GPCXX_EVAL_FITNESS_CACHE_HPP_INCLUDED
+
+#include <gpcxx/tree/hash_tree.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Bounded map from a 64 bit key, usually the hash of the canonical form of an individual, to its fitness. The cache is
+ * split into shards with one mutex each, hence concurrent lookups of different keys rarely contend. A full shard
+ * evicts its oldest entry. Keys are not verified, two individuals with the same 64 bit hash share their fitness.
+ */
+template< typename Value = double >
+class fitness_cache
+{
+public:
+
+    using value_type = Value;
+    using key_type = std::uint64_t;
+
+    fitness_cache( size_t capacity , size_t number_of_shards = 16 )
+    : m_shard_capacity( ( capacity + number_of_shards - 1 ) / number_of_shards ) , m_shards( number_of_shards )
+    , m_hits( 0 ) , m_misses( 0 )
+    {
+        GPCXX_ASSERT( capacity > 0 );
+        GPCXX_ASSERT( number_of_shards > 0 );
+        for( auto& s : m_shards )
+        {
+            s.map.reserve( m_shard_capacity );
+            s.keys.reserve( m_shard_capacity );
+        }
+    }
+
+    fitness_cache( fitness_cache const& ) = delete;
+    fitness_cache& operator=( fitness_cache const& ) = delete;
+
+    /// Looks up key, counts a hit or a miss.
+    bool find( key_type key , value_type& value )
+    {
+        shard& s = get_shard( key );
+        {
+            std::lock_guard< std::mutex > lock( s.mutex );
+            auto iter = s.map.find( key );
+            if( iter != s.map.end() )
+            {
+                value = iter->second;
+                ++m_hits;
+                return true;
+            }
+        }
+        ++m_misses;
+        return false;
+    }
+
+    void insert( key_type key , value_type value )
+    {
+        shard& s = get_shard( key );
+        std::lock_guard< std::mutex > lock( s.mutex );
+        auto iter = s.map.find( key );
+        if( iter != s.map.end() )
+        {
+            iter->second = std::move( value );
+            return;
+        }
+        if( s.keys.size() < m_shard_capacity )
+        {
+            s.keys.push_back( key );
+        }
+        else
+        {
+            s.map.erase( s.keys[ s.oldest ] );
+            s.keys[ s.oldest ] = key;
+            s.oldest = ( s.oldest + 1 ) % m_shard_capacity;
+        }
+        s.map.emplace( key , std::move( value ) );
+    }
+
+    /// Returns the cached value of key or evaluates f() and caches its result. f is called without holding a lock,
+    /// hence two threads missing the same key concurrently both evaluate it.
+    template< typename F >
+    value_type get_or_evaluate( key_type key , F&& f )
+    {
+        value_type value;
+        if( find( key , value ) ) return value;
+        value = f();
+        insert( key , value );
+        return value;
+    }
+
+    size_t hits( void ) const { return m_hits.load(); }
+    size_t misses( void ) const { return m_misses.load(); }
+    size_t capacity( void ) const { return m_shard_capacity * m_shards.size(); }
+    size_t number_of_shards( void ) const { return m_shards.size(); }
+
+    size_t size( void ) const
+    {
+        size_t n = 0;
+        for( auto& s : m_shards )
+        {
+            std::lock_guard< std::mutex > lock( s.mutex );
+            n += s.map.size();
+        }
+        return n;
+    }
+
+    void clear( void )
+    {
+        for( auto& s : m_shards )
+        {
+            std::lock_guard< std::mutex > lock( s.mutex );
+            s.map.clear();
+            s.keys.clear();
+            s.oldest = 0;
+        }
+        m_hits = 0;
+        m_misses = 0;
+    }
+
+private:
+
+    struct shard
+    {
+        shard( void ) : mutex() , map() , keys() , oldest( 0 ) { }
+        mutable std::mutex mutex;
+        std::unordered_map< key_type , value_type > map;
+        std::vector< key_type > keys;
+        size_t oldest;
+    };
+
+    shard& get_shard( key_type key )
+    {
+        // the low bits select the bucket of the map, use the high bits for the shard
+        return m_shards[ size_t( key >> 40 ) % m_shards.size() ];
+    }
+
+    size_t m_shard_capacity;
+    std::vector< shard > m_shards;
+    std::atomic< size_t > m_hits;
+    std::atomic< size_t > m_misses;
+};
+
+
+
+/**
+ * Fitness function which brings a copy of the individual to its canonical form, hashes it and looks the hash up in a
+ * fitness_cache before it evaluates the individual. canonicalize( tree ) transforms the tree in place, e.g. with
+ * transform_tree and the rules of the canonic module. The further arguments of the fitness function, like the training
+ * data, are not part of the key, use one cache per training data. Nodes are identified by node_hash, hence constants need
+ * a constant() flag, like algebraic_node, or exact names, like the ones of intrusive_erc_generator.
+ */
+template< typename Fitness , typename Canonicalize , typename Value = double >
+class memoized_fitness
+{
+public:
+
+    memoized_fitness( Fitness fitness , Canonicalize canonicalize , fitness_cache< Value >& cache )
+    : m_fitness( std::move( fitness ) ) , m_canonicalize( std::move( canonicalize ) ) , m_cache( cache ) { }
+
+    template< typename Tree , typename ... Args >
+    Value operator()( Tree const& t , Args const& ... args ) const
+    {
+        Tree canonical = t;
+        m_canonicalize( canonical );
+        return m_cache.get_or_evaluate( hash_tree( canonical ) , [&]() { return Value( m_fitness( t , args ... ) ); } );
+    }
+
+    fitness_cache< Value >& cache( void ) const { return m_cache; }
+
+private:
+
+    Fitness m_fitness;
+    Canonicalize m_canonicalize;
+    fitness_cache< Value >& m_cache;
+};
+
+template< typename Fitness , typename Canonicalize , typename Value >
+memoized_fitness< Fitness , Canonicalize , Value > make_memoized_fitness( Fitness fitness , Canonicalize canonicalize , fitness_cache< Value >& cache )
+{
+    return memoized_fitness< Fitness , Canonicalize , Value >( std::move( fitness ) , std::move( canonicalize ) , cache );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVAL_FITNESS_CACHE_HPP_INCLUDED
@@ -46,6 +46,16 @@ namespace detail {
         T operator()( T t ) const { return t * t; }
     };
     
+    struct discard_errors
+    {
+        struct sink
+        {
+            template< typename T >
+            void operator=( T const& ) const { }
+        };
+        sink operator[]( size_t ) const { return sink {}; }
+    };
+    
 } // namespace detail
 
 
@@ -62,6 +72,13 @@ struct regression_fitness
     
     template< typename Tree , typename TrainingData >
     value_type get_chi2( Tree const &t , TrainingData const& c ) const
+    {
+        return get_chi2( t , c , detail::discard_errors {} );
+    }
+
+    /// Like get_chi2, additionally stores the error on case i in errors[i], e.g. in a row of an error_matrix.
+    template< typename Tree , typename TrainingData , typename Errors >
+    value_type get_chi2( Tree const &t , TrainingData const& c , Errors&& errors ) const
     {
         // static_assert( TrainingData::n == context_type::n , "dimension of trainingsdata must be equal to dimension of evaluation context" );
         value_type chi2 = 0.0;
@@ -70,7 +87,9 @@ struct regression_fitness
             context_type cc;
             for( size_t j=0 ; j<TrainingData::dim ; ++j ) cc[j] = c.x[j][i];
             value_type yy = m_eval( t , cc );
-            chi2 += Norm()( yy - c.y[i] );
+            value_type error = Norm()( yy - c.y[i] );
+            errors[i] = error;
+            chi2 += error;
         }
         return chi2 / value_type( c.x[0].size() );
     }
@@ -78,7 +97,40 @@ struct regression_fitness
     template< typename Tree , typename TrainingData >
     value_type operator()( Tree const & t , TrainingData const& c ) const
     {
-        value_type chi2 = get_chi2( t , c );
+        return to_fitness( get_chi2( t , c ) );
+    }
+
+    template< typename Tree , typename TrainingData , typename Errors >
+    value_type operator()( Tree const & t , TrainingData const& c , Errors&& errors ) const
+    {
+        return to_fitness( get_chi2( t , c , errors ) );
+    }
+
+    /// Outputs of t on the training cases, outputs[i] is the value on case i.
+    template< typename Tree , typename TrainingData , typename Outputs >
+    void get_outputs( Tree const &t , TrainingData const& c , Outputs& outputs ) const
+    {
+        outputs.resize( c.x[0].size() );
+        for( size_t i=0 ; i<c.x[0].size() ; ++i )
+        {
+            context_type cc;
+            for( size_t j=0 ; j<TrainingData::dim ; ++j ) cc[j] = c.x[j][i];
+            outputs[i] = m_eval( t , cc );
+        }
+    }
+
+    /// Fitness of precomputed outputs, e.g. the cached semantics of a semantic_individual.
+    template< typename Outputs , typename TrainingData >
+    value_type from_outputs( Outputs const& outputs , TrainingData const& c ) const
+    {
+        value_type chi2 = 0.0;
+        for( size_t i=0 ; i<c.x[0].size() ; ++i )
+            chi2 += Norm()( outputs[i] - c.y[i] );
+        return to_fitness( chi2 / value_type( c.x[0].size() ) );
+    }
+
+    static value_type to_fitness( value_type chi2 )
+    {
         return ( std::isnan( chi2 ) ? 1.0 : 1.0 - 1.0 / ( 1.0 + chi2 ) );
     }
 };
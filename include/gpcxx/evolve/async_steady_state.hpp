@@ -0,0 +1,99 @@
+/*
+ * gpcxx/evolve/async_steady_state.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_ASYNC_STEADY_STATE_HPP_INCLUDED
+#define GPCXX_EVOLVE_ASYNC_STEADY_STATE_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <utility>
+
+
+namespace gpcxx {
+
+
+/**
+ * Steady state evolution without generation barriers: Offspring of a steady_state_pipeline are serialized and
+ * submitted to an evaluation_service. Whenever an evaluation finishes the individual is inserted and a new offspring
+ * is bred, such that max_in_flight evaluations are always pending. Runs until number_of_evaluations offspring are
+ * inserted and returns the number of inserted offspring.
+ *
+ * The pipeline breeds from the current population, hence individuals which are still evaluated do not take part in
+ * the selection. The observer of the pipeline, if not empty, is called once for every inserted individual.
+ */
+template< typename Pipeline , typename Service , typename Serializer >
+size_t evolve_async(
+    Pipeline& pipeline ,
+    typename Pipeline::population_type& pop ,
+    typename Pipeline::fitness_type& fitness ,
+    Service& service ,
+    Serializer serialize ,
+    size_t number_of_evaluations ,
+    size_t max_in_flight )
+{
+    GPCXX_ASSERT( max_in_flight > 0 );
+
+    using index_vector = typename Pipeline::index_vector;
+    struct pending_type
+    {
+        typename Pipeline::individual_type individual;
+        std::future< typename Service::result_type > result;
+        int choice;
+        index_vector parents;
+    };
+
+    bool const observe = static_cast< bool >( pipeline.operator_observer() );
+    std::deque< pending_type > pending;
+    size_t submitted = 0;
+    size_t inserted = 0;
+
+    auto refill = [&]() {
+        while( ( pending.size() < max_in_flight ) && ( submitted < number_of_evaluations ) )
+        {
+            auto offspring = pipeline.breed( pop , fitness );
+            for( auto& ind : offspring.individuals )
+            {
+                if( submitted == number_of_evaluations ) break;
+                auto future = service.submit( serialize( ind ) );
+                pending.push_back( pending_type { std::move( ind ) , std::move( future ) , offspring.choice ,
+                                                  observe ? offspring.parents : index_vector() } );
+                ++submitted;
+            }
+        }
+    };
+
+    refill();
+    while( ! pending.empty() )
+    {
+        // prefer any finished evaluation, block on the oldest one otherwise
+        auto iter = pending.begin();
+        for( ; iter != pending.end() ; ++iter )
+            if( iter->result.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready ) break;
+        if( iter == pending.end() ) iter = pending.begin();
+
+        auto value = iter->result.get();
+        size_t index = pipeline.insert( pop , fitness , std::move( iter->individual ) , value );
+        if( observe ) pipeline.operator_observer()( iter->choice , iter->parents , index_vector( 1 , index ) );
+        pending.erase( iter );
+        ++inserted;
+        refill();
+    }
+    return inserted;
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_ASYNC_STEADY_STATE_HPP_INCLUDED
@@ -0,0 +1,101 @@
+/*
+ * gpcxx/evolve/detail/island.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_DETAIL_ISLAND_HPP_INCLUDED
+#define GPCXX_EVOLVE_DETAIL_ISLAND_HPP_INCLUDED
+
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/// topology[i] contains the islands to which island i sends its migrants.
+using island_topology = std::vector< std::vector< size_t > >;
+
+
+template< typename FitnessValue >
+struct island_statistics
+{
+    size_t generations = 0;
+    size_t evaluations = 0;
+    size_t emigrants = 0;
+    size_t immigrants = 0;
+    FitnessValue best_fitness = std::numeric_limits< FitnessValue >::infinity();
+    double mean_fitness = std::numeric_limits< double >::infinity();
+};
+
+
+namespace detail {
+
+// The state of one island. The rng depends only on the seed and the island index, such that islands in threads and
+// islands in separate processes evolve identically.
+template< typename Population , typename Fitness , typename Rng >
+struct island
+{
+    using population_type = Population;
+    using fitness_type = Fitness;
+    using fitness_value_type = typename fitness_type::value_type;
+    using rng_type = Rng;
+    using pipeline_type = dynamic_pipeline< population_type , fitness_type , rng_type >;
+    using statistics_type = island_statistics< fitness_value_type >;
+
+    island( std::uint64_t seed , size_t index , size_t number_elite )
+    : rng() , pipeline( rng , number_elite ) , pop() , fitness() , stats()
+    {
+        std::seed_seq seq { std::uint32_t( seed ) , std::uint32_t( seed >> 32 ) , std::uint32_t( index ) };
+        rng.seed( seq );
+    }
+
+    island( island const& ) = delete;
+    island& operator=( island const& ) = delete;
+
+    template< typename Evaluator >
+    void evaluate( Evaluator& eval )
+    {
+        fitness.resize( pop.size() );
+        double sum = 0.0;
+        size_t count = 0;
+        stats.best_fitness = std::numeric_limits< fitness_value_type >::infinity();
+        for( size_t j=0 ; j<pop.size() ; ++j )
+        {
+            fitness[j] = eval( pop[j] );
+            if( std::isfinite( fitness[j] ) )
+            {
+                sum += fitness[j];
+                ++count;
+                stats.best_fitness = std::min( stats.best_fitness , fitness[j] );
+            }
+        }
+        stats.evaluations += pop.size();
+        stats.mean_fitness = ( count > 0 ) ? sum / double( count ) : std::numeric_limits< double >::infinity();
+    }
+
+    rng_type rng;
+    pipeline_type pipeline;
+    population_type pop;
+    fitness_type fitness;
+    statistics_type stats;
+};
+
+
+} // namespace detail
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_DETAIL_ISLAND_HPP_INCLUDED
@@ -0,0 +1,83 @@
+/*
+ * gpcxx/evolve/double_buffered_population.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_DOUBLE_BUFFERED_POPULATION_HPP_INCLUDED
+#define GPCXX_EVOLVE_DOUBLE_BUFFERED_POPULATION_HPP_INCLUDED
+
+#include <cstddef>
+#include <utility>
+
+
+namespace gpcxx {
+
+
+/**
+ * Two population buffers of equal size. The pipelines read the parents from current() and assign the offspring to
+ * the slots of next(), afterwards the buffers are swapped. Neither the population storage nor, with a recycling
+ * allocator, the tree nodes are reallocated from generation to generation.
+ */
+template< typename Population >
+class double_buffered_population
+{
+public:
+
+    using population_type = Population;
+    using value_type = typename population_type::value_type;
+
+    double_buffered_population( void )
+    : m_buffers() , m_current( 0 ) { }
+
+    explicit double_buffered_population( population_type pop )
+    : m_buffers() , m_current( 0 )
+    {
+        m_buffers[1].resize( pop.size() );
+        m_buffers[0] = std::move( pop );
+    }
+
+    explicit double_buffered_population( size_t n )
+    : m_buffers() , m_current( 0 )
+    {
+        resize( n );
+    }
+
+    void resize( size_t n )
+    {
+        m_buffers[0].resize( n );
+        m_buffers[1].resize( n );
+    }
+
+    size_t size( void ) const { return current().size(); }
+
+    population_type& current( void ) { return m_buffers[ m_current ]; }
+    population_type const& current( void ) const { return m_buffers[ m_current ]; }
+    population_type& next( void ) { return m_buffers[ 1 - m_current ]; }
+    population_type const& next( void ) const { return m_buffers[ 1 - m_current ]; }
+
+    value_type& operator[]( size_t i ) { return current()[i]; }
+    value_type const& operator[]( size_t i ) const { return current()[i]; }
+
+    /// Makes next() the current population. The old individuals stay in the buffer and are overwritten later.
+    void swap_buffers( void )
+    {
+        m_current = 1 - m_current;
+    }
+
+private:
+
+    population_type m_buffers[2];
+    size_t m_current;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_DOUBLE_BUFFERED_POPULATION_HPP_INCLUDED
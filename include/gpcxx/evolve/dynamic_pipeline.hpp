@@ -12,7 +12,10 @@
 #ifndef GPCXX_EVOLVE_DYNAMIC_PIPELINE_HPP_INCLUDED
 #define GPCXX_EVOLVE_DYNAMIC_PIPELINE_HPP_INCLUDED
 
+#include <gpcxx/evolve/double_buffered_population.hpp>
+#include <gpcxx/evolve/lineage_table.hpp>
 #include <gpcxx/operator/any_genetic_operator.hpp>
+#include <gpcxx/util/rank_cache.hpp>
 #include <gpcxx/util/sort_indices.hpp>
 #include <gpcxx/util/assert.hpp>
 
@@ -36,6 +39,7 @@ public:
     using genetic_operator_type = any_genetic_operator< population_type , fitness_type >;
     using index_vector = std::vector< size_t >;
     using operator_observer_type = std::function< void( int , index_vector const& , index_vector const& ) >;
+    using lineage_observer_type = std::function< void( lineage_table const& ) >;
     using final_transform_type = std::function< void( individual_type& ) >; // TODO: Find a better name
 
 
@@ -43,12 +47,14 @@ public:
         rng_type &rng ,
         size_t number_elite ,
         final_transform_type final_transform = []( auto& x ) {} ,
-        operator_observer_type op = []( int choice , index_vector const& in , index_vector const& out ) {} )
+        operator_observer_type op = operator_observer_type() )
         : m_rng( rng )
         , m_number_elite( number_elite ) 
         , m_rates() , m_operators()
         , m_final_transform( std::move( final_transform ) )
         , m_observer( std::move( op ) )
+        , m_lineage_observer()
+        , m_ranks() , m_in() , m_out() , m_lineage() , m_selection_epoch( 0 )
     { }
     
     void add_operator( genetic_operator_type const& op , double rate )
@@ -58,72 +64,119 @@ public:
         m_rates.push_back( rate / double( op.arity() ) );
     }
     
+    /// Called for every elite and every operator application. Leave it empty to skip the index bookkeeping.
     operator_observer_type& operator_observer( void )
     {
         return m_observer;
     }
     
-    genetic_operator_type const& operator_observer( void ) const
+    operator_observer_type const& operator_observer( void ) const
     {
         return m_observer;
     }
+    
+    /// Ranking of the current fitness. It is invalidated by next_generation. Rank the newly evaluated population through
+    /// it, e.g. with best_individuals, and the elitism of the next generation reuses the ranking.
+    rank_cache& ranks( void )
+    {
+        return m_ranks;
+    }
+
+    /// Incremented whenever the population handed to the selection changes. Pass it to set_epoch() of selectors which
+    /// draw batches, e.g. batched_tournament_selector, so that every generation draws a new batch.
+    size_t const& selection_epoch( void ) const
+    {
+        return m_selection_epoch;
+    }
+    
+    /// Called once per generation with the lineage of the whole generation.
+    lineage_observer_type& lineage_observer( void )
+    {
+        return m_lineage_observer;
+    }
+    
+    lineage_observer_type const& lineage_observer( void ) const
+    {
+        return m_lineage_observer;
+    }
 
     void next_generation( population_type &pop , fitness_type &fitness )
     {
-        reproduce( pop , fitness );
+        population_type new_pop( pop.size() );
+        reproduce( pop , fitness , new_pop );
+        pop = std::move( new_pop );
+    }
+
+    /// Writes the offspring into the slots of pop.next() and swaps the buffers.
+    void next_generation( double_buffered_population< population_type > &pop , fitness_type &fitness )
+    {
+        reproduce( pop.current() , fitness , pop.next() );
+        pop.swap_buffers();
     }
 
 private:
 
 
-    void reproduce( population_type& pop , fitness_type& fitness )
+    void reproduce( population_type const& pop , fitness_type& fitness , population_type& new_pop )
     {
         GPCXX_ASSERT( pop.size() == fitness.size() );
+        GPCXX_ASSERT( new_pop.size() == pop.size() );
         GPCXX_ASSERT( m_rates.size() == m_operators.size() );
         GPCXX_ASSERT( m_operators.size() > 0 );
 
-        std::vector< size_t > indices;
-        sort_indices( fitness , indices );
+        ++m_selection_epoch;
+        auto elite = m_ranks.best( fitness , size_t( m_number_elite ) );
  
-        population_type new_pop;
-        new_pop.reserve( pop.size() );
+        size_t n = pop.size();
+        size_t count = 0;
+        bool const observe = static_cast< bool >( m_observer );
+        bool const record = static_cast< bool >( m_lineage_observer );
+        if( record ) m_lineage.clear();
  
         // elite
-        for( size_t i=0 ; i<m_number_elite ; ++i )
+        for( size_t index : elite )
         {
-            index_vector elite_in_indices;
-            index_vector elite_out_indices;
-            size_t index = indices[i] ;
-            elite_in_indices.push_back( index );
-            elite_out_indices.push_back( new_pop.size() );
-            new_pop.push_back( pop[ index ] );
-            m_observer( -1 , elite_in_indices , elite_out_indices );
+            if( record ) m_lineage.add( -1 , &index , &index + 1 , count , 1 );
+            if( observe )
+            {
+                m_in.assign( 1 , index );
+                m_out.assign( 1 , count );
+            }
+            new_pop[ count++ ] = pop[ index ];
+            if( observe ) m_observer( -1 , m_in , m_out );
         }
 
 
-        size_t n = pop.size();
         std::discrete_distribution< int > dist( m_rates.begin() , m_rates.end() );
-        while( new_pop.size() < n )
+        while( count < n )
         {
             int choice = dist( m_rng );
             auto& op = m_operators[ choice ];
             
             auto selection = op.selection( pop , fitness );
-            index_vector in;
-            for( auto s : selection ) in.push_back( s - pop.begin() );
-            
-            auto trees = op.operation( selection );
-            index_vector out;
-            for( auto iter = trees.begin() ; ( iter != trees.end() ) && ( new_pop.size() < n ) ; ++iter )
+            auto first = new_pop.begin() + count;
+            auto last = op.operation( selection , first , new_pop.end() );
+            GPCXX_ASSERT( last != first );
+            size_t first_child = count;
+            for( ; first != last ; ++first , ++count )
+                m_final_transform( *first );
+
+            if( observe || record )
             {
-                out.push_back( new_pop.size() );
-                m_final_transform( *iter );
-                new_pop.push_back( std::move( *iter ) );
+                m_in.clear();
+                for( auto s : selection ) m_in.push_back( s - pop.begin() );
+                if( record ) m_lineage.add( choice , m_in.begin() , m_in.end() , first_child , count - first_child );
+                if( observe )
+                {
+                    m_out.clear();
+                    for( size_t i=first_child ; i<count ; ++i ) m_out.push_back( i );
+                    m_observer( choice , m_in , m_out );
+                }
             }
-            m_observer( choice , in , out );
         }
         
-        pop = std::move( new_pop );
+        if( record ) m_lineage_observer( m_lineage );
+        m_ranks.invalidate();
     }
 
     rng_type& m_rng;
@@ -132,6 +185,12 @@ private:
     std::vector< genetic_operator_type > m_operators;
     final_transform_type m_final_transform;
     operator_observer_type m_observer;
+    lineage_observer_type m_lineage_observer;
+    rank_cache m_ranks;
+    index_vector m_in;
+    index_vector m_out;
+    lineage_table m_lineage;
+    size_t m_selection_epoch;
 };
 
 
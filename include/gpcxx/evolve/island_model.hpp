@@ -0,0 +1,293 @@
+/*
+ * gpcxx/evolve/island_model.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_ISLAND_MODEL_HPP_INCLUDED
+#define GPCXX_EVOLVE_ISLAND_MODEL_HPP_INCLUDED
+
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/evolve/detail/island.hpp>
+#include <gpcxx/util/sort_indices.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/// Every island sends its migrants to the next island.
+inline island_topology make_ring_topology( size_t number_of_islands )
+{
+    island_topology topology( number_of_islands );
+    if( number_of_islands > 1 )
+        for( size_t i=0 ; i<number_of_islands ; ++i )
+            topology[i].push_back( ( i + 1 ) % number_of_islands );
+    return topology;
+}
+
+/// The islands are arranged on a rows x cols torus, every island sends its migrants to its four neighbours.
+inline island_topology make_torus_topology( size_t rows , size_t cols )
+{
+    island_topology topology( rows * cols );
+    for( size_t r=0 ; r<rows ; ++r )
+    {
+        for( size_t c=0 ; c<cols ; ++c )
+        {
+            size_t i = r * cols + c;
+            auto& dest = topology[i];
+            dest.push_back( ( ( r + rows - 1 ) % rows ) * cols + c );
+            dest.push_back( ( ( r + 1 ) % rows ) * cols + c );
+            dest.push_back( r * cols + ( c + cols - 1 ) % cols );
+            dest.push_back( r * cols + ( c + 1 ) % cols );
+            std::sort( dest.begin() , dest.end() );
+            dest.erase( std::unique( dest.begin() , dest.end() ) , dest.end() );
+            dest.erase( std::remove( dest.begin() , dest.end() , i ) , dest.end() );
+        }
+    }
+    return topology;
+}
+
+
+/**
+ * Island model: Every island owns a population, a rng and a dynamic_pipeline and evolves in its own thread. Every
+ * migration_interval generations each island sends copies of its best number_of_migrants individuals to its neighbours
+ * in the topology. The migrants replace the worst individuals of the receiving island.
+ *
+ * Migrants are exchanged by lock-free single producer single consumer queues, one for every edge of the topology. An
+ * island always waits for the complete batch of every incoming edge, hence a run only depends on the seed and not on
+ * the scheduling of the threads.
+ *
+ * The evaluator is called concurrently from all islands and must be thread safe.
+ */
+template< typename Population , typename Fitness , typename Rng = std::mt19937 >
+class island_model
+{
+public:
+
+    using population_type = Population;
+    using individual_type = typename population_type::value_type;
+    using fitness_type = Fitness;
+    using fitness_value_type = typename fitness_type::value_type;
+    using rng_type = Rng;
+    using pipeline_type = dynamic_pipeline< population_type , fitness_type , rng_type >;
+    using statistics_type = island_statistics< fitness_value_type >;
+
+    island_model(
+        size_t number_of_islands ,
+        size_t number_elite ,
+        island_topology topology ,
+        size_t migration_interval ,
+        size_t number_of_migrants ,
+        std::uint64_t seed )
+    : m_islands() , m_topology( std::move( topology ) ) , m_incoming( number_of_islands ) , m_mailboxes()
+    , m_migration_interval( migration_interval ) , m_number_of_migrants( number_of_migrants )
+    , m_generation( 0 ) , m_abort( false )
+    {
+        GPCXX_ASSERT( m_topology.size() == number_of_islands );
+        GPCXX_ASSERT( migration_interval > 0 );
+
+        for( size_t i=0 ; i<number_of_islands ; ++i )
+            m_islands.emplace_back( new island( seed , i , number_elite ) );
+
+        // one queue for every edge, it can hold two batches such that a sender can be one migration ahead
+        for( size_t from=0 ; from<number_of_islands ; ++from )
+        {
+            m_mailboxes.emplace_back();
+            for( size_t to : m_topology[from] )
+            {
+                GPCXX_ASSERT( to < number_of_islands );
+                m_incoming[to].push_back( from );
+                m_mailboxes[from].emplace_back( new mailbox_type( 2 * std::max( number_of_migrants , size_t( 1 ) ) ) );
+            }
+        }
+    }
+
+    size_t size( void ) const { return m_islands.size(); }
+    size_t generation( void ) const { return m_generation; }
+    island_topology const& topology( void ) const { return m_topology; }
+
+    rng_type& rng( size_t i ) { return m_islands[i]->rng; }
+    pipeline_type& pipeline( size_t i ) { return m_islands[i]->pipeline; }
+    population_type& population( size_t i ) { return m_islands[i]->pop; }
+    population_type const& population( size_t i ) const { return m_islands[i]->pop; }
+    fitness_type& fitness( size_t i ) { return m_islands[i]->fitness; }
+    fitness_type const& fitness( size_t i ) const { return m_islands[i]->fitness; }
+    statistics_type const& statistics( size_t i ) const { return m_islands[i]->stats; }
+
+
+    /// Calls f( island_index , rng , pipeline ) for every island, typically to add the operators.
+    template< typename Setup >
+    void setup( Setup f )
+    {
+        for( size_t i=0 ; i<m_islands.size() ; ++i )
+            f( i , m_islands[i]->rng , m_islands[i]->pipeline );
+    }
+
+    /// Calls init( island_index , rng , population ) in parallel and evaluates the initial populations.
+    template< typename Init , typename Evaluator >
+    void initialize( Init init , Evaluator eval )
+    {
+        parallel( [&]( size_t i ) {
+            island& isl = *m_islands[i];
+            init( i , isl.rng , isl.pop );
+            isl.evaluate( eval );
+        } );
+    }
+
+    /// Evolves all islands by the given number of generations.
+    template< typename Evaluator >
+    void run( size_t generations , Evaluator eval )
+    {
+        size_t first = m_generation;
+        parallel( [&]( size_t i ) {
+            island& isl = *m_islands[i];
+            for( size_t g=first+1 ; g<=first+generations ; ++g )
+            {
+                isl.pipeline.next_generation( isl.pop , isl.fitness );
+                isl.evaluate( eval );
+                ++isl.stats.generations;
+                if( ( g % m_migration_interval == 0 ) && ( m_number_of_migrants > 0 ) )
+                    migrate( i );
+            }
+        } );
+        m_generation += generations;
+    }
+
+    /// Returns ( island , index ) of the best individual of all islands.
+    std::pair< size_t , size_t > best( void ) const
+    {
+        std::pair< size_t , size_t > b( 0 , 0 );
+        fitness_value_type best_value = std::numeric_limits< fitness_value_type >::infinity();
+        for( size_t i=0 ; i<m_islands.size() ; ++i )
+        {
+            auto const& fitness = m_islands[i]->fitness;
+            for( size_t j=0 ; j<fitness.size() ; ++j )
+                if( fitness[j] < best_value ) { best_value = fitness[j]; b = std::make_pair( i , j ); }
+        }
+        return b;
+    }
+
+private:
+
+    using migrant_type = std::pair< individual_type , fitness_value_type >;
+    using mailbox_type = boost::lockfree::spsc_queue< migrant_type >;
+
+    using island = detail::island< population_type , fitness_type , rng_type >;
+
+    // thrown inside an island thread if another island failed
+    struct aborted { };
+
+    void migrate( size_t i )
+    {
+        island& isl = *m_islands[i];
+        std::vector< size_t > indices;
+        sort_indices( isl.fitness , indices );
+
+        // send
+        size_t n = std::min( m_number_of_migrants , isl.pop.size() );
+        for( auto& mb : m_mailboxes[i] )
+        {
+            for( size_t j=0 ; j<n ; ++j )
+            {
+                migrant_type m( isl.pop[ indices[j] ] , isl.fitness[ indices[j] ] );
+                while( ! mb->push( m ) ) wait();
+            }
+            isl.stats.emigrants += n;
+        }
+
+        // receive, the worst individuals are replaced
+        auto worst = indices.rbegin();
+        for( size_t from : m_incoming[i] )
+        {
+            size_t m = std::min( m_number_of_migrants , m_islands[from]->pop.size() );
+            auto& mb = *m_mailboxes[from][ edge_index( from , i ) ];
+            for( size_t j=0 ; j<m ; ++j )
+            {
+                migrant_type migrant;
+                while( ! mb.pop( migrant ) ) wait();
+                if( worst == indices.rend() ) continue;
+                isl.pop[ *worst ] = std::move( migrant.first );
+                isl.fitness[ *worst ] = migrant.second;
+                ++worst;
+                ++isl.stats.immigrants;
+            }
+        }
+    }
+
+    size_t edge_index( size_t from , size_t to ) const
+    {
+        auto const& dest = m_topology[from];
+        return std::find( dest.begin() , dest.end() , to ) - dest.begin();
+    }
+
+    void wait( void ) const
+    {
+        if( m_abort.load( std::memory_order_relaxed ) ) throw aborted();
+        std::this_thread::yield();
+    }
+
+    template< typename F >
+    void parallel( F f )
+    {
+        m_abort = false;
+        std::vector< std::exception_ptr > errors( m_islands.size() );
+        std::vector< std::thread > threads;
+        for( size_t i=0 ; i<m_islands.size() ; ++i )
+        {
+            threads.emplace_back( [this,i,&f,&errors]() {
+                try { f( i ); }
+                catch( aborted const& ) { }
+                catch( ... )
+                {
+                    errors[i] = std::current_exception();
+                    m_abort = true;
+                } } );
+        }
+        for( auto& t : threads ) t.join();
+        for( auto& e : errors )
+        {
+            if( e )
+            {
+                // migrants of the interrupted migration would be received in the next run
+                for( auto& mbs : m_mailboxes )
+                    for( auto& mb : mbs ) mb->consume_all( []( migrant_type const& ) {} );
+                std::rethrow_exception( e );
+            }
+        }
+    }
+
+    std::vector< std::unique_ptr< island > > m_islands;
+    island_topology m_topology;
+    island_topology m_incoming;
+    std::vector< std::vector< std::unique_ptr< mailbox_type > > > m_mailboxes;
+    size_t m_migration_interval;
+    size_t m_number_of_migrants;
+    size_t m_generation;
+    std::atomic< bool > m_abort;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_ISLAND_MODEL_HPP_INCLUDED
@@ -0,0 +1,87 @@
+/*
+ * gpcxx/evolve/lineage_table.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_LINEAGE_TABLE_HPP_INCLUDED
+#define GPCXX_EVOLVE_LINEAGE_TABLE_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Lineage of one generation. Every record describes one operator application: the index of the operator (-1 for the
+ * elite), the indices of its parents in the old population and the contiguous range of its children in the new
+ * population. clear() keeps the capacity, hence the table does not allocate once it has been filled.
+ */
+class lineage_table
+{
+public:
+
+    using index_range = boost::iterator_range< std::vector< size_t >::const_iterator >;
+
+    struct record
+    {
+        int choice;
+        size_t first_parent;
+        size_t number_of_parents;
+        size_t first_child;
+        size_t number_of_children;
+    };
+
+    lineage_table( void ) : m_records() , m_parents() { }
+
+    void clear( void )
+    {
+        m_records.clear();
+        m_parents.clear();
+    }
+
+    template< typename ParentIter >
+    void add( int choice , ParentIter parents_first , ParentIter parents_last , size_t first_child , size_t number_of_children )
+    {
+        size_t first_parent = m_parents.size();
+        m_parents.insert( m_parents.end() , parents_first , parents_last );
+        m_records.push_back( record { choice , first_parent , m_parents.size() - first_parent , first_child , number_of_children } );
+    }
+
+    size_t size( void ) const { return m_records.size(); }
+    bool empty( void ) const { return m_records.empty(); }
+
+    record const& operator[]( size_t i ) const { return m_records[i]; }
+
+    std::vector< record >::const_iterator begin( void ) const { return m_records.begin(); }
+    std::vector< record >::const_iterator end( void ) const { return m_records.end(); }
+
+    index_range parents( record const& r ) const
+    {
+        GPCXX_ASSERT( r.first_parent + r.number_of_parents <= m_parents.size() );
+        auto first = m_parents.begin() + r.first_parent;
+        return index_range( first , first + r.number_of_parents );
+    }
+
+private:
+
+    std::vector< record > m_records;
+    std::vector< size_t > m_parents;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_LINEAGE_TABLE_HPP_INCLUDED
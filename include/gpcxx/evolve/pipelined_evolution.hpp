@@ -0,0 +1,347 @@
+/*
+ * gpcxx/evolve/pipelined_evolution.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_PIPELINED_EVOLUTION_HPP_INCLUDED
+#define GPCXX_EVOLVE_PIPELINED_EVOLUTION_HPP_INCLUDED
+
+#include <gpcxx/operator/any_genetic_operator.hpp>
+#include <gpcxx/util/rank_cache.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Generational evolution where breeding and evaluation overlap. Every generation is cut into chunks of chunk_size
+ * individuals. A chunk is submitted to a bounded queue as soon as it is bred and evaluated by a pool of worker
+ * threads, while the calling thread goes on breeding. If the queue is full or the breeder has to wait for fitness
+ * values, the calling thread evaluates queued chunks itself, hence number_of_threads threads are busy in total.
+ *
+ * The next generation is bred as soon as the fraction min_evaluated of the current generation is evaluated. Parents
+ * are selected only from the evaluated part of the generation, which grows while the next generation is bred. With
+ * min_evaluated = 1 the whole generation is evaluated before the selection starts, then a run depends only on the rng
+ * and not on the scheduling of the threads.
+ *
+ * The evaluator is copied for every thread and is called concurrently.
+ */
+template< typename Population , typename Fitness , typename Rng >
+class pipelined_evolution
+{
+public:
+
+    using population_type = Population;
+    using individual_type = typename population_type::value_type;
+    using fitness_type = Fitness;
+    using rng_type = Rng;
+    using genetic_operator_type = any_genetic_operator< population_type , fitness_type >;
+    using generation_observer_type = std::function< void( size_t , population_type const& , fitness_type const& ) >;
+
+    pipelined_evolution(
+        rng_type& rng ,
+        size_t number_elite ,
+        size_t number_of_threads ,
+        double min_evaluated = 1.0 ,
+        size_t chunk_size = 64 ,
+        size_t queue_capacity = 16 )
+    : m_rng( rng ) , m_number_elite( number_elite ) , m_number_of_threads( std::max< size_t >( number_of_threads , 1 ) )
+    , m_min_evaluated( min_evaluated ) , m_chunk_size( std::max< size_t >( chunk_size , 1 ) )
+    , m_queue_capacity( std::max< size_t >( queue_capacity , 1 ) )
+    , m_rates() , m_operators() , m_observer() , m_ranks()
+    , m_selection_epoch( 0 )
+    , m_mutex() , m_work() , m_progress() , m_tasks() , m_stop( false ) , m_error()
+    {
+        GPCXX_ASSERT( ( min_evaluated > 0.0 ) && ( min_evaluated <= 1.0 ) );
+    }
+
+    void add_operator( genetic_operator_type const& op , double rate )
+    {
+        GPCXX_ASSERT( op.arity() > 0 );
+        m_operators.push_back( op );
+        m_rates.push_back( rate / double( op.arity() ) );
+    }
+
+    /// Called for every new generation as soon as it is completely evaluated.
+    generation_observer_type& generation_observer( void )
+    {
+        return m_observer;
+    }
+
+    generation_observer_type const& generation_observer( void ) const
+    {
+        return m_observer;
+    }
+
+    size_t number_of_threads( void ) const { return m_number_of_threads; }
+    double min_evaluated( void ) const { return m_min_evaluated; }
+    size_t chunk_size( void ) const { return m_chunk_size; }
+    size_t queue_capacity( void ) const { return m_queue_capacity; }
+
+    /// Incremented whenever individuals are added to the parents or a new generation of parents starts. Pass it to
+    /// set_epoch() of selectors which draw batches, e.g. batched_tournament_selector.
+    size_t const& selection_epoch( void ) const { return m_selection_epoch; }
+
+    /// Breeds the given number of generations from the evaluated population pop. On return pop holds the last
+    /// generation and fitness its fitness values.
+    template< typename Evaluator >
+    void evolve( population_type& pop , fitness_type& fitness , size_t generations , Evaluator const& evaluator )
+    {
+        GPCXX_ASSERT( pop.size() == fitness.size() );
+        GPCXX_ASSERT( pop.size() > 0 );
+        GPCXX_ASSERT( m_rates.size() == m_operators.size() );
+        GPCXX_ASSERT( m_operators.size() > 0 );
+        if( generations == 0 ) return;
+
+        size_t n = pop.size();
+        size_t chunks = ( n + m_chunk_size - 1 ) / m_chunk_size;
+
+        generation_buffer buffers[2];
+        generation_buffer* current = &buffers[0];
+        generation_buffer* next = &buffers[1];
+        current->pop = std::move( pop );
+        current->fitness = std::move( fitness );
+        current->done.assign( chunks , 1 );
+        current->completed = chunks;
+        next->pop.resize( n );
+        next->fitness.resize( n );
+
+        population_type parents;
+        fitness_type parent_fitness;
+        parents.reserve( n );
+        parent_fitness.reserve( n );
+
+        m_tasks.clear();
+        m_stop = false;
+        m_error = std::exception_ptr();
+        workers< Evaluator > guard( *this , evaluator );
+        Evaluator local_evaluator( evaluator );
+
+        std::discrete_distribution< int > dist( m_rates.begin() , m_rates.end() );
+        size_t needed = std::min( n , size_t( std::ceil( m_min_evaluated * double( n ) ) ) );
+        for( size_t generation=1 ; generation<=generations ; ++generation )
+        {
+            next->done.assign( chunks , 0 );
+            next->completed = 0;
+
+            wait_for( *current , needed , local_evaluator );
+            parents.clear();
+            parent_fitness.clear();
+            ++m_selection_epoch;
+            absorb( *current , parents , parent_fitness );
+
+            // elite
+            size_t count = 0;
+            m_ranks.invalidate();
+            for( size_t index : m_ranks.best( parent_fitness , std::min( m_number_elite , n ) ) )
+                next->pop[ count++ ] = parents[ index ];
+
+            size_t submitted = 0;
+            while( count < n )
+            {
+                absorb( *current , parents , parent_fitness );
+
+                auto& op = m_operators[ dist( m_rng ) ];
+                auto selection = op.selection( parents , parent_fitness );
+                auto first = next->pop.begin() + count;
+                auto last = op.operation( selection , first , next->pop.end() );
+                GPCXX_ASSERT( last != first );
+                count = last - next->pop.begin();
+
+                for( ; ( submitted < chunks ) && ( std::min( ( submitted + 1 ) * m_chunk_size , n ) <= count ) ; ++submitted )
+                    submit( *next , submitted , local_evaluator );
+            }
+
+            // the rest of the current generation is evaluated before the chunks of the next one
+            wait_for( *current , n , local_evaluator );
+            absorb( *current , parents , parent_fitness );
+            if( ( generation > 1 ) && m_observer ) m_observer( generation - 1 , parents , parent_fitness );
+
+            std::swap( current , next );
+        }
+
+        wait_for( *current , n , local_evaluator );
+        pop = std::move( current->pop );
+        fitness = std::move( current->fitness );
+        if( m_observer ) m_observer( generations , pop , fitness );
+    }
+
+private:
+
+    struct generation_buffer
+    {
+        population_type pop;
+        fitness_type fitness;
+        std::vector< char > done;
+        size_t completed = 0;       // number of contiguous evaluated chunks
+    };
+
+    using task_type = std::pair< generation_buffer* , size_t >;
+
+    template< typename Evaluator >
+    struct workers
+    {
+        workers( pipelined_evolution& self , Evaluator const& evaluator ) : m_self( self ) , m_threads()
+        {
+            for( size_t i=1 ; i<self.m_number_of_threads ; ++i )
+                m_threads.emplace_back( [this,evaluator]() mutable { m_self.run_worker( evaluator ); } );
+        }
+
+        ~workers( void )
+        {
+            {
+                std::lock_guard< std::mutex > lock( m_self.m_mutex );
+                m_self.m_stop = true;
+            }
+            m_self.m_work.notify_all();
+            for( auto& t : m_threads ) t.join();
+        }
+
+        pipelined_evolution& m_self;
+        std::vector< std::thread > m_threads;
+    };
+
+    template< typename Evaluator >
+    void run_worker( Evaluator& evaluator )
+    {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        while( true )
+        {
+            m_work.wait( lock , [this]() { return m_stop || ( ! m_tasks.empty() ); } );
+            if( m_stop ) return;
+            run_task( lock , evaluator );
+        }
+    }
+
+    /// Takes the first task of the queue and evaluates it with the lock released.
+    template< typename Evaluator >
+    void run_task( std::unique_lock< std::mutex >& lock , Evaluator& evaluator )
+    {
+        task_type task = m_tasks.front();
+        m_tasks.pop_front();
+        lock.unlock();
+
+        generation_buffer& buffer = *task.first;
+        size_t first = task.second * m_chunk_size;
+        size_t last = std::min( first + m_chunk_size , buffer.pop.size() );
+        std::exception_ptr error;
+        try
+        {
+            for( size_t i=first ; i<last ; ++i )
+                buffer.fitness[i] = evaluator( buffer.pop[i] );
+        }
+        catch( ... )
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if( error )
+        {
+            if( ! m_error ) m_error = error;
+            m_stop = true;
+            m_work.notify_all();
+        }
+        buffer.done[ task.second ] = 1;
+        while( ( buffer.completed < buffer.done.size() ) && buffer.done[ buffer.completed ] ) ++buffer.completed;
+        m_progress.notify_all();
+    }
+
+    void check_error( void ) const
+    {
+        if( m_error ) std::rethrow_exception( m_error );
+    }
+
+    template< typename Evaluator >
+    void submit( generation_buffer& buffer , size_t chunk , Evaluator& evaluator )
+    {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        while( m_tasks.size() >= m_queue_capacity )
+        {
+            check_error();
+            run_task( lock , evaluator );
+        }
+        check_error();
+        m_tasks.emplace_back( &buffer , chunk );
+        m_work.notify_one();
+    }
+
+    size_t evaluated( generation_buffer const& buffer ) const
+    {
+        return std::min( buffer.completed * m_chunk_size , buffer.pop.size() );
+    }
+
+    template< typename Evaluator >
+    void wait_for( generation_buffer& buffer , size_t number , Evaluator& evaluator )
+    {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        while( evaluated( buffer ) < number )
+        {
+            check_error();
+            if( ! m_tasks.empty() ) run_task( lock , evaluator );
+            else m_progress.wait( lock );
+        }
+        check_error();
+    }
+
+    /// Moves the newly evaluated individuals of buffer to the parents. The evaluated individuals are a prefix of the
+    /// generation and are not accessed by the workers anymore.
+    void absorb( generation_buffer& buffer , population_type& parents , fitness_type& parent_fitness )
+    {
+        size_t last;
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            last = evaluated( buffer );
+        }
+        if( last > parents.size() ) ++m_selection_epoch;
+        for( size_t i=parents.size() ; i<last ; ++i )
+        {
+            parents.push_back( std::move( buffer.pop[i] ) );
+            parent_fitness.push_back( buffer.fitness[i] );
+        }
+    }
+
+    rng_type& m_rng;
+    size_t m_number_elite;
+    size_t m_number_of_threads;
+    double m_min_evaluated;
+    size_t m_chunk_size;
+    size_t m_queue_capacity;
+    std::vector< double > m_rates;
+    std::vector< genetic_operator_type > m_operators;
+    generation_observer_type m_observer;
+    rank_cache m_ranks;
+    size_t m_selection_epoch;
+
+    std::mutex m_mutex;
+    std::condition_variable m_work;
+    std::condition_variable m_progress;
+    std::deque< task_type > m_tasks;
+    bool m_stop;
+    std::exception_ptr m_error;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_PIPELINED_EVOLUTION_HPP_INCLUDED
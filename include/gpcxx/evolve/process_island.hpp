@@ -0,0 +1,242 @@
+/*
+ * gpcxx/evolve/process_island.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_PROCESS_ISLAND_HPP_INCLUDED
+#define GPCXX_EVOLVE_PROCESS_ISLAND_HPP_INCLUDED
+
+#include <gpcxx/evolve/detail/island.hpp>
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/util/shm_ring_buffer.hpp>
+#include <gpcxx/util/sort_indices.hpp>
+#include <gpcxx/util/identity.hpp>
+#include <gpcxx/util/exception.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/// Name of the shared memory channel for migrants from island from to island to.
+inline std::string migration_channel_name( std::string const& prefix , size_t from , size_t to )
+{
+    return prefix + "_" + std::to_string( from ) + "_" + std::to_string( to );
+}
+
+/// Creates the channels for all edges of the topology. Must be called before the island processes are started. The
+/// capacity must hold at least one migrant, see shm_ring_buffer::try_push.
+inline void create_migration_channels( std::string const& prefix , island_topology const& topology , size_t capacity )
+{
+    for( size_t from=0 ; from<topology.size() ; ++from )
+        for( size_t to : topology[from] )
+            shm_ring_buffer::create( migration_channel_name( prefix , from , to ) , capacity );
+}
+
+inline void remove_migration_channels( std::string const& prefix , island_topology const& topology )
+{
+    for( size_t from=0 ; from<topology.size() ; ++from )
+        for( size_t to : topology[from] )
+            shm_ring_buffer::unlink( migration_channel_name( prefix , from , to ) );
+}
+
+
+/**
+ * One island of an island model running in its own process. Migrants are serialized with write_binary together with
+ * their fitness and are exchanged through the shm_ring_buffer channels created by create_migration_channels.
+ *
+ * The migration scheme and the seeding are the same as in island_model, hence the processes of a topology evolve
+ * exactly like the threads of an island_model with the same parameters.
+ */
+template< typename Population , typename Fitness , typename Rng = std::mt19937 >
+class process_island
+{
+    using island_type = detail::island< Population , Fitness , Rng >;
+
+public:
+
+    using population_type = Population;
+    using individual_type = typename population_type::value_type;
+    using fitness_type = Fitness;
+    using fitness_value_type = typename fitness_type::value_type;
+    using rng_type = Rng;
+    using pipeline_type = dynamic_pipeline< population_type , fitness_type , rng_type >;
+    using statistics_type = island_statistics< fitness_value_type >;
+
+    process_island(
+        size_t index ,
+        size_t number_elite ,
+        island_topology const& topology ,
+        size_t migration_interval ,
+        size_t number_of_migrants ,
+        std::uint64_t seed ,
+        std::string const& channel_prefix ,
+        std::chrono::milliseconds timeout = std::chrono::seconds( 60 ) )
+    : m_index( index ) , m_island( seed , index , number_elite ) , m_outgoing() , m_incoming()
+    , m_migration_interval( migration_interval ) , m_number_of_migrants( number_of_migrants )
+    , m_generation( 0 ) , m_timeout( timeout )
+    {
+        GPCXX_ASSERT( index < topology.size() );
+        GPCXX_ASSERT( migration_interval > 0 );
+
+        for( size_t to : topology[index] )
+            m_outgoing.push_back( shm_ring_buffer::open( migration_channel_name( channel_prefix , index , to ) ) );
+        for( size_t from=0 ; from<topology.size() ; ++from )
+            for( size_t to : topology[from] )
+                if( to == index )
+                    m_incoming.push_back( shm_ring_buffer::open( migration_channel_name( channel_prefix , from , index ) ) );
+    }
+
+    size_t index( void ) const { return m_index; }
+    size_t generation( void ) const { return m_generation; }
+    rng_type& rng( void ) { return m_island.rng; }
+    pipeline_type& pipeline( void ) { return m_island.pipeline; }
+    population_type& population( void ) { return m_island.pop; }
+    population_type const& population( void ) const { return m_island.pop; }
+    fitness_type& fitness( void ) { return m_island.fitness; }
+    fitness_type const& fitness( void ) const { return m_island.fitness; }
+    statistics_type const& statistics( void ) const { return m_island.stats; }
+
+
+    /// Calls init( index , rng , population ) and evaluates the initial population.
+    template< typename Init , typename Evaluator >
+    void initialize( Init init , Evaluator eval )
+    {
+        init( m_index , m_island.rng , m_island.pop );
+        m_island.evaluate( eval );
+    }
+
+    /**
+     * Evolves the island by the given number of generations. symbol_mapper writes the symbols of the emigrants as in
+     * polish, node_mapper maps the symbols of the immigrants to ( arity , node generator ) as in read_polish.
+     */
+    template< typename Evaluator , typename NodeMapper , typename SymbolMapper = gpcxx::identity >
+    void run( size_t generations , Evaluator eval , NodeMapper const& node_mapper , SymbolMapper const& symbol_mapper = SymbolMapper() )
+    {
+        for( size_t g=0 ; g<generations ; ++g )
+        {
+            m_island.pipeline.next_generation( m_island.pop , m_island.fitness );
+            m_island.evaluate( eval );
+            ++m_island.stats.generations;
+            ++m_generation;
+            if( ( m_generation % m_migration_interval == 0 ) && ( m_number_of_migrants > 0 ) )
+                migrate( node_mapper , symbol_mapper );
+        }
+    }
+
+private:
+
+    // Sends and receives are interleaved, hence a channel only needs to hold a single message and the islands of a
+    // ring do not block each other if the migrants do not fit into the channels at once. The immigrants are collected
+    // first and replace the worst individuals in the order of the incoming channels, independent of their arrival.
+    template< typename NodeMapper , typename SymbolMapper >
+    void migrate( NodeMapper const& node_mapper , SymbolMapper const& symbol_mapper )
+    {
+        auto& pop = m_island.pop;
+        auto& fitness = m_island.fitness;
+        size_t const n = m_number_of_migrants;
+        GPCXX_ASSERT( pop.size() >= n );
+        std::vector< size_t > indices;
+        sort_indices( fitness , indices );
+
+        // a message is the raw fitness value followed by the binary tree
+        m_emigrants.resize( n );
+        for( size_t j=0 ; j<n ; ++j )
+        {
+            fitness_value_type value = fitness[ indices[j] ];
+            m_emigrants[j].assign( reinterpret_cast< char const* >( &value ) , sizeof( value ) );
+            write_binary( m_emigrants[j] , pop[ indices[j] ] , symbol_mapper );
+        }
+
+        std::vector< size_t > sent( m_outgoing.size() , 0 );
+        m_immigrants.resize( m_incoming.size() );
+        for( auto& msgs : m_immigrants ) msgs.clear();
+
+        auto start = std::chrono::steady_clock::now();
+        size_t pending = ( m_outgoing.size() + m_incoming.size() ) * n;
+        std::string msg;
+        while( pending > 0 )
+        {
+            bool progress = false;
+            for( size_t c=0 ; c<m_outgoing.size() ; ++c )
+            {
+                if( ( sent[c] < n ) && m_outgoing[c].try_push( m_emigrants[ sent[c] ] ) )
+                {
+                    ++sent[c];
+                    --pending;
+                    progress = true;
+                }
+            }
+            for( size_t c=0 ; c<m_incoming.size() ; ++c )
+            {
+                if( ( m_immigrants[c].size() < n ) && m_incoming[c].try_pop( msg ) )
+                {
+                    if( msg.size() < sizeof( fitness_value_type ) )
+                        throw gpcxx_exception( "Invalid migrant in " + m_incoming[c].name() + "." );
+                    m_immigrants[c].push_back( msg );
+                    --pending;
+                    progress = true;
+                }
+            }
+            if( progress )
+            {
+                start = std::chrono::steady_clock::now();
+            }
+            else
+            {
+                if( std::chrono::steady_clock::now() - start > m_timeout )
+                    throw gpcxx_exception( "Timeout while waiting for the migration channels of island " + std::to_string( m_index ) + "." );
+                std::this_thread::yield();
+            }
+        }
+        m_island.stats.emigrants += n * m_outgoing.size();
+
+        // the worst individuals are replaced
+        auto worst = indices.rbegin();
+        for( auto const& msgs : m_immigrants )
+        {
+            for( auto const& m : msgs )
+            {
+                if( worst == indices.rend() ) break;
+                fitness_value_type value;
+                std::memcpy( &value , m.data() , sizeof( value ) );
+                individual_type ind;
+                read_binary( m.data() + sizeof( value ) , m.data() + m.size() , ind , node_mapper );
+                pop[ *worst ] = std::move( ind );
+                fitness[ *worst ] = value;
+                ++worst;
+                ++m_island.stats.immigrants;
+            }
+        }
+    }
+
+    size_t m_index;
+    island_type m_island;
+    std::vector< shm_ring_buffer > m_outgoing;
+    std::vector< shm_ring_buffer > m_incoming;
+    size_t m_migration_interval;
+    size_t m_number_of_migrants;
+    size_t m_generation;
+    std::chrono::milliseconds m_timeout;
+    std::vector< std::string > m_emigrants;
+    std::vector< std::vector< std::string > > m_immigrants;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_PROCESS_ISLAND_HPP_INCLUDED
@@ -12,6 +12,8 @@
 #ifndef GPCXX_EVOLVE_STATIC_PIPELINE_HPP_DEFINED
 #define GPCXX_EVOLVE_STATIC_PIPELINE_HPP_DEFINED
 
+#include <gpcxx/evolve/double_buffered_population.hpp>
+#include <gpcxx/util/rank_cache.hpp>
 #include <gpcxx/util/sort_indices.hpp>
 #include <gpcxx/util/assert.hpp>
 
@@ -34,21 +36,43 @@ public:
     typedef Fitness fitness_type;
     typedef Rng rng_type;
 
-    typedef std::function< std::vector< individual_type >( population_type const& , fitness_type const& ) > mutation_type;
-    typedef std::function< std::vector< individual_type >( population_type const& , fitness_type const& ) > crossover_type;
-    typedef std::function< std::vector< individual_type >( population_type const& , fitness_type const& ) > reproduction_type;
+    typedef typename population_type::iterator slot_iterator;
+
+    // The operators assign their offspring to the slots [first,last) of the new population and return the end of the
+    // written range.
+    typedef std::function< slot_iterator( population_type const& , fitness_type const& , slot_iterator , slot_iterator ) > mutation_type;
+    typedef std::function< slot_iterator( population_type const& , fitness_type const& , slot_iterator , slot_iterator ) > crossover_type;
+    typedef std::function< slot_iterator( population_type const& , fitness_type const& , slot_iterator , slot_iterator ) > reproduction_type;
 
     static_pipeline( size_t number_elite , double mutation_rate , double crossover_rate , double reproduction_rate , rng_type &rng )
         : m_number_elite( number_elite ) , m_mutation_rate( mutation_rate ) , m_crossover_rate( crossover_rate ) , m_reproduction_rate( reproduction_rate )
         , m_rng( rng )
         , m_mutation_function() , m_crossover_function() , m_reproduction_function()
+        , m_ranks() , m_selection_epoch( 0 )
     { }
 
     void next_generation( population_type &pop , fitness_type &fitness )
     {
-        reproduce( pop , fitness );
+        population_type new_pop( pop.size() );
+        reproduce( pop , fitness , new_pop );
+        pop = std::move( new_pop );
     }
 
+    /// Writes the offspring into the slots of pop.next() and swaps the buffers.
+    void next_generation( double_buffered_population< population_type > &pop , fitness_type &fitness )
+    {
+        reproduce( pop.current() , fitness , pop.next() );
+        pop.swap_buffers();
+    }
+
+
+    /// Ranking of the current fitness. It is invalidated by next_generation. Rank the newly evaluated population through
+    /// it, e.g. with best_individuals, and the elitism of the next generation reuses the ranking.
+    rank_cache& ranks( void ) { return m_ranks; }
+
+    /// Incremented whenever the population handed to the selection changes. Pass it to set_epoch() of selectors which
+    /// draw batches, e.g. batched_tournament_selector, so that every generation draws a new batch.
+    size_t const& selection_epoch( void ) const { return m_selection_epoch; }
 
     mutation_type& mutation_function( void ) { return m_mutation_function; }
     crossover_type& crossover_function( void ) { return m_crossover_function; }
@@ -62,62 +86,46 @@ public:
 private:
 
 
-    void reproduce( population_type &pop , fitness_type &fitness )
+    void reproduce( population_type const& pop , fitness_type &fitness , population_type &new_pop )
     {
         GPCXX_ASSERT( pop.size() == fitness.size() );
+        GPCXX_ASSERT( new_pop.size() == pop.size() );
 
-        std::vector< size_t > indices;
-        sort_indices( fitness , indices );
+        ++m_selection_epoch;
+        auto elite = m_ranks.best( fitness , size_t( m_number_elite ) );
  
-        population_type new_pop;
+        size_t n = pop.size();
+        size_t count = 0;
  
         // elite
-        for( size_t i=0 ; i<m_number_elite ; ++i )
-        {
-            size_t index = indices[i] ;
-            new_pop.push_back( pop[ index ] );
-        }
+        for( size_t index : elite )
+            new_pop[ count++ ] = pop[ index ];
         
-        size_t n = pop.size();
         std::discrete_distribution< int > dist( { m_mutation_rate , m_crossover_rate , m_reproduction_rate } );
-        while( new_pop.size() < n )
+        while( count < n )
         {
             int choice = dist( m_rng );
+            auto first = new_pop.begin() + count;
+            auto last = first;
             switch( choice )
             {
                 case 0 : // mutation
-                {
-                    std::vector< individual_type > mutated_trees = m_mutation_function( pop , fitness );
-                    GPCXX_ASSERT( mutated_trees.size() == 1 );
-                    new_pop.push_back( std::move( mutated_trees[0] ) );
-                }
-                break;
+                    last = m_mutation_function( pop , fitness , first , new_pop.end() );
+                    GPCXX_ASSERT( last - first == 1 );
+                    break;
                 case 1 : // crossover
-                {
-                    std::vector< individual_type > trees = m_crossover_function( pop , fitness );
-                    GPCXX_ASSERT( trees.size() == 2 );
-                    if( new_pop.size() == ( n - 1 ) )
-                    {
-                        new_pop.push_back( std::move( trees[0] ) );
-                    }
-                    else
-                    {
-                        new_pop.push_back( std::move( trees[0] ) );
-                        new_pop.push_back( std::move( trees[1] ) );
-                    }
-                }
-                break;
+                    last = m_crossover_function( pop , fitness , first , new_pop.end() );
+                    GPCXX_ASSERT( ( last - first == 2 ) || ( last == new_pop.end() ) );
+                    break;
                 case 2 : // reproduction
-                {
-                    std::vector< individual_type > reproduced_nodes = m_reproduction_function( pop , fitness );
-                    GPCXX_ASSERT( reproduced_nodes.size() == 1 );
-                    new_pop.push_back( std::move( reproduced_nodes[0] ) );
-                }
-                break;
+                    last = m_reproduction_function( pop , fitness , first , new_pop.end() );
+                    GPCXX_ASSERT( last - first == 1 );
+                    break;
             }
+            GPCXX_ASSERT( last != first );
+            count = last - new_pop.begin();
         }
-        
-        pop = std::move( new_pop );
+        m_ranks.invalidate();
     }
 
     double m_number_elite;
@@ -128,6 +136,8 @@ private:
     mutation_type m_mutation_function;
     crossover_type m_crossover_function;
     reproduction_type m_reproduction_function;
+    rank_cache m_ranks;
+    size_t m_selection_epoch;
 };
 
 
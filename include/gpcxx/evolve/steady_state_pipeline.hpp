@@ -0,0 +1,192 @@
+/*
+ * gpcxx/evolve/steady_state_pipeline.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_EVOLVE_STEADY_STATE_PIPELINE_HPP_INCLUDED
+#define GPCXX_EVOLVE_STEADY_STATE_PIPELINE_HPP_INCLUDED
+
+#include <gpcxx/operator/any_genetic_operator.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <random>
+#include <vector>
+#include <functional>
+#include <utility>
+#include <cmath>
+
+
+namespace gpcxx {
+
+
+/**
+ * Steady state evolution: Parents are selected, one or two offspring are created and evaluated and they replace
+ * the losers of an inverse tournament directly in the population. No second population is ever created.
+ *
+ * breed() and insert() can be used separately, such that the evaluation can happen asynchronously in between.
+ */
+template< typename Population , typename Fitness , typename Rng >
+class steady_state_pipeline
+{
+public:
+
+    using population_type = Population;
+    using individual_type = typename population_type::value_type;
+    using fitness_type = Fitness;
+    using fitness_value_type = typename fitness_type::value_type;
+    using rng_type = Rng;
+    using genetic_operator_type = any_genetic_operator< population_type , fitness_type >;
+    using index_vector = std::vector< size_t >;
+    using operator_observer_type = std::function< void( int , index_vector const& , index_vector const& ) >;
+    using final_transform_type = std::function< void( individual_type& ) >;
+
+    struct offspring_type
+    {
+        int choice;
+        index_vector parents;
+        typename genetic_operator_type::value_vector_type individuals;
+    };
+
+
+    steady_state_pipeline(
+        rng_type &rng ,
+        size_t replacement_tournament_size ,
+        final_transform_type final_transform = []( auto& x ) {} ,
+        operator_observer_type op = operator_observer_type() )
+        : m_rng( rng )
+        , m_replacement_tournament_size( replacement_tournament_size )
+        , m_rates() , m_operators()
+        , m_final_transform( std::move( final_transform ) )
+        , m_observer( std::move( op ) )
+        , m_selection_epoch( 0 ) , m_out()
+    { }
+
+    void add_operator( genetic_operator_type const& op , double rate )
+    {
+        GPCXX_ASSERT( op.arity() > 0 );
+        m_operators.push_back( op );
+        m_rates.push_back( rate / double( op.arity() ) );
+        m_dist = std::discrete_distribution< int >( m_rates.begin() , m_rates.end() );
+    }
+
+    /// Called for every operator application with the indices of the parents and of the inserted offspring. Leave it
+    /// empty to skip the index bookkeeping. The observer is called after the insertion, hence a parent index may
+    /// already refer to one of the offspring.
+    operator_observer_type& operator_observer( void )
+    {
+        return m_observer;
+    }
+
+    operator_observer_type const& operator_observer( void ) const
+    {
+        return m_observer;
+    }
+
+    /// Incremented by every insert(). Pass it to set_epoch() of selectors which draw batches, e.g.
+    /// batched_tournament_selector, such that no winner refers to a replaced individual.
+    size_t const& selection_epoch( void ) const
+    {
+        return m_selection_epoch;
+    }
+
+
+    /// Selects parents and applies one randomly chosen operator. The offspring are already final transformed.
+    offspring_type breed( population_type const& pop , fitness_type const& fitness )
+    {
+        GPCXX_ASSERT( pop.size() == fitness.size() );
+        GPCXX_ASSERT( m_operators.size() > 0 );
+
+        offspring_type offspring;
+        offspring.choice = m_dist( m_rng );
+        auto& op = m_operators[ offspring.choice ];
+        auto selection = op.selection( pop , fitness );
+        for( auto s : selection ) offspring.parents.push_back( s - pop.begin() );
+        offspring.individuals = op.operation( selection );
+        for( auto& ind : offspring.individuals ) m_final_transform( ind );
+        return offspring;
+    }
+
+    /// Inverse tournament, returns the index of the worst out of replacement_tournament_size randomly drawn individuals.
+    size_t select_loser( fitness_type const& fitness )
+    {
+        GPCXX_ASSERT( fitness.size() > 0 );
+        GPCXX_ASSERT( m_replacement_tournament_size > 0 );
+
+        std::uniform_int_distribution< size_t > dist( 0 , fitness.size() - 1 );
+        size_t loser = dist( m_rng );
+        for( size_t i=1 ; i<m_replacement_tournament_size ; ++i )
+        {
+            size_t index = dist( m_rng );
+            if( is_worse( fitness[index] , fitness[loser] ) ) loser = index;
+        }
+        return loser;
+    }
+
+    /// Replaces the loser of an inverse tournament with an evaluated individual and returns its index.
+    size_t insert( population_type& pop , fitness_type& fitness , individual_type ind , fitness_value_type value )
+    {
+        size_t loser = select_loser( fitness );
+        pop[ loser ] = std::move( ind );
+        fitness[ loser ] = value;
+        ++m_selection_epoch;
+        return loser;
+    }
+
+    /// Breeds, evaluates and inserts the offspring of one operator application. Returns the number of new individuals.
+    template< typename Evaluator >
+    size_t step( population_type& pop , fitness_type& fitness , Evaluator eval )
+    {
+        auto offspring = breed( pop , fitness );
+        bool const observe = static_cast< bool >( m_observer );
+        m_out.clear();
+        for( auto& ind : offspring.individuals )
+        {
+            fitness_value_type value = eval( ind );
+            size_t index = insert( pop , fitness , std::move( ind ) , value );
+            if( observe ) m_out.push_back( index );
+        }
+        if( observe ) m_observer( offspring.choice , offspring.parents , m_out );
+        return offspring.individuals.size();
+    }
+
+    /// Performs steps until as many offspring as individuals in the population are inserted.
+    template< typename Evaluator >
+    void next_generation( population_type& pop , fitness_type& fitness , Evaluator eval )
+    {
+        size_t n = 0;
+        while( n < pop.size() )
+            n += step( pop , fitness , eval );
+    }
+
+private:
+
+    // non-finite fitness values are always worse
+    static bool is_worse( fitness_value_type x , fitness_value_type y )
+    {
+        if( ! std::isfinite( y ) ) return false;
+        if( ! std::isfinite( x ) ) return true;
+        return x > y;
+    }
+
+    rng_type& m_rng;
+    size_t m_replacement_tournament_size;
+    std::vector< double > m_rates;
+    std::vector< genetic_operator_type > m_operators;
+    std::discrete_distribution< int > m_dist;
+    final_transform_type m_final_transform;
+    operator_observer_type m_observer;
+    size_t m_selection_epoch;
+    index_vector m_out;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_EVOLVE_STEADY_STATE_PIPELINE_HPP_INCLUDED
@@ -7,6 +7,7 @@
 #ifndef GPCXX_GENERATE_BASIC_GENERATE_STRATEGY_HPP_INCLUDED
 #define GPCXX_GENERATE_BASIC_GENERATE_STRATEGY_HPP_INCLUDED
 
+#include <algorithm>
 #include <random>
 #include <stack>
 #include <cassert>
@@ -30,7 +31,7 @@ public:
     template< typename Tree , typename GenFunc >
     std::pair< typename Tree::cursor , size_t > insert_node_impl( Tree& tree , typename Tree::cursor current , GenFunc func ) const
     {
-        auto node = ( m_generator.*func )( m_rng );
+        auto node = func( m_generator , m_rng );
         auto cursor = tree.insert_below( current , node.first );
         return std::make_pair( cursor , node.second );
     }
@@ -38,16 +39,58 @@ public:
     template< typename Tree >
     std::pair< typename Tree::cursor , size_t > insert_node( Tree &tree , typename Tree::cursor current , size_t height ) const
     {
-        if( height < m_min_height )
-            return insert_node_impl( tree , current , &NodeGenerator::get_non_terminal_node );
-        else if ( height < m_max_height )
-            return insert_node_impl( tree , current , &NodeGenerator::get_node );
+        return insert_node( tree , current , height , m_min_height , m_max_height );
+    }
+
+    template< typename Tree >
+    std::pair< typename Tree::cursor , size_t > insert_node( Tree &tree , typename Tree::cursor current , size_t height ,
+                                                             size_t min_height , size_t max_height ) const
+    {
+        if( height < min_height )
+            return insert_node_impl( tree , current , non_terminal_node {} );
+        else if ( height < max_height )
+            return insert_node_impl( tree , current , any_node {} );
         else
-            return insert_node_impl( tree , current , &NodeGenerator::get_terminal );
+            return insert_node_impl( tree , current , terminal_node {} );
     }
       
     template< class Tree >
     void operator()( Tree &tree ) const
+    {
+        generate( tree , m_min_height , m_max_height );
+    }
+
+    /// Generates a tree of height at most max_height, a single terminal for max_height = 1.
+    template< class Tree >
+    void operator()( Tree &tree , size_t max_height ) const
+    {
+        max_height = std::min( max_height , m_max_height );
+        generate( tree , std::min( m_min_height , max_height ) , max_height );
+    }
+
+private:
+
+    // the node generators may have templated members, e.g. static_node_generator, hence no member pointers
+    struct any_node
+    {
+        template< typename G , typename R >
+        auto operator()( G& g , R& rng ) const { return g.get_node( rng ); }
+    };
+
+    struct non_terminal_node
+    {
+        template< typename G , typename R >
+        auto operator()( G& g , R& rng ) const { return g.get_non_terminal_node( rng ); }
+    };
+
+    struct terminal_node
+    {
+        template< typename G , typename R >
+        auto operator()( G& g , R& rng ) const { return g.get_terminal( rng ); }
+    };
+
+    template< class Tree >
+    void generate( Tree &tree , size_t min_height , size_t max_height ) const
     {
         typedef Tree tree_type;
         typedef typename tree_type::cursor cursor;
@@ -56,7 +99,8 @@ public:
         std::stack< std::pair< cursor , size_t > > gen_stack; 
 
         // initialize
-        auto root = insert_node_impl( tree , tree.root() , &NodeGenerator::get_non_terminal_node );
+        auto root = ( max_height > 1 ) ? insert_node_impl( tree , tree.root() , non_terminal_node {} )
+                                       : insert_node_impl( tree , tree.root() , terminal_node {} );
         gen_stack.push( std::make_pair( root.first , root.second ) );
 
         size_t height = 1;
@@ -72,14 +116,13 @@ public:
 
             ++height;
 
-            auto n = insert_node( tree , current , height );
+            auto n = insert_node( tree , current , height , min_height , max_height );
             if( n.second > 0 ) gen_stack.push( std::make_pair( n.first , n.second ) );
             else height--;
         }
     }
     
-private:
-    
+
     Rng &m_rng;
     NodeGenerator &m_generator;
     size_t m_min_height , m_max_height;
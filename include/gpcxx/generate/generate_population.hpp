@@ -0,0 +1,176 @@
+/*
+ * gpcxx/generate/generate_population.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_GENERATE_GENERATE_POPULATION_HPP_INCLUDED
+#define GPCXX_GENERATE_GENERATE_POPULATION_HPP_INCLUDED
+
+#include <gpcxx/tree/hash_tree.hpp>
+#include <gpcxx/util/assert.hpp>
+#include <gpcxx/util/exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+struct generate_population_options
+{
+    /// Number of threads including the calling thread.
+    size_t number_of_threads = 1;
+
+    /// Rejects trees which are already in the population.
+    bool unique = true;
+
+    /// Number of trees generated for one individual until a tree not yet in the population is found.
+    size_t max_trials = 10;
+
+    /// Seed of the random number streams of the threads.
+    std::uint64_t seed = 5489u;
+
+    /// Number of shards of the set of generated trees, every shard has its own mutex.
+    size_t number_of_shards = 64;
+};
+
+
+namespace detail {
+
+// set of the individuals of a population keyed by their structural hash, the individuals are compared with == if
+// the hashes are equal
+template< typename Pop >
+class concurrent_population_set
+{
+public:
+
+    concurrent_population_set( Pop const& pop , size_t number_of_shards )
+    : m_pop( pop ) , m_shards( number_of_shards )
+    {
+        GPCXX_ASSERT( number_of_shards > 0 );
+    }
+
+    /// Inserts the individual in slot i, returns false if an equal individual is already in the set. The slot must
+    /// not be modified as long as the individual is in the set.
+    bool insert( size_t i )
+    {
+        std::uint64_t h = hash_tree( m_pop[i] );
+        shard& s = m_shards[ h % m_shards.size() ];
+        std::lock_guard< std::mutex > lock( s.mutex );
+        auto range = s.slots.equal_range( h );
+        for( auto iter = range.first ; iter != range.second ; ++iter )
+            if( m_pop[ iter->second ] == m_pop[i] ) return false;
+        s.slots.emplace( h , i );
+        return true;
+    }
+
+private:
+
+    struct shard
+    {
+        std::mutex mutex;
+        std::unordered_multimap< std::uint64_t , size_t > slots;
+    };
+
+    Pop const& m_pop;
+    std::vector< shard > m_shards;
+};
+
+} // namespace detail
+
+
+/**
+ * Fills every slot of the preallocated population pop with a generated tree. The slots are distributed over
+ * options.number_of_threads threads, thread t fills the slots t , t + number_of_threads , ... . Every thread owns a
+ * random number generator of type Rng seeded from options.seed and t and a tree generator created by
+ * factory( rng ), e.g.
+ *
+ *     [&]( rng_type& rng ) { return make_ramp( rng , node_generator , 2 , 6 , 0.5 ); }
+ *
+ * The trees are written into their slots directly. If options.unique is set, a tree equal to a tree of another slot
+ * is regenerated, the trees are found by their structural hash in a sharded set. If no unique tree is found within
+ * options.max_trials trials for a slot, a gpcxx_exception is thrown after all threads have finished. Which one of two
+ * equal trees is kept depends on the scheduling of the threads, apart from that the population only depends on the
+ * seed and the number of threads.
+ *
+ * The node generators captured by the factory are shared between the threads and must not modify their state. Symbol
+ * generators with state, like uniform_symbol_erc, are excluded, create a node generator per thread in the factory
+ * for them.
+ */
+template< typename Rng , typename Pop , typename GeneratorFactory >
+void generate_population( Pop& pop , GeneratorFactory factory ,
+                          generate_population_options const& options = generate_population_options() )
+{
+    size_t number_of_threads = std::max< size_t >( options.number_of_threads , 1 );
+    detail::concurrent_population_set< Pop > set( pop , options.number_of_shards );
+    std::atomic< size_t > failures { 0 };
+    std::atomic< bool > abort { false };
+    std::vector< std::exception_ptr > errors( number_of_threads );
+
+    auto work = [&]( size_t t ) {
+        try
+        {
+            std::seed_seq seq { std::uint32_t( options.seed ) , std::uint32_t( options.seed >> 32 ) , std::uint32_t( t ) };
+            Rng rng( seq );
+            auto generator = factory( rng );
+            for( size_t i=t ; i<pop.size() ; i+=number_of_threads )
+            {
+                if( abort.load( std::memory_order_relaxed ) ) return;
+                bool found = false;
+                for( size_t trial=0 ; ( trial < options.max_trials ) && ( ! found ) ; ++trial )
+                {
+                    pop[i].clear();
+                    generator( pop[i] );
+                    found = ( ! options.unique ) || set.insert( i );
+                }
+                if( ! found ) ++failures;
+            }
+        }
+        catch( ... )
+        {
+            errors[t] = std::current_exception();
+            abort = true;
+        }
+    };
+
+    std::vector< std::thread > threads;
+    for( size_t t=1 ; t<number_of_threads ; ++t ) threads.emplace_back( work , t );
+    work( 0 );
+    for( auto& th : threads ) th.join();
+
+    for( auto& e : errors )
+        if( e ) std::rethrow_exception( e );
+    if( failures != 0 )
+        throw gpcxx_exception( "Could not create unique population with the requested size" );
+}
+
+/// Creates a population of n generated trees, see above.
+template< typename Pop , typename Rng , typename GeneratorFactory >
+Pop generate_population( size_t n , GeneratorFactory factory ,
+                         generate_population_options const& options = generate_population_options() )
+{
+    Pop pop( n );
+    generate_population< Rng >( pop , factory , options );
+    return pop;
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_GENERATE_GENERATE_POPULATION_HPP_INCLUDED
@@ -13,6 +13,7 @@
 #define GPCXX_GENERATE_NODE_GENERATOR_HPP_INCLUDED
 
 #include <gpcxx/util/assert.hpp>
+#include <gpcxx/util/alias_table.hpp>
 
 #include <utility>
 #include <random>
@@ -150,6 +151,7 @@ public:
     }
 
 
+    /// The symbol generators may have state, like uniform_symbol_erc, use a node generator in one thread only then.
     std::pair< node_type , size_t > get_node( rng_type& rng ) const
     {
         return generate( rng , m_generators[ m_dist( rng ) ] );
@@ -191,7 +193,7 @@ private:
         GPCXX_ASSERT( ( len >= 0 ) && ( len <= std::ptrdiff_t( dim ) ) );
         std::transform( m_non_terminal_generators.begin() , t_iter , weight.begin() ,
                         []( weighted_generator_type const& w ) { return w.weight; } );
-        m_non_terminal_dist = std::discrete_distribution<>( weight.begin() , weight.begin() + len );
+        m_non_terminal_dist.assign( weight.begin() , weight.begin() + len );
     }
     
     void prepare_dist( void )
@@ -199,7 +201,7 @@ private:
         std::array< value_type , dim > weight;
         std::transform( m_generators.begin() , m_generators.end() , weight.begin() ,
                         []( weighted_generator_type const& w ) { return w.weight; } );
-        m_dist = std::discrete_distribution<>( weight.begin() , weight.end() );
+        m_dist.assign( weight.begin() , weight.end() );
     }
     
     void prepare_terminal_generator( void )
@@ -214,8 +216,8 @@ private:
     generator_container m_generators;
     generator_container m_non_terminal_generators;
     generator_type m_terminal_generator;
-    mutable std::discrete_distribution<> m_dist;
-    mutable std::discrete_distribution<> m_non_terminal_dist;
+    alias_table m_dist;
+    alias_table m_non_terminal_dist;
 };
 
 
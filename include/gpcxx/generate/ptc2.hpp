@@ -0,0 +1,164 @@
+/*
+ * gpcxx/generate/ptc2.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_GENERATE_PTC2_HPP_INCLUDED
+#define GPCXX_GENERATE_PTC2_HPP_INCLUDED
+
+#include <gpcxx/util/alias_table.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Probabilistic tree creation 2 (PTC2) of Luke, generates trees with a given distribution of the number of nodes
+ * instead of the height. For every tree a target size s is drawn. Starting with a non-terminal root, a random open
+ * child slot is filled with a non-terminal as long as the number of filled and open slots is smaller than s, then all
+ * open slots are filled with terminals. Hence the tree has s nodes or exceeds s by less than the maximal arity. Slots
+ * at level max_height - 1 are always terminals, so the height limit can make trees smaller than s.
+ *
+ * The shape is built in a buffer of the generator which is reused for every tree, afterwards the nodes are inserted
+ * in preorder. Apart from the nodes of the tree no memory is allocated once the buffer has grown.
+ */
+template< typename Rng , typename NodeGenerator >
+class ptc2
+{
+public:
+
+    using node_type = typename NodeGenerator::node_type;
+
+    /// Uniform distribution of the size in [min_size,max_size].
+    ptc2( Rng &rng , NodeGenerator &gen , size_t min_size , size_t max_size , size_t max_height )
+    : m_rng( rng ) , m_gen( gen ) , m_max_height( max_height )
+    {
+        GPCXX_ASSERT( ( min_size >= 1 ) && ( min_size <= max_size ) );
+        std::vector< double > weights( max_size + 1 , 0.0 );
+        std::fill( weights.begin() + min_size , weights.end() , 1.0 );
+        m_size_dist.assign( weights.begin() , weights.end() );
+    }
+
+    /// size_weights[s] is the weight of the size s, size_weights[0] must be zero.
+    ptc2( Rng &rng , NodeGenerator &gen , std::vector< double > const& size_weights , size_t max_height )
+    : m_rng( rng ) , m_gen( gen ) , m_max_height( max_height ) , m_size_dist( size_weights.begin() , size_weights.end() )
+    {
+        GPCXX_ASSERT( ( ! size_weights.empty() ) && ( size_weights[0] == 0.0 ) );
+    }
+
+    template< typename Tree >
+    void operator()( Tree& tree ) const
+    {
+        generate( tree , m_max_height );
+    }
+
+    /// Height limit as for basic_generate_strategy.
+    template< typename Tree >
+    void operator()( Tree& tree , size_t max_height ) const
+    {
+        generate( tree , std::min( max_height , m_max_height ) );
+    }
+
+private:
+
+    static constexpr size_t npos = std::numeric_limits< size_t >::max();
+
+    struct slot
+    {
+        size_t node;            // index in m_nodes, npos if the slot is still open
+        size_t level;
+        size_t arity;
+        size_t first_child;     // the children of a slot are consecutive
+    };
+
+    template< typename Tree >
+    void generate( Tree& tree , size_t max_height ) const
+    {
+        size_t size = m_size_dist( m_rng );
+
+        m_slots.clear();
+        m_open.clear();
+        m_nodes.clear();
+        m_slots.push_back( slot { npos , 0 , 0 , 0 } );
+        if( ( size > 1 ) && ( max_height > 1 ) ) m_open.push_back( 0 );
+
+        while( ( ! m_open.empty() ) && ( m_slots.size() < size ) )
+        {
+            std::uniform_int_distribution< size_t > dist( 0 , m_open.size() - 1 );
+            size_t j = dist( m_rng );
+            size_t s = m_open[j];
+            m_open[j] = m_open.back();
+            m_open.pop_back();
+
+            auto n = m_gen.get_non_terminal_node( m_rng );
+            size_t level = m_slots[s].level + 1;
+            m_slots[s].node = m_nodes.size();
+            m_slots[s].arity = n.second;
+            m_slots[s].first_child = m_slots.size();
+            m_nodes.push_back( std::move( n.first ) );
+            for( size_t i=0 ; i<n.second ; ++i )
+            {
+                if( level + 1 < max_height ) m_open.push_back( m_slots.size() );
+                m_slots.push_back( slot { npos , level , 0 , 0 } );
+            }
+        }
+
+        for( auto& s : m_slots )
+        {
+            if( s.node != npos ) continue;
+            s.node = m_nodes.size();
+            m_nodes.push_back( m_gen.get_terminal( m_rng ).first );
+        }
+
+        insert( tree , tree.root() , 0 );
+    }
+
+    template< typename Tree >
+    void insert( Tree& tree , typename Tree::cursor position , size_t s ) const
+    {
+        slot const& sl = m_slots[s];
+        auto c = tree.insert_below( position , std::move( m_nodes[ sl.node ] ) );
+        for( size_t i=0 ; i<sl.arity ; ++i )
+            insert( tree , c , sl.first_child + i );
+    }
+
+
+    Rng &m_rng;
+    NodeGenerator &m_gen;
+    size_t m_max_height;
+    alias_table m_size_dist;
+    mutable std::vector< slot > m_slots;
+    mutable std::vector< size_t > m_open;
+    mutable std::vector< node_type > m_nodes;
+};
+
+template< typename Rng , typename NodeGenerator >
+constexpr size_t ptc2< Rng , NodeGenerator >::npos;
+
+
+template< typename Rng , typename NodeGenerator >
+ptc2< Rng , NodeGenerator >
+make_ptc2( Rng &rng , NodeGenerator &gen , size_t min_size , size_t max_size , size_t max_height )
+{
+    return ptc2< Rng , NodeGenerator >( rng , gen , min_size , max_size , max_height );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_GENERATE_PTC2_HPP_INCLUDED
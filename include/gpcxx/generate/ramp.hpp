@@ -14,6 +14,7 @@
 
 #include <gpcxx/generate/basic_generate_strategy.hpp>
 
+#include <algorithm>
 #include <random>
 
 namespace gpcxx {
@@ -27,19 +28,33 @@ public:
     ramp( Rng &rng , NodeGenerator &gen ,
           size_t min_height , size_t max_height , double grow_prob )
     : m_rng( rng ) , m_gen( gen )
-    , m_min_height( min_height ) , m_max_height( max_height ) , m_grow_prob( grow_prob )
+    , m_min_height( min_height ) , m_max_height( max_height ) , m_grow_prob( grow_prob ) , m_grow_dist( grow_prob )
     { }
     
     template< typename Tree >
     void operator()( Tree& tree ) const
     {
-        std::uniform_int_distribution< size_t > height_dist( m_min_height , m_max_height );
-        std::discrete_distribution< int > method_dist { m_grow_prob , 1.0 - m_grow_prob };
+        generate( tree , m_min_height , m_max_height );
+    }
+
+    /// Height limit as for basic_generate_strategy.
+    template< typename Tree >
+    void operator()( Tree& tree , size_t max_height ) const
+    {
+        max_height = std::min( max_height , m_max_height );
+        generate( tree , std::min( m_min_height , max_height ) , max_height );
+    }
+    
+private:
+
+    template< typename Tree >
+    void generate( Tree& tree , size_t min_height , size_t max_height ) const
+    {
+        std::uniform_int_distribution< size_t > height_dist( min_height , max_height );
         
         size_t height = height_dist( m_rng );
-        int method = method_dist( m_rng );
         
-        if( method == 0 ) // grow method
+        if( m_grow_dist( m_rng ) ) // grow method
         {
             auto generate = make_basic_generate_strategy( m_rng , m_gen , 1 , height );
             generate( tree );
@@ -51,14 +66,13 @@ public:
         }
         
     }
-    
-private:
  
     Rng &m_rng;
     NodeGenerator &m_gen;
     size_t m_min_height;
     size_t m_max_height;
     double m_grow_prob; // full prob is 1 - m_grow__prob
+    mutable std::bernoulli_distribution m_grow_dist;
 };
 
 
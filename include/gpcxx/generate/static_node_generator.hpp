@@ -0,0 +1,171 @@
+/*
+ * gpcxx/generate/static_node_generator.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_GENERATE_STATIC_NODE_GENERATOR_HPP_INCLUDED
+#define GPCXX_GENERATE_STATIC_NODE_GENERATOR_HPP_INCLUDED
+
+#include <gpcxx/util/alias_table.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace gpcxx {
+
+
+template< typename Generator >
+struct weighted_generator
+{
+    double weight;
+    size_t arity;
+    Generator generator;
+};
+
+template< typename Generator >
+weighted_generator< Generator > make_weighted_generator( double weight , size_t arity , Generator generator )
+{
+    return weighted_generator< Generator > { weight , arity , std::move( generator ) };
+}
+
+
+/**
+ * Node generator with the same interface as node_generator, but the generators are stored with their own types
+ * instead of std::function< node_type( rng_type& ) >. The generator is chosen from an alias_table and called through
+ * a compile time dispatch, hence the symbol generators can be inlined and every random number engine can be used.
+ * Exactly one generator must have arity zero.
+ *
+ * The symbol generators may have state, like the distributions of uniform_symbol_erc, hence generating a node modifies
+ * the generator and one static_node_generator must not be used by several threads at once.
+ *
+ *     auto gen = make_static_node_generator< std::string >(
+ *         make_weighted_generator( 2.0 , 0 , terminals ) ,
+ *         make_weighted_generator( 1.0 , 2 , binaries ) );
+ */
+template< typename Node , typename... Generators >
+class static_node_generator
+{
+public:
+
+    static const size_t dim = sizeof...( Generators );
+    using node_type = Node;
+    using generator_tuple = std::tuple< weighted_generator< Generators >... >;
+
+    static_assert( dim > 0 , "At least one generator is needed." );
+
+    explicit static_node_generator( weighted_generator< Generators >... generators )
+    : m_generators( std::move( generators )... )
+    {
+        prepare( std::make_index_sequence< dim >() );
+    }
+
+    double weight( size_t i ) const { return m_weights[i]; }
+    size_t arity( size_t i ) const { return m_arities[i]; }
+
+    template< typename Rng >
+    std::pair< node_type , size_t > get_node( Rng& rng )
+    {
+        return generate( m_dist( rng ) , rng );
+    }
+
+    template< typename Rng >
+    std::pair< node_type , size_t > get_non_terminal_node( Rng& rng )
+    {
+        return generate( m_non_terminals[ m_non_terminal_dist( rng ) ] , rng );
+    }
+
+    template< typename Rng >
+    std::pair< node_type , size_t > get_terminal( Rng& rng )
+    {
+        return generate( m_terminal , rng );
+    }
+
+    template< typename Rng >
+    node_type get_node2( Rng& rng , size_t arity )
+    {
+        auto iter = std::find( m_arities.begin() , m_arities.end() , arity );
+        GPCXX_ASSERT( iter != m_arities.end() );
+        return generate( size_t( iter - m_arities.begin() ) , rng ).first;
+    }
+
+private:
+
+    template< size_t... I >
+    void prepare( std::index_sequence< I... > )
+    {
+        m_weights = { { std::get< I >( m_generators ).weight ... } };
+        m_arities = { { std::get< I >( m_generators ).arity ... } };
+        m_dist.assign( m_weights.begin() , m_weights.end() );
+
+        std::array< double , dim > non_terminal_weights;
+        size_t terminals = 0 , non_terminals = 0;
+        for( size_t i=0 ; i<dim ; ++i )
+        {
+            if( m_arities[i] == 0 )
+            {
+                m_terminal = i;
+                ++terminals;
+            }
+            else
+            {
+                non_terminal_weights[ non_terminals ] = m_weights[i];
+                m_non_terminals[ non_terminals++ ] = i;
+            }
+        }
+        GPCXX_ASSERT( terminals == 1 );
+        m_non_terminal_dist.assign( non_terminal_weights.begin() , non_terminal_weights.begin() + non_terminals );
+    }
+
+    // calls the generator i, the comparisons are resolved at compile time up to i
+    template< typename Rng >
+    std::pair< node_type , size_t > generate( size_t i , Rng& rng )
+    {
+        return generate( i , rng , std::integral_constant< size_t , 0 >() );
+    }
+
+    template< typename Rng , size_t I >
+    std::pair< node_type , size_t > generate( size_t i , Rng& rng , std::integral_constant< size_t , I > )
+    {
+        if( ( i == I ) || ( I + 1 == dim ) )
+        {
+            auto& g = std::get< I >( m_generators );
+            return std::make_pair( node_type( g.generator( rng ) ) , g.arity );
+        }
+        return generate( i , rng , std::integral_constant< size_t , std::min( I + 1 , dim - 1 ) >() );
+    }
+
+    generator_tuple m_generators;
+    std::array< double , dim > m_weights;
+    std::array< size_t , dim > m_arities;
+    std::array< size_t , dim > m_non_terminals;
+    size_t m_terminal = 0;
+    alias_table m_dist;
+    alias_table m_non_terminal_dist;
+};
+
+template< typename Node , typename... Generators >
+const size_t static_node_generator< Node , Generators... >::dim;
+
+template< typename Node , typename... Generators >
+static_node_generator< Node , Generators... > make_static_node_generator( weighted_generator< Generators >... generators )
+{
+    return static_node_generator< Node , Generators... >( std::move( generators )... );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_GENERATE_STATIC_NODE_GENERATOR_HPP_INCLUDED
@@ -31,6 +31,7 @@ struct uniform_symbol_erc
     template< typename Symbols >
     uniform_symbol_erc( Symbols const& symbols , double prob_fraction_erc , erc_dist_type const& erc_dist )
     : m_symbols( symbols.begin() , symbols.end() ) , m_prob_fraction_erc( prob_fraction_erc ) , m_erc_dist( erc_dist )
+    , m_erc_choice( prob_fraction_erc / ( 1.0 + prob_fraction_erc ) )
     {
         GPCXX_ASSERT( !m_symbols.empty() );
         GPCXX_ASSERT( m_prob_fraction_erc > 0.0 );
@@ -39,8 +40,8 @@ struct uniform_symbol_erc
     template< typename Rng >
     result_type operator()( Rng &rng )
     {
-        std::discrete_distribution< size_t > dist( { 1.0 , m_prob_fraction_erc } );
-        if( dist( rng ) == 0 )
+        // symbol and erc are weighted 1 : m_prob_fraction_erc, the threshold is computed once
+        if( ! m_erc_choice( rng ) )
         {
             return random_symbol( rng );
         }
@@ -71,6 +72,7 @@ private:
     std::vector< result_type > m_symbols;
     double m_prob_fraction_erc;
     erc_dist_type m_erc_dist;
+    std::bernoulli_distribution m_erc_choice;
 };
 
 
@@ -8,29 +8,47 @@
 #define GPCXX_IO_BEST_INDIVIDUALS_HPP_INCLUDED
 
 #include <gpcxx/util/sort_indices.hpp>
+#include <gpcxx/util/rank_cache.hpp>
 #include <gpcxx/util/indent.hpp>
 #include <gpcxx/util/identity.hpp>
 #include <gpcxx/io/simple.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 
 namespace gpcxx {
 
 
-template< typename Pop , typename Fitness , typename SymbolMapper >
-void write_best_individuals( std::ostream &out , const Pop& p , const Fitness &f , size_t ind , size_t num_individuals , bool write_infix , SymbolMapper const& mapper )
+template< typename Pop , typename Fitness , typename Indices , typename SymbolMapper >
+void write_individuals( std::ostream &out , const Pop& p , const Fitness &f , Indices const& idx , size_t ind , bool write_infix , SymbolMapper const& mapper )
 {
-    std::vector< size_t > idx;
-    gpcxx::sort_indices( f , idx );
     bool first = true;
-    for( size_t i=0 ; i<num_individuals ; ++i )
+    size_t i = 0;
+    for( size_t index : idx )
     {
         if( first ) first = false; else out << "\n";
-        out << indent( ind ) << i << " " << f[ idx[i] ] << " : " << simple( p[ idx[i] ] , write_infix , mapper );
+        out << indent( ind ) << i++ << " " << f[ index ] << " : " << simple( p[ index ] , write_infix , mapper );
     }
 }
 
+template< typename Pop , typename Fitness , typename SymbolMapper >
+void write_best_individuals( std::ostream &out , const Pop& p , const Fitness &f , size_t ind , size_t num_individuals , bool write_infix , SymbolMapper const& mapper )
+{
+    std::vector< size_t > idx;
+    num_individuals = std::min( num_individuals , f.size() );
+    gpcxx::partial_sort_indices( f , idx , num_individuals );
+    idx.resize( num_individuals );
+    write_individuals( out , p , f , idx , ind , write_infix , mapper );
+}
+
+/// Writes the best individuals and reuses the ranking in ranks.
+template< typename Pop , typename Fitness , typename SymbolMapper >
+void write_best_individuals( std::ostream &out , const Pop& p , const Fitness &f , rank_cache& ranks , size_t ind , size_t num_individuals , bool write_infix , SymbolMapper const& mapper )
+{
+    write_individuals( out , p , f , ranks.best( f , num_individuals ) , ind , write_infix , mapper );
+}
+
 namespace detail {
     
 template< typename Pop , typename Fitness , typename SymbolMapper >
@@ -52,12 +70,32 @@ struct best_individuals_writer
     }
 };
 
+template< typename Pop , typename Fitness , typename SymbolMapper >
+struct ranked_best_individuals_writer : best_individuals_writer< Pop , Fitness , SymbolMapper >
+{
+    rank_cache& m_ranks;
+    ranked_best_individuals_writer( Pop const& pop , Fitness const& fitness , rank_cache& ranks , size_t indent , size_t num_individuals , bool write_infix , SymbolMapper const& mapper )
+    : best_individuals_writer< Pop , Fitness , SymbolMapper >( pop , fitness , indent , num_individuals , write_infix , mapper ) , m_ranks( ranks ) { }
+    
+    std::ostream& operator()( std::ostream &out ) const
+    {
+        write_best_individuals( out , this->m_pop , this->m_fitness , m_ranks , this->m_indent , this->m_num_individuals , this->m_write_infix , this->m_mapper );
+        return out;
+    }
+};
+
 template< typename Pop , typename Fitness , typename SymbolMapper >
 std::ostream& operator<<( std::ostream &out , best_individuals_writer< Pop , Fitness , SymbolMapper > const& b )
 {
     return b( out );
 }
 
+template< typename Pop , typename Fitness , typename SymbolMapper >
+std::ostream& operator<<( std::ostream &out , ranked_best_individuals_writer< Pop , Fitness , SymbolMapper > const& b )
+{
+    return b( out );
+}
+
 } // namespace detail
 
 template< typename Pop , typename Fitness , typename SymbolMapper = gpcxx::identity >
@@ -66,6 +104,12 @@ detail::best_individuals_writer< Pop , Fitness , SymbolMapper > best_individuals
     return detail::best_individuals_writer< Pop , Fitness , SymbolMapper >( pop , fitness , indent , num_individuals , write_infix , mapper );
 }
 
+template< typename Pop , typename Fitness , typename SymbolMapper = gpcxx::identity >
+detail::ranked_best_individuals_writer< Pop , Fitness , SymbolMapper > best_individuals( Pop const& pop , Fitness const& fitness , rank_cache& ranks , size_t indent = 0 , size_t num_individuals = 10 , bool write_infix = true , SymbolMapper const &mapper = SymbolMapper() )
+{
+    return detail::ranked_best_individuals_writer< Pop , Fitness , SymbolMapper >( pop , fitness , ranks , indent , num_individuals , write_infix , mapper );
+}
+
 } // namespace gpcxx
 
 #endif // GPCXX_STAT_BEST_INDIVIDUALS_HPP_INCLUDED
@@ -0,0 +1,233 @@
+/*
+ * gpcxx/io/binary.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_IO_BINARY_HPP_INCLUDED
+#define GPCXX_IO_BINARY_HPP_INCLUDED
+
+#include <gpcxx/util/identity.hpp>
+#include <gpcxx/util/exception.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+/*
+ * Compact binary format of a tree, intended for exchanging individuals between processes:
+ *
+ * varint( number of nodes ) followed by the nodes in polish order. Every node is varint( arity ) varint( code ). If code
+ * is zero the symbol follows as varint( length ) and its bytes, and gets the next free symbol id. Otherwise code - 1 is
+ * the id of a previously written symbol. Hence, every symbol is written only once per tree, or once for all trees
+ * written with the same binary_write_table.
+ *
+ * The symbols are written with the same symbol mappers as polish, and read with the same node mappers as read_polish.
+ */
+
+namespace detail {
+
+inline void write_varint( std::string& buffer , std::uint64_t x )
+{
+    while( x >= 0x80 )
+    {
+        buffer.push_back( char( ( x & 0x7f ) | 0x80 ) );
+        x >>= 7;
+    }
+    buffer.push_back( char( x ) );
+}
+
+inline char const* read_varint( char const* first , char const* last , std::uint64_t& x )
+{
+    x = 0;
+    for( unsigned shift = 0 ; shift < 64 ; shift += 7 )
+    {
+        if( first == last ) throw gpcxx_exception( "Unexpected end of binary tree data." );
+        std::uint64_t byte = std::uint64_t( static_cast< unsigned char >( *first++ ) );
+        x |= ( byte & 0x7f ) << shift;
+        if( ( byte & 0x80 ) == 0 ) return first;
+    }
+    throw gpcxx_exception( "Invalid varint in binary tree data." );
+}
+
+// symbols which are strings already are not streamed
+inline std::string const& symbol_string( std::string const& s , std::ostringstream& , std::string& )
+{
+    return s;
+}
+
+template< typename T >
+std::string const& symbol_string( T const& t , std::ostringstream& str , std::string& tmp )
+{
+    str.str( "" );
+    str << t;
+    tmp = str.str();
+    return tmp;
+}
+
+} // namespace detail
+
+
+/// Symbol ids of written trees. Share one table between several trees to write every symbol only once.
+class binary_write_table
+{
+public:
+
+    binary_write_table( void ) : m_symbols() , m_str() , m_tmp() { }
+
+    template< typename Cursor , typename SymbolMapper >
+    void write_cursor( std::string& buffer , Cursor t , SymbolMapper const& mapper )
+    {
+        auto const& mapped = mapper( *t );
+        std::string const& symbol = detail::symbol_string( mapped , m_str , m_tmp );
+        detail::write_varint( buffer , t.size() );
+        auto iter = m_symbols.find( symbol );
+        if( iter != m_symbols.end() )
+        {
+            detail::write_varint( buffer , iter->second + 1 );
+        }
+        else
+        {
+            detail::write_varint( buffer , 0 );
+            detail::write_varint( buffer , symbol.size() );
+            buffer.append( symbol );
+            m_symbols.emplace( symbol , m_symbols.size() );
+        }
+        for( size_t i=0 ; i<t.size() ; ++i )
+            write_cursor( buffer , t.children( i ) , mapper );
+    }
+
+private:
+
+    std::unordered_map< std::string , std::uint64_t > m_symbols;
+    std::ostringstream m_str;
+    std::string m_tmp;
+};
+
+
+/// Symbols of read trees, the counterpart of binary_write_table. The node mapper is called once per symbol.
+template< typename NodeMapper >
+class binary_read_table
+{
+public:
+
+    using mapped_type = typename std::decay< decltype( std::declval< NodeMapper const& >()( std::string() ) ) >::type;
+
+    explicit binary_read_table( NodeMapper const& mapper ) : m_mapper( mapper ) , m_nodes() { }
+
+    template< typename Tree , typename Cursor >
+    char const* read_cursor( char const* first , char const* last , Tree& tree , Cursor cursor , std::uint64_t& remaining )
+    {
+        if( remaining == 0 ) throw gpcxx_exception( "Binary tree data contains more nodes than announced." );
+        --remaining;
+
+        std::uint64_t arity , code;
+        first = detail::read_varint( first , last , arity );
+        first = detail::read_varint( first , last , code );
+        if( code == 0 )
+        {
+            std::uint64_t length;
+            first = detail::read_varint( first , last , length );
+            if( std::uint64_t( last - first ) < length ) throw gpcxx_exception( "Unexpected end of binary tree data." );
+            std::string symbol( first , first + length );
+            first += length;
+            m_nodes.push_back( m_mapper( symbol ) );
+            code = m_nodes.size();
+        }
+        if( code > m_nodes.size() ) throw gpcxx_exception( "Unknown symbol id in binary tree data." );
+
+        auto const& node = m_nodes[ code - 1 ];
+        if( arity != node.first ) throw gpcxx_exception( "Arity in binary tree data does not match the node mapper." );
+        auto current = tree.insert_below( cursor , node.second() );
+        for( std::uint64_t i=0 ; i<arity ; ++i )
+            first = read_cursor( first , last , tree , current , remaining );
+        return first;
+    }
+
+private:
+
+    NodeMapper const& m_mapper;
+    std::vector< mapped_type > m_nodes;
+};
+
+
+
+
+
+/// Appends the binary representation of t to buffer.
+template< typename Tree , typename SymbolMapper = gpcxx::identity >
+void write_binary( std::string& buffer , Tree const& t , SymbolMapper const& mapper = SymbolMapper() )
+{
+    binary_write_table table;
+    write_binary( buffer , t , mapper , table );
+}
+
+/// Appends t to buffer, the symbols already in table are not written again.
+template< typename Tree , typename SymbolMapper >
+void write_binary( std::string& buffer , Tree const& t , SymbolMapper const& mapper , binary_write_table& table )
+{
+    detail::write_varint( buffer , t.size() );
+    if( ! t.empty() ) table.write_cursor( buffer , t.root() , mapper );
+}
+
+template< typename Tree , typename SymbolMapper = gpcxx::identity >
+std::string binary_string( Tree const& t , SymbolMapper const& mapper = SymbolMapper() )
+{
+    std::string buffer;
+    write_binary( buffer , t , mapper );
+    return buffer;
+}
+
+
+/// Reads one tree from [first,last) into the empty tree and returns the position behind it. Throws gpcxx_exception on malformed data.
+template< typename Tree , typename NodeMapper >
+char const* read_binary( char const* first , char const* last , Tree& tree , NodeMapper const& mapper )
+{
+    binary_read_table< NodeMapper > table( mapper );
+    return read_binary( first , last , tree , table );
+}
+
+/// Reads one tree written with a shared binary_write_table, the same table has to be used for all trees.
+template< typename Tree , typename NodeMapper >
+char const* read_binary( char const* first , char const* last , Tree& tree , binary_read_table< NodeMapper >& table )
+{
+    std::uint64_t n;
+    first = detail::read_varint( first , last , n );
+    if( n == 0 ) return first;
+
+    first = table.read_cursor( first , last , tree , tree.root() , n );
+    if( n != 0 ) throw gpcxx_exception( "Binary tree data contains less nodes than announced." );
+    return first;
+}
+
+template< typename Tree , typename NodeMapper >
+void read_binary( std::string const& str , Tree& tree , NodeMapper const& mapper )
+{
+    read_binary( str.data() , str.data() + str.size() , tree , mapper );
+}
+
+template< typename Tree , typename NodeMapper >
+Tree read_binary( std::string const& str , NodeMapper const& mapper )
+{
+    Tree tree;
+    read_binary( str , tree , mapper );
+    return tree;
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_IO_BINARY_HPP_INCLUDED
@@ -0,0 +1,440 @@
+/*
+ * gpcxx/io/checkpoint.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_IO_CHECKPOINT_HPP_INCLUDED
+#define GPCXX_IO_CHECKPOINT_HPP_INCLUDED
+
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/util/identity.hpp>
+#include <gpcxx/util/exception.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+/*
+ * Binary checkpoint of an evolution, everything which is needed to resume a run:
+ *
+ * "gpcxxckp" varint( version ) varint( generation ) string( rng state ) varint( number of parameters ) followed by the
+ * parameters as string( key ) string( value ), varint( population size ) varint( sizeof fitness value ) followed by the
+ * raw fitness values, the individuals and fixed64( FNV-1a checksum of all preceding bytes ). Strings are
+ * varint( length ) followed by the bytes.
+ *
+ * An individual is either a tree, written with write_binary, or a range of individuals, written as varint( size )
+ * followed by its elements, e.g. std::array< tree , 3 >. All trees of the checkpoint share one binary_write_table,
+ * hence every symbol is written once per checkpoint.
+ *
+ * The fitness values are stored in their native representation, so a run resumes bit-identically on the same platform.
+ * The trees resume bit-identically if the symbol mapper writes every node such that the node mapper recreates it
+ * exactly, e.g. constants with all their digits.
+ */
+struct checkpoint_state
+{
+    std::uint64_t generation = 0;
+    std::string rng_state;
+    std::map< std::string , std::string > parameters;
+};
+
+/// The state of an engine with the standard stream operators, e.g. std::mt19937 or philox_engine.
+template< typename Rng >
+std::string rng_state( Rng const& rng )
+{
+    std::ostringstream str;
+    str << rng;
+    return str.str();
+}
+
+template< typename Rng >
+void restore_rng_state( Rng& rng , std::string const& state )
+{
+    std::istringstream str( state );
+    str >> rng;
+    if( ! str ) throw gpcxx_exception( "Invalid rng state in checkpoint." );
+}
+
+
+namespace detail {
+
+static const char checkpoint_magic[] = "gpcxxckp";
+static const std::uint64_t checkpoint_version = 1;
+
+inline void write_string( std::string& buffer , std::string const& s )
+{
+    write_varint( buffer , s.size() );
+    buffer.append( s );
+}
+
+inline char const* read_string( char const* first , char const* last , std::string& s )
+{
+    std::uint64_t length;
+    first = read_varint( first , last , length );
+    if( std::uint64_t( last - first ) < length ) throw gpcxx_exception( "Unexpected end of checkpoint data." );
+    s.assign( first , first + length );
+    return first + length;
+}
+
+inline std::uint64_t fnv1a( char const* first , char const* last )
+{
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for( ; first != last ; ++first )
+    {
+        h ^= std::uint64_t( static_cast< unsigned char >( *first ) );
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+inline void write_fixed64( std::string& buffer , std::uint64_t x )
+{
+    for( size_t i=0 ; i<8 ; ++i ) buffer.push_back( char( ( x >> ( 8 * i ) ) & 0xff ) );
+}
+
+inline std::uint64_t read_fixed64( char const* first )
+{
+    std::uint64_t x = 0;
+    for( size_t i=0 ; i<8 ; ++i ) x |= std::uint64_t( static_cast< unsigned char >( first[i] ) ) << ( 8 * i );
+    return x;
+}
+
+template< typename T , typename = void >
+struct is_tree : std::false_type { };
+
+template< typename T >
+struct is_tree< T , decltype( void( std::declval< T const& >().root() ) ) > : std::true_type { };
+
+
+template< typename SymbolMapper >
+class checkpoint_writer
+{
+public:
+
+    checkpoint_writer( std::string& buffer , SymbolMapper const& mapper )
+    : m_buffer( buffer ) , m_mapper( mapper ) , m_table() { }
+
+    template< typename Individual >
+    void write( Individual const& ind )
+    {
+        write( ind , is_tree< Individual >() );
+    }
+
+private:
+
+    template< typename Tree >
+    void write( Tree const& t , std::true_type )
+    {
+        write_binary( m_buffer , t , m_mapper , m_table );
+    }
+
+    template< typename Range >
+    void write( Range const& r , std::false_type )
+    {
+        write_varint( m_buffer , std::uint64_t( std::distance( std::begin( r ) , std::end( r ) ) ) );
+        for( auto const& x : r ) write( x );
+    }
+
+    std::string& m_buffer;
+    SymbolMapper const& m_mapper;
+    binary_write_table m_table;
+};
+
+
+template< typename NodeMapper >
+class checkpoint_reader
+{
+public:
+
+    checkpoint_reader( char const* first , char const* last , NodeMapper const& mapper )
+    : m_first( first ) , m_last( last ) , m_table( mapper ) { }
+
+    template< typename Individual >
+    void read( Individual& ind )
+    {
+        read( ind , is_tree< Individual >() );
+    }
+
+    char const* position( void ) const { return m_first; }
+
+private:
+
+    template< typename Tree >
+    void read( Tree& t , std::true_type )
+    {
+        t.clear();
+        m_first = read_binary( m_first , m_last , t , m_table );
+    }
+
+    template< typename Range >
+    void read( Range& r , std::false_type )
+    {
+        std::uint64_t n;
+        m_first = read_varint( m_first , m_last , n );
+        if( n != std::uint64_t( std::distance( std::begin( r ) , std::end( r ) ) ) )
+            throw gpcxx_exception( "Checkpoint individual has a different number of trees." );
+        for( auto& x : r ) read( x );
+    }
+
+    char const* m_first;
+    char const* m_last;
+    binary_read_table< NodeMapper > m_table;
+};
+
+} // namespace detail
+
+
+
+/// Writes the checkpoint into buffer, the previous content of buffer is replaced but its capacity is reused.
+template< typename Pop , typename Fitness , typename SymbolMapper = gpcxx::identity >
+void write_checkpoint( std::string& buffer , Pop const& pop , Fitness const& fitness , checkpoint_state const& state ,
+                       SymbolMapper const& mapper = SymbolMapper() )
+{
+    using fitness_value = typename std::decay< decltype( fitness[0] ) >::type;
+    static_assert( std::is_trivially_copyable< fitness_value >::value , "fitness values must be trivially copyable" );
+    if( pop.size() != fitness.size() ) throw gpcxx_exception( "Population and fitness have different sizes." );
+
+    buffer.clear();
+    buffer.append( detail::checkpoint_magic , 8 );
+    detail::write_varint( buffer , detail::checkpoint_version );
+    detail::write_varint( buffer , state.generation );
+    detail::write_string( buffer , state.rng_state );
+    detail::write_varint( buffer , state.parameters.size() );
+    for( auto const& p : state.parameters )
+    {
+        detail::write_string( buffer , p.first );
+        detail::write_string( buffer , p.second );
+    }
+
+    detail::write_varint( buffer , pop.size() );
+    detail::write_varint( buffer , sizeof( fitness_value ) );
+    for( size_t i=0 ; i<fitness.size() ; ++i )
+    {
+        fitness_value f = fitness[i];
+        char bytes[ sizeof( fitness_value ) ];
+        std::memcpy( bytes , &f , sizeof( fitness_value ) );
+        buffer.append( bytes , sizeof( fitness_value ) );
+    }
+
+    detail::checkpoint_writer< SymbolMapper > writer( buffer , mapper );
+    for( size_t i=0 ; i<pop.size() ; ++i ) writer.write( pop[i] );
+
+    detail::write_fixed64( buffer , detail::fnv1a( buffer.data() , buffer.data() + buffer.size() ) );
+}
+
+/// Restores population, fitness and state from a checkpoint. Throws gpcxx_exception on malformed data.
+template< typename Pop , typename Fitness , typename NodeMapper >
+void read_checkpoint( std::string const& buffer , Pop& pop , Fitness& fitness , checkpoint_state& state , NodeMapper const& mapper )
+{
+    using fitness_value = typename std::decay< decltype( fitness[0] ) >::type;
+    static_assert( std::is_trivially_copyable< fitness_value >::value , "fitness values must be trivially copyable" );
+
+    if( ( buffer.size() < 16 ) || ( buffer.compare( 0 , 8 , detail::checkpoint_magic ) != 0 ) )
+        throw gpcxx_exception( "Not a gpcxx checkpoint." );
+    char const* first = buffer.data() + 8;
+    char const* last = buffer.data() + buffer.size() - 8;
+    if( detail::fnv1a( buffer.data() , last ) != detail::read_fixed64( last ) )
+        throw gpcxx_exception( "Checksum mismatch in checkpoint." );
+
+    std::uint64_t version , n , parameters , value_size;
+    first = detail::read_varint( first , last , version );
+    if( version != detail::checkpoint_version ) throw gpcxx_exception( "Unsupported checkpoint version." );
+    first = detail::read_varint( first , last , state.generation );
+    first = detail::read_string( first , last , state.rng_state );
+    first = detail::read_varint( first , last , parameters );
+    state.parameters.clear();
+    for( std::uint64_t i=0 ; i<parameters ; ++i )
+    {
+        std::string key , value;
+        first = detail::read_string( first , last , key );
+        first = detail::read_string( first , last , value );
+        state.parameters.emplace( std::move( key ) , std::move( value ) );
+    }
+
+    first = detail::read_varint( first , last , n );
+    first = detail::read_varint( first , last , value_size );
+    if( value_size != sizeof( fitness_value ) ) throw gpcxx_exception( "Checkpoint has a different fitness type." );
+    if( std::uint64_t( last - first ) / sizeof( fitness_value ) < n ) throw gpcxx_exception( "Unexpected end of checkpoint data." );
+    fitness.resize( n );
+    for( size_t i=0 ; i<n ; ++i , first += sizeof( fitness_value ) )
+    {
+        fitness_value f;
+        std::memcpy( &f , first , sizeof( fitness_value ) );
+        fitness[i] = f;
+    }
+
+    pop.resize( n );
+    detail::checkpoint_reader< NodeMapper > reader( first , last , mapper );
+    for( size_t i=0 ; i<n ; ++i ) reader.read( pop[i] );
+    if( reader.position() != last ) throw gpcxx_exception( "Trailing data in checkpoint." );
+}
+
+
+/// Writes buffer to a temporary file and renames it to filename, hence filename always contains a complete checkpoint.
+inline void write_checkpoint_file( std::string const& filename , std::string const& buffer )
+{
+    std::string tmp = filename + ".tmp";
+    {
+        std::ofstream out( tmp , std::ios::binary | std::ios::trunc );
+        out.write( buffer.data() , std::streamsize( buffer.size() ) );
+        out.close();
+        if( ! out ) throw gpcxx_exception( "Could not write checkpoint file " + tmp + "." );
+    }
+    if( std::rename( tmp.c_str() , filename.c_str() ) != 0 )
+        throw gpcxx_exception( "Could not rename checkpoint file " + tmp + " to " + filename + "." );
+}
+
+inline std::string read_checkpoint_file( std::string const& filename )
+{
+    std::ifstream in( filename , std::ios::binary );
+    if( ! in ) throw gpcxx_exception( "Could not open checkpoint file " + filename + "." );
+    return std::string( std::istreambuf_iterator< char >( in ) , std::istreambuf_iterator< char >() );
+}
+
+
+
+/**
+ * Writes checkpoints from a background thread. write() serializes the population into a buffer, which takes a few
+ * milliseconds, and returns; the file is written by the background thread. If a checkpoint is still waiting when the
+ * next one arrives, only the newer one is written. Errors of the background thread are rethrown by the next call of
+ * write() or wait(). The buffers are reused, hence the writer does not allocate once the buffers have grown.
+ */
+class async_checkpoint_writer
+{
+public:
+
+    async_checkpoint_writer( void )
+    : m_mutex() , m_cond() , m_filename() , m_pending() , m_free() , m_has_pending( false ) , m_busy( false )
+    , m_stop( false ) , m_written( 0 ) , m_error() , m_thread()
+    {
+        m_thread = std::thread( [this]() { run(); } );
+    }
+
+    async_checkpoint_writer( async_checkpoint_writer const& ) = delete;
+    async_checkpoint_writer& operator=( async_checkpoint_writer const& ) = delete;
+
+    /// Writes a pending checkpoint before it returns.
+    ~async_checkpoint_writer( void )
+    {
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+    }
+
+    template< typename Pop , typename Fitness , typename SymbolMapper = gpcxx::identity >
+    void write( std::string const& filename , Pop const& pop , Fitness const& fitness , checkpoint_state const& state ,
+                SymbolMapper const& mapper = SymbolMapper() )
+    {
+        std::string buffer;
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            rethrow_error();
+            buffer.swap( m_free );
+        }
+        write_checkpoint( buffer , pop , fitness , state , mapper );
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_pending.swap( buffer );
+            m_filename = filename;
+            m_has_pending = true;
+            if( buffer.capacity() > m_free.capacity() ) m_free.swap( buffer );
+        }
+        m_cond.notify_all();
+    }
+
+    /// Blocks until all checkpoints are written.
+    void wait( void )
+    {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        m_cond.wait( lock , [this]() { return ( !m_has_pending && !m_busy ) || m_error; } );
+        rethrow_error();
+    }
+
+    /// Number of checkpoints written so far.
+    size_t written( void ) const
+    {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        return m_written;
+    }
+
+private:
+
+    void rethrow_error( void )
+    {
+        if( m_error )
+        {
+            std::exception_ptr e = m_error;
+            m_error = nullptr;
+            std::rethrow_exception( e );
+        }
+    }
+
+    void run( void )
+    {
+        std::string buffer , filename;
+        std::unique_lock< std::mutex > lock( m_mutex );
+        while( true )
+        {
+            m_cond.wait( lock , [this]() { return m_stop || m_has_pending; } );
+            if( !m_has_pending ) return;
+
+            buffer.swap( m_pending );
+            filename.swap( m_filename );
+            m_has_pending = false;
+            m_busy = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+            try { write_checkpoint_file( filename , buffer ); }
+            catch( ... ) { error = std::current_exception(); }
+
+            lock.lock();
+            m_busy = false;
+            if( error ) m_error = error;
+            else ++m_written;
+            if( buffer.capacity() > m_free.capacity() ) m_free.swap( buffer );
+            m_cond.notify_all();
+        }
+    }
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::string m_filename;
+    std::string m_pending;
+    std::string m_free;
+    bool m_has_pending;
+    bool m_busy;
+    bool m_stop;
+    size_t m_written;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_IO_CHECKPOINT_HPP_INCLUDED
@@ -14,8 +14,10 @@
 
 #include <gpcxx/util/assert.hpp>
 
-#include <vector>
-#include <memory>
+#include <boost/container/static_vector.hpp>
+
+#include <cstddef>
+#include <new>
 #include <utility>
 #include <type_traits>
 
@@ -27,9 +29,75 @@
 
 namespace gpcxx {
     
+namespace detail {
 
+// Operators with operation( selection , first , last ) assign the offspring directly to the slots, the offspring of
+// operators which only return a vector are moved into the slots.
+template< typename Op , typename Selection , typename Iterator >
+auto slot_operation( Op& op , Selection const& selection , Iterator first , Iterator last , int )
+    -> decltype( op.operation( selection , first , last ) )
+{
+    return op.operation( selection , first , last );
+}
 
-template< typename Pop , typename Fitness >    
+template< typename Op , typename Selection , typename Iterator >
+Iterator slot_operation( Op& op , Selection const& selection , Iterator first , Iterator last , long )
+{
+    auto offspring = op.operation( selection );
+    for( auto iter = offspring.begin() ; ( iter != offspring.end() ) && ( first != last ) ; ++iter , ++first )
+        *first = std::move( *iter );
+    return first;
+}
+
+// Selects in place if the operator provides selection( pop , fitness , s ), otherwise the returned selection is copied.
+template< typename Op , typename Pop , typename Fitness , typename Selection >
+auto selection_into( Op& op , Pop const& pop , Fitness const& fitness , Selection& s , int )
+    -> decltype( op.selection( pop , fitness , s ) , void() )
+{
+    s.resize( Op::arity );
+    op.selection( pop , fitness , s );
+}
+
+template< typename Op , typename Pop , typename Fitness , typename Selection >
+void selection_into( Op& op , Pop const& pop , Fitness const& fitness , Selection& s , long )
+{
+    auto sel = op.selection( pop , fitness );
+    s.assign( sel.begin() , sel.end() );
+}
+
+template< typename Values , typename Range >
+Values to_values( Range&& r )
+{
+    Values values;
+    for( auto& v : r ) values.push_back( std::move( v ) );
+    return values;
+}
+
+// Offspring of operators with slots are assigned directly to the fixed capacity container.
+template< typename Values , typename Op , typename Selection >
+auto values_operation( Op& op , Selection const& selection , int )
+    -> decltype( op.operation( selection , std::declval< typename Values::iterator >() , std::declval< typename Values::iterator >() ) , Values() )
+{
+    Values values( Op::arity );
+    values.erase( op.operation( selection , values.begin() , values.end() ) , values.end() );
+    return values;
+}
+
+template< typename Values , typename Op , typename Selection >
+Values values_operation( Op& op , Selection const& selection , long )
+{
+    return to_values< Values >( op.operation( selection ) );
+}
+
+} // namespace detail
+
+
+/**
+ * Type erased genetic operator. Operators up to buffer_size bytes are stored inline and called through a static table
+ * of function pointers, hence copying an any_genetic_operator does not allocate. The selection and the offspring are
+ * returned in containers of fixed capacity max_arity.
+ */
+template< typename Pop , typename Fitness , size_t MaxArity = 4 , size_t BufferSize = 64 >
 class any_genetic_operator
 {
 public:
@@ -37,51 +105,70 @@ public:
     template< typename T >
     using remove_rcv = std::remove_cv_t< std::remove_reference_t< T > >;
     
+    static const size_t max_arity = MaxArity;
+    static const size_t buffer_size = BufferSize;
+    
     using population_type = Pop;
     using fitness_type = Fitness;
     using value_type = typename Pop::value_type;
     using value_iterator = typename Pop::const_iterator;
-    using value_vector_type = std::vector< value_type >;
-    using selection_type = std::vector< value_iterator >;
+    using slot_iterator = typename Pop::iterator;
+    using value_vector_type = boost::container::static_vector< value_type , max_arity >;
+    using selection_type = boost::container::static_vector< value_iterator , max_arity >;
     
-    any_genetic_operator( void ) = default;
+    any_genetic_operator( void ) noexcept
+    : m_vtable( nullptr ) { }
     
-    ~any_genetic_operator( void ) = default;
+    ~any_genetic_operator( void )
+    {
+        reset();
+    }
     
     template< typename T >
     any_genetic_operator( T&& t )
-    : m_data( new model< remove_rcv< T > >( std::forward< T >( t ) ) )
+    : m_vtable( nullptr )
     {
         #ifdef GPCXX_ANY_GENETIC_OPERATOR_DEBUG
         namespace ti = boost::typeindex;
         std::cout << "universal ctor: " << ti::type_id_with_cvr< T >().pretty_name() << " " << ti::type_id_runtime( t ).pretty_name() << std::endl;
         #endif
+        emplace< remove_rcv< T > >( std::forward< T >( t ) );
     }
     
     any_genetic_operator( any_genetic_operator const& op )
-    : m_data( ( op.m_data ) ? op.m_data->clone() : nullptr  )
+    : m_vtable( nullptr )
     {
         #ifdef GPCXX_ANY_GENETIC_OPERATOR_DEBUG
         std::cout << "const copy ctor" << std::endl;
         #endif
+        copy_from( op );
     }
     
     any_genetic_operator( any_genetic_operator& op )
-    : m_data( ( op.m_data ) ? op.m_data->clone() : nullptr )
+    : m_vtable( nullptr )
     {
         #ifdef GPCXX_ANY_GENETIC_OPERATOR_DEBUG
         std::cout << "non-const copy ctor" << std::endl;
         #endif
+        copy_from( op );
     }
    
-    any_genetic_operator( any_genetic_operator&& op ) = default;
+    any_genetic_operator( any_genetic_operator&& op ) noexcept
+    : m_vtable( nullptr )
+    {
+        move_from( op );
+    }
     
     any_genetic_operator& operator=( any_genetic_operator const& op )
     {
         #ifdef GPCXX_ANY_GENETIC_OPERATOR_DEBUG
         std::cout << "const copy assignment" << std::endl;
         #endif
-        if( op.m_data ) m_data.reset( op.m_data->clone() );
+        if( this != &op )
+        {
+            reset();
+            copy_from( op );
+        }
         return *this;
     }
     
@@ -90,8 +177,7 @@ public:
         #ifdef GPCXX_ANY_GENETIC_OPERATOR_DEBUG
         std::cout << "non const copy assignment" << std::endl;
         #endif
-        if( op.m_data ) m_data.reset( op.m_data->clone() );
-        return *this;
+        return *this = static_cast< any_genetic_operator const& >( op );
     }
     
     template< typename T >
@@ -101,88 +187,169 @@ public:
         namespace ti = boost::typeindex;
         std::cout << "universal copy assignment" << ti::type_id_with_cvr< T >().pretty_name() << " " << ti::type_id_runtime( t ).pretty_name() << std::endl;
         #endif
-        m_data.reset( new model< remove_rcv< T > >( std::forward< T >( t ) ) );
+        reset();
+        emplace< remove_rcv< T > >( std::forward< T >( t ) );
         return *this;
     }
     
-    
-    any_genetic_operator& operator=( any_genetic_operator&& op ) = default;
+    any_genetic_operator& operator=( any_genetic_operator&& op ) noexcept
+    {
+        if( this != &op )
+        {
+            reset();
+            move_from( op );
+        }
+        return *this;
+    }
 
     
     
     value_vector_type operator()( population_type const& pop , fitness_type const& fitness )
     {
-        GPCXX_ASSERT( m_data );
-        return m_data->op( pop , fitness );
+        GPCXX_ASSERT( m_vtable );
+        return m_vtable->apply( &m_storage , pop , fitness );
     }
     
     selection_type selection( population_type const& pop , fitness_type const& fitness )
     {
-        GPCXX_ASSERT( m_data );
-        return m_data->selection( pop , fitness );
+        selection_type s;
+        selection( pop , fitness , s );
+        return s;
+    }
+    
+    void selection( population_type const& pop , fitness_type const& fitness , selection_type& s )
+    {
+        GPCXX_ASSERT( m_vtable );
+        m_vtable->selection( &m_storage , pop , fitness , s );
     }
     
     value_vector_type operation( selection_type const& selection )
     {
-        GPCXX_ASSERT( m_data );
-        return m_data->op( selection );
+        GPCXX_ASSERT( m_vtable );
+        return m_vtable->operation( &m_storage , selection );
+    }
+    
+    /// Assigns the offspring to the slots [first,last), returns the end of the written range.
+    slot_iterator operation( selection_type const& selection , slot_iterator first , slot_iterator last )
+    {
+        GPCXX_ASSERT( m_vtable );
+        return m_vtable->slot_operation( &m_storage , selection , first , last );
     }
     
     // find better name
     size_t arity( void ) const
     {
-        GPCXX_ASSERT( m_data );
-        return m_data->arity();
+        GPCXX_ASSERT( m_vtable );
+        return m_vtable->arity;
     }
     
     operator bool( void ) const
     {
-        return static_cast< bool >( m_data );
+        return m_vtable != nullptr;
     }
     
     
 private:
     
-    struct concept
+    using storage_type = std::aligned_storage_t< buffer_size , alignof( std::max_align_t ) >;
+    
+    struct vtable_type
     {
-        virtual ~concept( void ) { }
-        virtual value_vector_type op( population_type const& , fitness_type const& ) = 0;
-        virtual selection_type selection( population_type const& , fitness_type const& ) = 0;
-        virtual value_vector_type op( selection_type const& ) = 0;
-        virtual size_t arity( void ) const = 0;
-        virtual concept* clone( void ) const = 0;
+        void ( *copy )( void* dst , void const* src );
+        void ( *relocate )( void* dst , void* src );
+        void ( *destroy )( void* p );
+        value_vector_type ( *apply )( void* p , population_type const& , fitness_type const& );
+        void ( *selection )( void* p , population_type const& , fitness_type const& , selection_type& );
+        value_vector_type ( *operation )( void* p , selection_type const& );
+        slot_iterator ( *slot_operation )( void* p , selection_type const& , slot_iterator , slot_iterator );
+        size_t arity;
     };
     
     template< typename T >
-    struct model : public concept
+    struct inline_handler
     {
-        model( T const& t ) : m_data( t ) {}
-        model( T&& t ) : m_data( std::move( t ) ) {}
-        ~model( void ) = default;
-        value_vector_type op( population_type const& pop , fitness_type const& fitness ) override
-        {
-            return m_data( pop , fitness );
-        }
-        selection_type selection( population_type const& pop , fitness_type const& fitness ) override
-        {
-            return m_data.selection( pop , fitness );
-        }
-        value_vector_type op( selection_type const& selection ) override
+        template< typename ... Args >
+        static void create( void* p , Args&& ... args ) { ::new( p ) T( std::forward< Args >( args ) ... ); }
+        static T& object( void* p ) { return *static_cast< T* >( p ); }
+        static T const& object( void const* p ) { return *static_cast< T const* >( p ); }
+        static void copy( void* dst , void const* src ) { create( dst , object( src ) ); }
+        static void relocate( void* dst , void* src ) { create( dst , std::move( object( src ) ) ); destroy( src ); }
+        static void destroy( void* p ) { object( p ).~T(); }
+    };
+    
+    template< typename T >
+    struct heap_handler
+    {
+        template< typename ... Args >
+        static void create( void* p , Args&& ... args ) { *static_cast< T** >( p ) = new T( std::forward< Args >( args ) ... ); }
+        static T& object( void* p ) { return **static_cast< T** >( p ); }
+        static T const& object( void const* p ) { return **static_cast< T* const* >( p ); }
+        static void copy( void* dst , void const* src ) { create( dst , object( src ) ); }
+        static void relocate( void* dst , void* src ) { *static_cast< T** >( dst ) = *static_cast< T** >( src ); }
+        static void destroy( void* p ) { delete *static_cast< T** >( p ); }
+    };
+    
+    template< typename T >
+    using handler = std::conditional_t<
+        ( sizeof( T ) <= buffer_size ) && ( alignof( T ) <= alignof( storage_type ) ) && std::is_nothrow_move_constructible< T >::value ,
+        inline_handler< T > , heap_handler< T > >;
+    
+    template< typename T >
+    static vtable_type const* vtable_for( void )
+    {
+        using h = handler< T >;
+        static const vtable_type vtable = {
+            &h::copy , &h::relocate , &h::destroy ,
+            []( void* p , population_type const& pop , fitness_type const& fitness ) {
+                return detail::to_values< value_vector_type >( h::object( p )( pop , fitness ) ); } ,
+            []( void* p , population_type const& pop , fitness_type const& fitness , selection_type& s ) {
+                detail::selection_into( h::object( p ) , pop , fitness , s , 0 ); } ,
+            []( void* p , selection_type const& selection ) {
+                return detail::values_operation< value_vector_type >( h::object( p ) , selection , 0 ); } ,
+            []( void* p , selection_type const& selection , slot_iterator first , slot_iterator last ) {
+                return detail::slot_operation( h::object( p ) , selection , first , last , 0 ); } ,
+            T::arity };
+        return &vtable;
+    }
+    
+    template< typename T , typename ... Args >
+    void emplace( Args&& ... args )
+    {
+        static_assert( T::arity <= max_arity , "the arity of the operator exceeds max_arity" );
+        handler< T >::create( &m_storage , std::forward< Args >( args ) ... );
+        m_vtable = vtable_for< T >();
+    }
+    
+    void copy_from( any_genetic_operator const& op )
+    {
+        if( op.m_vtable )
         {
-            return m_data.operation( selection );
+            op.m_vtable->copy( &m_storage , &op.m_storage );
+            m_vtable = op.m_vtable;
         }
-        size_t arity( void ) const override
+    }
+    
+    void move_from( any_genetic_operator& op ) noexcept
+    {
+        if( op.m_vtable )
         {
-            return T::arity;
+            op.m_vtable->relocate( &m_storage , &op.m_storage );
+            m_vtable = op.m_vtable;
+            op.m_vtable = nullptr;
         }
-        concept* clone( void ) const override
+    }
+    
+    void reset( void ) noexcept
+    {
+        if( m_vtable )
         {
-            return new model( m_data );
+            m_vtable->destroy( &m_storage );
+            m_vtable = nullptr;
         }
-        T m_data;
-    };
+    }
     
-    std::unique_ptr< concept > m_data;
+    storage_type m_storage;
+    vtable_type const* m_vtable;
 };
 
 /*
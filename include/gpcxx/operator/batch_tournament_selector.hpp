@@ -0,0 +1,254 @@
+/*
+ * gpcxx/operator/batch_tournament_selector.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_BATCH_TOURNAMENT_SELECTOR_HPP_INCLUDED
+#define GPCXX_OPERATOR_BATCH_TOURNAMENT_SELECTOR_HPP_INCLUDED
+
+#include <gpcxx/util/philox_engine.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+namespace gpcxx {
+
+namespace detail {
+
+/// Uniform integer in [0,range) from a 32 bit generator, Lemire's nearly divisionless method. The division is only
+/// needed in the rare case of a potentially biased result.
+template< typename Rng >
+inline std::uint32_t bounded_uint32( Rng& rng , std::uint32_t range )
+{
+    std::uint64_t m = std::uint64_t( std::uint32_t( rng() ) ) * std::uint64_t( range );
+    std::uint32_t l = std::uint32_t( m );
+    if( l < range )
+    {
+        std::uint32_t t = ( 0u - range ) % range;
+        while( l < t )
+        {
+            m = std::uint64_t( std::uint32_t( rng() ) ) * std::uint64_t( range );
+            l = std::uint32_t( m );
+        }
+    }
+    return std::uint32_t( m >> 32 );
+}
+
+/// Batched form of bounded_uint32, maps the raw values x[0..n) of rng to uniform integers out[0..n) in [0,range). The
+/// multiplications are done in one loop without branches, which the compiler can vectorize. The rare values which
+/// would be biased are replaced afterwards by new draws from rng.
+template< typename Rng >
+inline void bounded_uint32( Rng& rng , std::uint32_t range , std::uint32_t const* x , std::uint32_t* out , size_t n )
+{
+    std::uint32_t t = ( 0u - range ) % range;
+    std::uint32_t biased = 0;
+    for( size_t i=0 ; i<n ; ++i )
+    {
+        std::uint64_t m = std::uint64_t( x[i] ) * std::uint64_t( range );
+        biased |= std::uint32_t( std::uint32_t( m ) < t );
+        out[i] = std::uint32_t( m >> 32 );
+    }
+    if( biased == 0 ) return;
+    for( size_t i=0 ; i<n ; ++i )
+        if( std::uint32_t( std::uint64_t( x[i] ) * std::uint64_t( range ) ) < t ) out[i] = bounded_uint32( rng , range );
+}
+
+} // namespace detail
+
+
+
+/**
+ * Tournament selection for a whole generation at once. select() draws the winners of n tournaments, the block b of
+ * block_size tournaments uses the philox stream ( seed , generation , b , stream_id ). Hence, the blocks can be
+ * processed by several threads and the winners do not depend on the number of threads. Every call of select()
+ * advances the generation. The candidates of a block are generated in one batch, first the raw random values, then
+ * the indices with the batched bounded_uint32.
+ *
+ * Like tournament_selector, the individual with the smallest fitness wins. The comparison is the same, hence a NaN
+ * only wins if it is the first candidate.
+ */
+class batch_tournament_selector
+{
+public:
+
+    static const size_t block_size = 256;
+
+    batch_tournament_selector( std::uint64_t seed , size_t tournament_size , size_t number_of_threads = 1 , std::uint32_t stream_id = 0 )
+    : m_seed( seed ) , m_tournament_size( tournament_size ) , m_number_of_threads( std::max< size_t >( number_of_threads , 1 ) )
+    , m_stream_id( stream_id ) , m_generation( 0 )
+    {
+        GPCXX_ASSERT( tournament_size > 0 );
+    }
+
+    template< typename Fitness >
+    void select( Fitness const& fitness , size_t n , std::vector< size_t >& winners )
+    {
+        GPCXX_ASSERT( fitness.size() > 0 );
+        GPCXX_ASSERT( fitness.size() <= std::numeric_limits< std::uint32_t >::max() );
+
+        winners.resize( n );
+        std::uint32_t generation = m_generation++;
+        size_t const bs = block_size;
+        size_t blocks = ( n + bs - 1 ) / bs;
+        size_t threads = std::min( m_number_of_threads , blocks );
+        if( m_scratch.size() < threads ) m_scratch.resize( threads );
+        for( size_t t=0 ; t<threads ; ++t ) m_scratch[t].resize( 2 * bs * m_tournament_size );
+
+        auto work = [&]( size_t t ) {
+            for( size_t b=t ; b<blocks ; b+=threads )
+            {
+                size_t first = b * bs;
+                select_block( fitness , generation , b , winners.data() + first , std::min( bs , n - first ) , m_scratch[t] );
+            }
+        };
+
+        if( threads <= 1 )
+        {
+            work( 0 );
+            return;
+        }
+        std::vector< std::thread > pool;
+        pool.reserve( threads - 1 );
+        for( size_t t=1 ; t<threads ; ++t ) pool.emplace_back( work , t );
+        work( 0 );
+        for( auto& th : pool ) th.join();
+    }
+
+    size_t tournament_size( void ) const { return m_tournament_size; }
+    size_t number_of_threads( void ) const { return m_number_of_threads; }
+    std::uint32_t generation( void ) const { return m_generation; }
+
+private:
+
+    template< typename Fitness >
+    void select_block( Fitness const& fitness , std::uint32_t generation , size_t block , size_t* out , size_t n ,
+                       std::vector< std::uint32_t >& scratch ) const
+    {
+        // all candidates of the block at once, first the raw values and then the indices
+        philox_engine rng( m_seed , generation , std::uint32_t( block ) , m_stream_id );
+        size_t count = n * m_tournament_size;
+        std::uint32_t* raw = scratch.data();
+        std::uint32_t* candidates = raw + count;
+        rng.generate( raw , count );
+        detail::bounded_uint32( rng , std::uint32_t( fitness.size() ) , raw , candidates , count );
+
+        for( size_t i=0 ; i<n ; ++i , candidates += m_tournament_size )
+        {
+            // branchless min-reduction over the gathered fitness values
+            std::uint32_t best = candidates[0];
+            auto best_value = fitness[ best ];
+            for( size_t k=1 ; k<m_tournament_size ; ++k )
+            {
+                std::uint32_t c = candidates[k];
+                auto value = fitness[c];
+                bool better = value < best_value;
+                best = better ? c : best;
+                best_value = better ? value : best_value;
+            }
+            out[i] = best;
+        }
+    }
+
+    std::uint64_t m_seed;
+    size_t m_tournament_size;
+    size_t m_number_of_threads;
+    std::uint32_t m_stream_id;
+    std::uint32_t m_generation;
+    std::vector< std::vector< std::uint32_t > > m_scratch;       // raw values and candidates of a block for every thread
+};
+
+
+
+/**
+ * Selector which hands out the precomputed winners of a batch_tournament_selector. It can be used wherever a selector
+ * is expected, e.g. in mutation, crossover and reproduce of dynamic_pipeline and static_pipeline. Copies share the
+ * batch, hence all operators constructed from one batched_tournament_selector consume the same batch.
+ *
+ * A batch of pop.size() winners is drawn if the batch is exhausted, if the size of the population has changed, after
+ * invalidate() or if the epoch passed to set_epoch() has changed. Bind it to the selection_epoch() of the pipeline,
+ * then every generation gets a new batch, even if the population is reused in place. For steady_state_pipeline the
+ * epoch changes with every insertion, hence a whole batch is drawn for every step.
+ */
+class batched_tournament_selector
+{
+public:
+
+    batched_tournament_selector( std::uint64_t seed , size_t tournament_size , size_t number_of_threads = 1 , std::uint32_t stream_id = 0 )
+    : m_state( std::make_shared< state >( seed , tournament_size , number_of_threads , stream_id ) ) { }
+
+    template< typename Pop , typename Fitness >
+    typename Pop::const_iterator
+    operator()( Pop const& pop , Fitness const& fitness ) const
+    {
+        GPCXX_ASSERT( pop.size() == fitness.size() );
+        GPCXX_ASSERT( pop.size() > 0 );
+
+        state& s = *m_state;
+        if( ( s.position == s.winners.size() ) || ( s.winners.size() != pop.size() ) || ( s.epoch && ( *s.epoch != s.key ) ) )
+        {
+            s.batch.select( fitness , pop.size() , s.winners );
+            s.position = 0;
+            if( s.epoch ) s.key = *s.epoch;
+        }
+        return std::next( std::begin( pop ) , s.winners[ s.position++ ] );
+    }
+
+    /// Forces a new batch at the next selection, call it if the population or the fitness has changed.
+    void invalidate( void )
+    {
+        m_state->position = m_state->winners.size();
+    }
+
+    /// Draws a new batch whenever epoch changes, e.g. pipeline.selection_epoch(). The counter must outlive the selector.
+    void set_epoch( size_t const& epoch )
+    {
+        m_state->epoch = &epoch;
+        invalidate();
+    }
+
+    batch_tournament_selector const& batch( void ) const
+    {
+        return m_state->batch;
+    }
+
+private:
+
+    struct state
+    {
+        state( std::uint64_t seed , size_t tournament_size , size_t number_of_threads , std::uint32_t stream_id )
+        : batch( seed , tournament_size , number_of_threads , stream_id ) , winners() , position( 0 ) , epoch( nullptr ) , key( 0 ) { }
+
+        batch_tournament_selector batch;
+        std::vector< size_t > winners;
+        size_t position;
+        size_t const* epoch;
+        size_t key;
+    };
+
+    std::shared_ptr< state > m_state;
+};
+
+inline batched_tournament_selector make_batched_tournament_selector( std::uint64_t seed , size_t tournament_size , size_t number_of_threads = 1 , std::uint32_t stream_id = 0 )
+{
+    return batched_tournament_selector( seed , tournament_size , number_of_threads , stream_id );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_BATCH_TOURNAMENT_SELECTOR_HPP_INCLUDED
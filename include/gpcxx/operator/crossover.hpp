@@ -15,6 +15,7 @@
 #include <gpcxx/operator/detail/operator_base.hpp>
 #include <gpcxx/util/assert.hpp>
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -39,16 +40,32 @@ public:
         return operation( sel );
     }
     
+    template< typename Pop , typename Fitness , typename OutputIterator >
+    OutputIterator operator()( Pop const& pop , Fitness const& fitness , OutputIterator first , OutputIterator last )
+    {
+        std::array< typename Pop::const_iterator , 2 > sel;
+        selection( pop , fitness , sel );
+        return operation( sel , first , last );
+    }
+    
     template< typename Pop , typename Fitness >
     std::vector< typename Pop::const_iterator >
     selection( Pop const& pop , Fitness const& fitness )
     {
-        GPCXX_ASSERT( pop.size() > 2 );
         std::vector< typename Pop::const_iterator > s(2);
+        selection( pop , fitness , s );
+        return s;
+    }
+    
+    /// Selects two different parents into s, which must hold two elements.
+    template< typename Pop , typename Fitness , typename Selection >
+    void selection( Pop const& pop , Fitness const& fitness , Selection& s )
+    {
+        GPCXX_ASSERT( pop.size() > 2 );
+        GPCXX_ASSERT( s.size() == 2 );
         s[1] = s[0] = m_selector( pop , fitness );
         while( s[0] == s[1] )
             s[1] = m_selector( pop , fitness );
-        return s;
     }
     
     template< typename Selection >
@@ -64,6 +81,33 @@ public:
         return nodes;
     }
     
+    /// Assigns the offspring to the slots [first,last) and returns the end of the written range. If only one slot is
+    /// left, the second offspring is discarded.
+    template< typename Selection , typename OutputIterator >
+    OutputIterator operation( Selection const& selection , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( selection.size() == 2 );
+        GPCXX_ASSERT( first != last );
+        auto& t1 = *first;
+        t1 = *( selection[0] );
+        ++first;
+        if( first != last )
+        {
+            auto& t2 = *first;
+            t2 = *( selection[1] );
+            ++first;
+            if( ( ! t1.empty() ) && ( ! t2.empty() ) )
+                m_strategy( t1 , t2 );
+        }
+        else
+        {
+            auto t2 = *( selection[1] );
+            if( ( ! t1.empty() ) && ( ! t2.empty() ) )
+                m_strategy( t1 , t2 );
+        }
+        return first;
+    }
+    
 private:
     
     Strategy m_strategy;
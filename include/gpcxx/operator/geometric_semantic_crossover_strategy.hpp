@@ -0,0 +1,72 @@
+/*
+ * gpcxx/operator/geometric_semantic_crossover_strategy.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_CROSSOVER_STRATEGY_HPP_INCLUDED
+#define GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_CROSSOVER_STRATEGY_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/semantic_individual.hpp>
+
+#include <utility>
+
+
+namespace gpcxx {
+
+
+/**
+ * Geometric semantic crossover of two semantic_individuals. A random tree r is generated and evaluated on the training
+ * cases, the offspring are logistic( r ) * t1 + ( 1 - logistic( r ) ) * t2 and logistic( r ) * t2 + ( 1 - logistic( r ) ) * t1.
+ * Their semantics lie on the segment between the semantics of the parents. The parents and r are shared, not copied.
+ *
+ * Fitness must provide get_outputs( tree , data , outputs ) like regression_fitness. Use with crossover.
+ */
+template< typename TreeGenerator , typename Fitness , typename TrainingData >
+class geometric_semantic_crossover_strategy : public detail::operator_base< 2 >
+{
+public:
+
+    geometric_semantic_crossover_strategy( TreeGenerator& gen , Fitness const& fitness , TrainingData const& data )
+    : m_gen( gen ) , m_fitness( fitness ) , m_data( data ) { }
+
+    template< class Individual >
+    bool operator()( Individual& t1 , Individual& t2 )
+    {
+        typename Individual::tree_type tree;
+        m_gen( tree );
+        typename Individual::semantics_type semantics;
+        m_fitness.get_outputs( tree , m_data , semantics );
+        Individual r( std::move( tree ) , std::move( semantics ) );
+
+        Individual offspring = semantic_crossover( t1 , t2 , r );
+        t2 = semantic_crossover( t2 , t1 , r );
+        t1 = std::move( offspring );
+        return true;
+    }
+
+private:
+
+    TreeGenerator& m_gen;
+    Fitness const& m_fitness;
+    TrainingData const& m_data;
+};
+
+template< typename TreeGenerator , typename Fitness , typename TrainingData >
+geometric_semantic_crossover_strategy< TreeGenerator , Fitness , TrainingData >
+make_geometric_semantic_crossover_strategy( TreeGenerator& gen , Fitness const& fitness , TrainingData const& data )
+{
+    return geometric_semantic_crossover_strategy< TreeGenerator , Fitness , TrainingData >( gen , fitness , data );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_CROSSOVER_STRATEGY_HPP_INCLUDED
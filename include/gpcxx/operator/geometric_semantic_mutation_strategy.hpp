@@ -0,0 +1,76 @@
+/*
+ * gpcxx/operator/geometric_semantic_mutation_strategy.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_MUTATION_STRATEGY_HPP_INCLUDED
+#define GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_MUTATION_STRATEGY_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/semantic_individual.hpp>
+
+#include <utility>
+
+
+namespace gpcxx {
+
+
+/**
+ * Geometric semantic mutation of a semantic_individual. Two random trees r1 and r2 are generated and evaluated on the
+ * training cases, the offspring is t + step * ( logistic( r1 ) - logistic( r2 ) ). Every output moves by less than
+ * step. The parent is shared, not copied.
+ *
+ * Fitness must provide get_outputs( tree , data , outputs ) like regression_fitness. Use with mutation.
+ */
+template< typename TreeGenerator , typename Fitness , typename TrainingData , typename Value = double >
+class geometric_semantic_mutation_strategy : public detail::operator_base< 1 >
+{
+public:
+
+    geometric_semantic_mutation_strategy( TreeGenerator& gen , Fitness const& fitness , TrainingData const& data , Value step )
+    : m_gen( gen ) , m_fitness( fitness ) , m_data( data ) , m_step( step ) { }
+
+    template< class Individual >
+    void operator()( Individual& t )
+    {
+        Individual r1 = random_individual< Individual >();
+        Individual r2 = random_individual< Individual >();
+        t = semantic_mutation( t , r1 , r2 , typename Individual::value_type( m_step ) );
+    }
+
+private:
+
+    template< class Individual >
+    Individual random_individual( void )
+    {
+        typename Individual::tree_type tree;
+        m_gen( tree );
+        typename Individual::semantics_type semantics;
+        m_fitness.get_outputs( tree , m_data , semantics );
+        return Individual( std::move( tree ) , std::move( semantics ) );
+    }
+
+    TreeGenerator& m_gen;
+    Fitness const& m_fitness;
+    TrainingData const& m_data;
+    Value m_step;
+};
+
+template< typename TreeGenerator , typename Fitness , typename TrainingData , typename Value >
+geometric_semantic_mutation_strategy< TreeGenerator , Fitness , TrainingData , Value >
+make_geometric_semantic_mutation_strategy( TreeGenerator& gen , Fitness const& fitness , TrainingData const& data , Value step )
+{
+    return geometric_semantic_mutation_strategy< TreeGenerator , Fitness , TrainingData , Value >( gen , fitness , data , step );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_GEOMETRIC_SEMANTIC_MUTATION_STRATEGY_HPP_INCLUDED
@@ -0,0 +1,112 @@
+/*
+ * gpcxx/operator/height_constrained_crossover_strategy.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_HEIGHT_CONSTRAINED_CROSSOVER_STRATEGY_HPP_INCLUDED
+#define GPCXX_OPERATOR_HEIGHT_CONSTRAINED_CROSSOVER_STRATEGY_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/node_index.hpp>
+
+#include <random>
+
+
+namespace gpcxx {
+
+
+/**
+ * One point crossover without rejection. The first point is drawn from t1, with probability internal_node_favor_rate
+ * among the nodes with children. The second point is drawn uniformly among the nodes of t2 for which both offspring
+ * have a height of at most max_height, the same limit as in one_point_crossover_strategy. These nodes are found in the
+ * height-level histogram of node_index in O( height ), hence no trials are wasted near the height limit.
+ *
+ * If both parents respect max_height every first point has a partner. Otherwise the first point is redrawn up to
+ * max_iterations times and false is returned if no pair fits.
+ */
+template< typename Rng >
+class height_constrained_crossover_strategy : public detail::operator_base< 2 >
+{
+public:
+
+    height_constrained_crossover_strategy( Rng& rng , size_t max_height , double internal_node_favor_rate = 0.0 , size_t max_iterations = 100 )
+    : m_rng( rng ) , m_max_height( max_height ) , m_internal_node_favor_rate( internal_node_favor_rate )
+    , m_max_iterations( max_iterations ) { }
+
+    template< class Tree >
+    bool operator()( Tree& t1 , Tree& t2 )
+    {
+        typename Tree::cursor n1 , n2;
+        if( ! select_points( t1 , t2 , n1 , n2 ) ) return false;
+        swap_subtrees( t1 , n1 , t2 , n2 );
+        return true;
+    }
+
+    /// Draws the crossover points without modifying the trees, Tree may be const.
+    template< class Tree , class Cursor >
+    bool select_points( Tree& t1 , Tree& t2 , Cursor& n1 , Cursor& n2 )
+    {
+        typedef Cursor cursor;
+
+        if( t1.empty() || t2.empty() ) return false;
+
+        auto& index1 = scratch_node_index< cursor , 0 >();
+        auto& index2 = scratch_node_index< cursor , 1 >();
+        index1.build( t1 );
+        index2.build( t2 );
+
+        std::uniform_real_distribution< double > favor_dist( 0.0 , 1.0 );
+        for( size_t iter = 0 ; iter < m_max_iterations ; ++iter )
+        {
+            size_t i1 = 0;
+            if( m_internal_node_favor_rate > 0.0 )
+            {
+                auto functions = index1.functions();
+                bool internal = ( favor_dist( m_rng ) < m_internal_node_favor_rate ) && ( ! functions.empty() );
+                i1 = node_index< cursor >::sample( internal ? functions : index1.terminals() , m_rng );
+            }
+            else
+            {
+                i1 = index1.sample( m_rng );
+            }
+
+            size_t level1 = index1.level( i1 );
+            size_t height1 = index1.height( i1 );
+            if( ( level1 >= m_max_height ) || ( height1 > m_max_height ) ) continue;
+
+            size_t i2 = index2.sample_fitting( m_max_height - level1 , m_max_height - height1 , m_rng );
+            if( i2 == index2.size() ) continue;
+
+            n1 = index1.cursor( i1 );
+            n2 = index2.cursor( i2 );
+            return true;
+        }
+        return false;
+    }
+
+private:
+
+    Rng& m_rng;
+    size_t m_max_height;
+    double m_internal_node_favor_rate;
+    size_t m_max_iterations;
+};
+
+template< class Rng >
+height_constrained_crossover_strategy< Rng > make_height_constrained_crossover_strategy(
+    Rng& rng , size_t max_height , double internal_node_favor_rate = 0.0 , size_t max_iterations = 100 )
+{
+    return height_constrained_crossover_strategy< Rng >( rng , max_height , internal_node_favor_rate , max_iterations );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_HEIGHT_CONSTRAINED_CROSSOVER_STRATEGY_HPP_INCLUDED
@@ -0,0 +1,65 @@
+/*
+ * gpcxx/operator/hoist_mutation.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_HOIST_MUTATION_HPP_INCLUDED
+#define GPCXX_OPERATOR_HOIST_MUTATION_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/node_index.hpp>
+
+#include <random>
+
+namespace gpcxx {
+
+
+/**
+ * Replaces the tree by one of its proper subtrees, hence the tree always becomes smaller. The subtree is drawn
+ * uniformly from all nodes except the root. Its nodes are relinked with move_subtree, the remaining nodes are
+ * destroyed and nothing is copied. A tree with a single node is not changed.
+ */
+template< typename Rng >   // models RandomNumberEngine
+class hoist_mutation : public detail::operator_base< 1 >
+{
+public:
+
+    hoist_mutation( Rng &rng ) : m_rng( rng ) { }
+
+    template< class Tree >
+    void operator()( Tree &t )
+    {
+        typedef typename Tree::cursor cursor;
+
+        if( t.size() < 2 ) return;
+
+        auto& nodes = scratch_node_index< cursor >();
+        nodes.build( t );
+
+        std::uniform_int_distribution< size_t > dist( 1 , t.size() - 1 );
+        t.move_subtree( t.root() , nodes.cursor( dist( m_rng ) ) );
+    }
+
+private:
+
+    Rng &m_rng;
+};
+
+
+template< typename Rng >
+hoist_mutation< Rng > make_hoist_mutation( Rng &rng )
+{
+    return hoist_mutation< Rng >( rng );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_HOIST_MUTATION_HPP_INCLUDED
@@ -0,0 +1,113 @@
+/*
+ * gpcxx/operator/homologous_crossover_strategy.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_HOMOLOGOUS_CROSSOVER_STRATEGY_HPP_INCLUDED
+#define GPCXX_OPERATOR_HOMOLOGOUS_CROSSOVER_STRATEGY_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/cursor_equal.hpp>
+#include <gpcxx/tree/node_index.hpp>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Homologous one point crossover of Poli and Langdon. Both parents are overlaid starting at their roots, the common
+ * region consists of the root pair and the children of all pairs in the common region with the same arity. The
+ * crossover point is drawn uniformly from the common region and the subtrees at this position of both parents are
+ * swapped. Since both points are on the same level the offspring are not higher than the higher parent.
+ *
+ * The common region is built from the breadth first tables of node_index. Pairs which exceed max_height or have equal
+ * subtrees are redrawn up to max_iterations times.
+ */
+template< typename Rng >
+class homologous_crossover_strategy : public detail::operator_base< 2 >
+{
+public:
+
+    homologous_crossover_strategy( Rng& rng , size_t max_height , size_t max_iterations = 100 )
+    : m_rng( rng ) , m_max_height( max_height ) , m_max_iterations( max_iterations ) { }
+
+    template< class Tree >
+    bool operator()( Tree& t1 , Tree& t2 )
+    {
+        typename Tree::cursor n1 , n2;
+        if( ! select_points( t1 , t2 , n1 , n2 ) ) return false;
+        swap_subtrees( t1 , n1 , t2 , n2 );
+        return true;
+    }
+
+    /// Draws the crossover points without modifying the trees, Tree may be const.
+    template< class Tree , class Cursor >
+    bool select_points( Tree& t1 , Tree& t2 , Cursor& n1 , Cursor& n2 )
+    {
+        typedef Cursor cursor;
+
+        if( t1.empty() || t2.empty() ) return false;
+
+        auto& index1 = scratch_node_index< cursor , 0 >();
+        auto& index2 = scratch_node_index< cursor , 1 >();
+        index1.build( t1 );
+        index2.build( t2 );
+
+        // breadth first, the region itself is the queue
+        m_region.clear();
+        m_region.emplace_back( 0 , 0 );
+        for( size_t k=0 ; k<m_region.size() ; ++k )
+        {
+            size_t i1 = m_region[k].first , i2 = m_region[k].second;
+            if( index1.arity( i1 ) != index2.arity( i2 ) ) continue;
+            for( size_t j=0 ; j<index1.arity( i1 ) ; ++j )
+                m_region.emplace_back( index1.first_child( i1 ) + j , index2.first_child( i2 ) + j );
+        }
+
+        std::uniform_int_distribution< size_t > dist( 0 , m_region.size() - 1 );
+        for( size_t iter = 0 ; iter < m_max_iterations ; ++iter )
+        {
+            auto p = m_region[ dist( m_rng ) ];
+            if( ( index1.level( p.first ) + index2.height( p.second ) > m_max_height ) ||
+                ( index2.level( p.second ) + index1.height( p.first ) > m_max_height ) ) continue;
+
+            n1 = index1.cursor( p.first );
+            n2 = index2.cursor( p.second );
+            if( cursor_equal( n1 , n2 ) ) continue;
+            return true;
+        }
+        return false;
+    }
+
+    /// Number of node pairs in the common region of the last select_points call.
+    size_t common_region_size( void ) const { return m_region.size(); }
+
+private:
+
+    Rng& m_rng;
+    size_t m_max_height;
+    size_t m_max_iterations;
+    std::vector< std::pair< size_t , size_t > > m_region;
+};
+
+template< class Rng >
+homologous_crossover_strategy< Rng > make_homologous_crossover_strategy( Rng& rng , size_t max_height , size_t max_iterations = 100 )
+{
+    return homologous_crossover_strategy< Rng >( rng , max_height , max_iterations );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_HOMOLOGOUS_CROSSOVER_STRATEGY_HPP_INCLUDED
@@ -0,0 +1,288 @@
+/*
+ * gpcxx/operator/lexicase_selector.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_LEXICASE_SELECTOR_HPP_INCLUDED
+#define GPCXX_OPERATOR_LEXICASE_SELECTOR_HPP_INCLUDED
+
+#include <gpcxx/eval/error_matrix.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+namespace detail {
+
+inline size_t count_trailing_zeros( std::uint64_t w )
+{
+#if defined( __GNUC__ )
+    return size_t( __builtin_ctzll( w ) );
+#else
+    size_t n = 0;
+    while( ( w & 1u ) == 0 ) { w >>= 1; ++n; }
+    return n;
+#endif
+}
+
+} // namespace detail
+
+
+/**
+ * Epsilon lexicase selection (La Cava et al., "Epsilon-lexicase selection for regression", GECCO 2016). Every
+ * selection starts with the whole population as candidate pool and filters it case by case in random order. On every
+ * case only the candidates whose error is within epsilon of the best error of the pool survive. The selection stops
+ * as soon as one candidate is left or all cases are used, the winner is drawn uniformly from the remaining pool.
+ *
+ * epsilon is the median absolute deviation of the errors on the case. select() computes the epsilons and, for every
+ * case, a bitset of the individuals within epsilon of the best error of the population. The first filter step, which
+ * is the only one over the whole population, is therefore a scan over a bitset. The pool is kept as bitset too, cases
+ * on which a large pool survives completely are detected without touching the errors. The case order is shuffled lazily, only
+ * the cases which are actually used are drawn. Non-finite errors never survive a case unless all errors in the pool
+ * are non-finite, in which case the case is skipped.
+ */
+template< typename Rng >
+class epsilon_lexicase_selector
+{
+public:
+
+    using rng_type = Rng;
+
+    epsilon_lexicase_selector( rng_type& rng )
+    : m_rng( rng ) , m_epsilon() , m_pass() , m_words( 0 ) , m_order() , m_pool() , m_pool_bits() , m_scratch() { }
+
+    /// Draws the winners of n selections, the selections are independent of each other.
+    template< typename Value >
+    void select( error_matrix< Value > const& errors , size_t n , std::vector< size_t >& winners )
+    {
+        GPCXX_ASSERT( errors.individuals() > 0 );
+        prepare( errors );
+        winners.resize( n );
+        for( auto& w : winners ) w = select_one( errors );
+    }
+
+    std::vector< double > const& epsilons( void ) const { return m_epsilon; }
+
+private:
+
+    template< typename Value >
+    void prepare( error_matrix< Value > const& errors )
+    {
+        size_t individuals = errors.individuals();
+        size_t cases = errors.cases();
+        m_words = ( individuals + 63 ) / 64;
+        m_epsilon.resize( cases );
+        m_pass.assign( cases * m_words , 0 );
+
+        if( m_order.size() != cases )
+        {
+            m_order.resize( cases );
+            for( size_t c=0 ; c<cases ; ++c ) m_order[c] = c;
+        }
+
+        for( size_t c=0 ; c<cases ; ++c )
+        {
+            auto column = errors.column( c );
+            m_scratch.clear();
+            for( auto e : column )
+                if( std::isfinite( e ) ) m_scratch.push_back( double( e ) );
+
+            std::uint64_t* pass = m_pass.data() + c * m_words;
+            if( m_scratch.empty() )
+            {
+                m_epsilon[c] = 0.0;
+                for( size_t i=0 ; i<individuals ; ++i ) pass[ i / 64 ] |= std::uint64_t( 1 ) << ( i % 64 );
+                continue;
+            }
+
+            double best = *std::min_element( m_scratch.begin() , m_scratch.end() );
+            double med = median( m_scratch );
+            for( auto& e : m_scratch ) e = std::abs( e - med );
+            double eps = median( m_scratch );
+            m_epsilon[c] = eps;
+
+            double threshold = best + eps;
+            for( size_t i=0 ; i<individuals ; ++i )
+                pass[ i / 64 ] |= std::uint64_t( double( column[i] ) <= threshold ) << ( i % 64 );
+        }
+    }
+
+    template< typename Value >
+    size_t select_one( error_matrix< Value > const& errors )
+    {
+        size_t cases = errors.cases();
+        if( cases == 0 ) return uniform( 0 , errors.individuals() - 1 );
+
+        // first case: the survivors are precomputed
+        std::swap( m_order[0] , m_order[ uniform( 0 , cases - 1 ) ] );
+        std::uint64_t const* pass = m_pass.data() + m_order[0] * m_words;
+        m_pool_bits.assign( pass , pass + m_words );
+        m_pool.clear();
+        for( size_t w=0 ; w<m_words ; ++w )
+        {
+            for( std::uint64_t bits = pass[w] ; bits != 0 ; bits &= bits - 1 )
+                m_pool.push_back( w * 64 + detail::count_trailing_zeros( bits ) );
+        }
+
+        for( size_t step=1 ; ( step<cases ) && ( m_pool.size() > 1 ) ; ++step )
+        {
+            std::swap( m_order[step] , m_order[ uniform( step , cases - 1 ) ] );
+            size_t c = m_order[step];
+
+            // The threshold of the pool is at least the threshold of the population, hence a pool which lies
+            // completely within the precomputed survivors of the case survives completely.
+            if( ( m_pool.size() > m_words ) && is_subset( m_pool_bits.data() , m_pass.data() + c * m_words ) ) continue;
+
+            Value const* column = errors.column( c ).begin();
+
+            double best = std::numeric_limits< double >::infinity();
+            for( size_t i : m_pool )
+            {
+                double e = double( column[i] );
+                best = ( e < best ) ? e : best;
+            }
+            if( ! std::isfinite( best ) ) continue;
+
+            double threshold = best + m_epsilon[c];
+            auto& bits = m_pool_bits;
+            auto last = std::remove_if( m_pool.begin() , m_pool.end() , [column,threshold,&bits]( size_t i ) {
+                bool removed = !( double( column[i] ) <= threshold );
+                bits[ i / 64 ] &= ~( std::uint64_t( removed ) << ( i % 64 ) );
+                return removed; } );
+            m_pool.erase( last , m_pool.end() );
+        }
+
+        GPCXX_ASSERT( !m_pool.empty() );
+        return ( m_pool.size() == 1 ) ? m_pool[0] : m_pool[ uniform( 0 , m_pool.size() - 1 ) ];
+    }
+
+    bool is_subset( std::uint64_t const* pool , std::uint64_t const* pass ) const
+    {
+        std::uint64_t outside = 0;
+        for( size_t w=0 ; w<m_words ; ++w ) outside |= pool[w] & ~pass[w];
+        return outside == 0;
+    }
+
+    size_t uniform( size_t first , size_t last )
+    {
+        return std::uniform_int_distribution< size_t >( first , last )( m_rng );
+    }
+
+    static double median( std::vector< double >& v )
+    {
+        auto mid = v.begin() + v.size() / 2;
+        std::nth_element( v.begin() , mid , v.end() );
+        double m = *mid;
+        if( v.size() % 2 == 0 )
+            m = 0.5 * ( m + *std::max_element( v.begin() , mid ) );
+        return m;
+    }
+
+    rng_type& m_rng;
+    std::vector< double > m_epsilon;
+    std::vector< std::uint64_t > m_pass;
+    size_t m_words;
+    std::vector< size_t > m_order;
+    std::vector< size_t > m_pool;
+    std::vector< std::uint64_t > m_pool_bits;
+    std::vector< double > m_scratch;
+};
+
+
+
+/**
+ * Selector which hands out the winners of an epsilon_lexicase_selector on an error matrix. It can be used wherever a
+ * selector is expected, e.g. in mutation, crossover and reproduce of the pipelines, the fitness argument is ignored.
+ * Copies share the batch. A batch is drawn under the same conditions as for batched_tournament_selector, bind it to
+ * the selection_epoch() of the pipeline with set_epoch(). The error matrix has to be filled for the current population
+ * before the pipeline is called.
+ */
+template< typename Rng , typename Value = double >
+class lexicase_selector
+{
+public:
+
+    lexicase_selector( Rng& rng , error_matrix< Value > const& errors )
+    : m_state( std::make_shared< state >( rng , errors ) ) { }
+
+    template< typename Pop , typename Fitness >
+    typename Pop::const_iterator
+    operator()( Pop const& pop , Fitness const& ) const
+    {
+        GPCXX_ASSERT( pop.size() == m_state->errors.individuals() );
+        GPCXX_ASSERT( pop.size() > 0 );
+
+        state& s = *m_state;
+        if( ( s.position == s.winners.size() ) || ( s.winners.size() != pop.size() ) || ( s.epoch && ( *s.epoch != s.key ) ) )
+        {
+            s.selector.select( s.errors , pop.size() , s.winners );
+            s.position = 0;
+            if( s.epoch ) s.key = *s.epoch;
+        }
+        return std::next( std::begin( pop ) , s.winners[ s.position++ ] );
+    }
+
+    /// Forces a new batch at the next selection, call it if the population or the errors have changed.
+    void invalidate( void )
+    {
+        m_state->position = m_state->winners.size();
+    }
+
+    /// Draws a new batch whenever epoch changes, e.g. pipeline.selection_epoch(). The counter must outlive the selector.
+    void set_epoch( size_t const& epoch )
+    {
+        m_state->epoch = &epoch;
+        invalidate();
+    }
+
+    epsilon_lexicase_selector< Rng > const& selector( void ) const
+    {
+        return m_state->selector;
+    }
+
+private:
+
+    struct state
+    {
+        state( Rng& rng , error_matrix< Value > const& e )
+        : selector( rng ) , errors( e ) , winners() , position( 0 ) , epoch( nullptr ) , key( 0 ) { }
+
+        epsilon_lexicase_selector< Rng > selector;
+        error_matrix< Value > const& errors;
+        std::vector< size_t > winners;
+        size_t position;
+        size_t const* epoch;
+        size_t key;
+    };
+
+    std::shared_ptr< state > m_state;
+};
+
+template< typename Rng , typename Value >
+lexicase_selector< Rng , Value > make_lexicase_selector( Rng& rng , error_matrix< Value > const& errors )
+{
+    return lexicase_selector< Rng , Value >( rng , errors );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_LEXICASE_SELECTOR_HPP_INCLUDED
@@ -16,6 +16,7 @@
 #include <gpcxx/operator/detail/operator_base.hpp>
 #include <gpcxx/util/assert.hpp>
 
+#include <array>
 #include <utility>
 #include <vector>
 #include <random>
@@ -41,16 +42,32 @@ public:
         return operation( sel );
     }
     
+    template< typename Pop , typename Fitness , typename OutputIterator >
+    OutputIterator operator()( Pop const& pop , Fitness const& fitness , OutputIterator first , OutputIterator last )
+    {
+        std::array< typename Pop::const_iterator , 2 > sel;
+        selection( pop , fitness , sel );
+        return operation( sel , first , last );
+    }
+    
     template< typename Pop , typename Fitness >
     std::vector< typename Pop::const_iterator >
     selection( Pop const& pop , Fitness const& fitness )
     {
-        GPCXX_ASSERT( pop.size() > 2 );
         std::vector< typename Pop::const_iterator > s(2);
+        selection( pop , fitness , s );
+        return s;
+    }
+    
+    /// Selects two different parents into s, which must hold two elements.
+    template< typename Pop , typename Fitness , typename Selection >
+    void selection( Pop const& pop , Fitness const& fitness , Selection& s )
+    {
+        GPCXX_ASSERT( pop.size() > 2 );
+        GPCXX_ASSERT( s.size() == 2 );
         s[1] = s[0] = m_selector( pop , fitness );
         while( s[0] == s[1] )
             s[1] = m_selector( pop , fitness );
-        return s;
     }
     
     template< typename Selection >
@@ -61,18 +78,49 @@ public:
         std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type > nodes( 2 );
         nodes[ 0 ] = *( selection[0] );
         nodes[ 1 ] = *( selection[1] );
-        GPCXX_ASSERT( nodes[ 0 ].size() == nodes[ 1 ].size() );
-        std::uniform_int_distribution< size_t > dist( 0 , nodes[0].size() - 1 );
+        apply( nodes[0] , nodes[1] );
+        return nodes;
+    }
+    
+    /// Assigns the offspring to the slots [first,last) and returns the end of the written range. If only one slot is
+    /// left, the second offspring is discarded.
+    template< typename Selection , typename OutputIterator >
+    OutputIterator operation( Selection const& selection , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( selection.size() == 2 );
+        GPCXX_ASSERT( first != last );
+        auto& ind1 = *first;
+        ind1 = *( selection[0] );
+        ++first;
+        if( first != last )
+        {
+            auto& ind2 = *first;
+            ind2 = *( selection[1] );
+            ++first;
+            apply( ind1 , ind2 );
+        }
+        else
+        {
+            auto ind2 = *( selection[1] );
+            apply( ind1 , ind2 );
+        }
+        return first;
+    }
+    
+private:
+    
+    template< typename Individual >
+    void apply( Individual& ind1 , Individual& ind2 )
+    {
+        GPCXX_ASSERT( ind1.size() == ind2.size() );
+        std::uniform_int_distribution< size_t > dist( 0 , ind1.size() - 1 );
         auto index1 = dist( m_rng );
         auto index2 = dist( m_rng );
-        auto& tree1 = nodes[ 0 ][ index1 ];
-        auto& tree2 = nodes[ 1 ][ index2 ];
+        auto& tree1 = ind1[ index1 ];
+        auto& tree2 = ind2[ index2 ];
         if( ( ! tree1.empty() ) && ( ! tree2.empty() ) )
             m_strategy( tree1 , tree2 );
-        return nodes;
     }
-    
-private:
 
     Rng& m_rng;    
     Strategy m_strategy;
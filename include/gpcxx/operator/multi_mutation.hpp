@@ -37,23 +37,37 @@ public:
     {
         std::vector< typename Pop::value_type > nodes( 1 );
         nodes[0] = *( m_selector( pop , fitness ) );
-        std::uniform_int_distribution< size_t > dist( 0 , nodes[0].size() - 1 );
-        auto component_index = dist( m_rng );
-        auto &tree = nodes[0][component_index];
-        if( ! tree.empty() )
-            m_strategy( tree );
+        apply( nodes[0] );
         return nodes;
     }
     
+    template< typename Pop , typename Fitness , typename OutputIterator >
+    OutputIterator operator()( Pop const& pop , Fitness const& fitness , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( first != last );
+        auto& ind = *first;
+        ind = *( m_selector( pop , fitness ) );
+        apply( ind );
+        return ++first;
+    }
+    
     template< typename Pop , typename Fitness >
     std::vector< typename Pop::const_iterator >
     selection( Pop const& pop , Fitness const& fitness )
     {
         std::vector< typename Pop::const_iterator > s( 1 );
-        s[0] = m_selector( pop , fitness );
+        selection( pop , fitness , s );
         return s;
     }
     
+    /// Selects the parent into s, which must hold one element.
+    template< typename Pop , typename Fitness , typename Selection >
+    void selection( Pop const& pop , Fitness const& fitness , Selection& s )
+    {
+        GPCXX_ASSERT( s.size() == 1 );
+        s[0] = m_selector( pop , fitness );
+    }
+    
     template< typename Selection >
     std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type >
     operation( Selection const& selection )
@@ -61,17 +75,35 @@ public:
         GPCXX_ASSERT( selection.size() == 1 );
         std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type > nodes( 1 );
         nodes[ 0 ] = *( selection[0] );
-        std::uniform_int_distribution< size_t > dist( 0 , nodes[0].size() - 1 );
-        auto component_index = dist( m_rng );
-        auto& tree = nodes[0][component_index];
-        if( ! tree.empty() )
-            m_strategy( tree );
+        apply( nodes[0] );
         return nodes;
     }
+    
+    /// Assigns the mutated individual to the slot first and returns the end of the written range.
+    template< typename Selection , typename OutputIterator >
+    OutputIterator operation( Selection const& selection , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( selection.size() == 1 );
+        GPCXX_ASSERT( first != last );
+        auto& ind = *first;
+        ind = *( selection[0] );
+        apply( ind );
+        return ++first;
+    }
 
 
 private:
     
+    template< typename Individual >
+    void apply( Individual& ind )
+    {
+        std::uniform_int_distribution< size_t > dist( 0 , ind.size() - 1 );
+        auto component_index = dist( m_rng );
+        auto& tree = ind[component_index];
+        if( ! tree.empty() )
+            m_strategy( tree );
+    }
+    
     Rng& m_rng;
     Strategy m_strategy;
     Selector m_selector;
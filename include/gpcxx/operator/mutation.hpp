@@ -36,15 +36,34 @@ public:
         return nodes;
     }
     
+    template< typename Pop , typename Fitness , typename OutputIterator >
+    OutputIterator operator()( Pop const& pop , Fitness const& fitness , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( first != last );
+        auto& ind = *first;
+        ind = *( m_selector( pop , fitness ) );
+        if( ! ind.empty() )
+            m_strategy( ind );
+        return ++first;
+    }
+    
     template< typename Pop , typename Fitness >
     std::vector< typename Pop::const_iterator >
     selection( Pop const& pop , Fitness const& fitness )
     {
         std::vector< typename Pop::const_iterator > s( 1 );
-        s[0] = m_selector( pop , fitness );
+        selection( pop , fitness , s );
         return s;
     }
     
+    /// Selects the parent into s, which must hold one element.
+    template< typename Pop , typename Fitness , typename Selection >
+    void selection( Pop const& pop , Fitness const& fitness , Selection& s )
+    {
+        GPCXX_ASSERT( s.size() == 1 );
+        s[0] = m_selector( pop , fitness );
+    }
+    
     template< typename Selection >
     std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type >
     operation( Selection const& selection )
@@ -56,6 +75,19 @@ public:
             m_strategy( nodes[0] );
         return nodes;
     }
+    
+    /// Assigns the mutated individual to the slot first and returns the end of the written range.
+    template< typename Selection , typename OutputIterator >
+    OutputIterator operation( Selection const& selection , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( selection.size() == 1 );
+        GPCXX_ASSERT( first != last );
+        auto& ind = *first;
+        ind = *( selection[0] );
+        if( ! ind.empty() )
+            m_strategy( ind );
+        return ++first;
+    }
 
 
 private:
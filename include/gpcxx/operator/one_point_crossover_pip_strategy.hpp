@@ -10,6 +10,7 @@
 
 
 #include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/node_index.hpp>
 
 #include <random>
 #include <stdexcept>
@@ -30,21 +31,6 @@ namespace gpcxx {
                 : m_rng( rng ) , m_max_height( max_height ) , m_max_iterations( max_iterations ) , m_internal_node_favor_rate ( internal_node_favor_rate ) { }
 
 
-        template< class Cursor >
-        void seperate_nodes( Cursor c , std::vector< Cursor > & internal, std::vector< Cursor > & terminal)
-        {
-            if( c.size() > 1 )
-            {
-                internal.emplace_back( c );
-                for( size_t i = 0 ; i < c.size() ; ++i )
-                    seperate_nodes( c.children( i ) , internal , terminal );
-            }
-            else
-            {
-                terminal.emplace_back( c );
-            }
-        }
-
         template< class Tree >
         bool operator()( Tree & t1 , Tree & t2 )
         {
@@ -54,43 +40,44 @@ namespace gpcxx {
             size_t const n_trees = sizeof( trees ) / sizeof( trees[ 0 ] );
 
             std::uniform_real_distribution< double > internal_node_favor_dist( 0.0 , 1.0 );
-            std::vector< cursor > selectable_nodes[ n_trees ];
-            std::uniform_int_distribution< size_t > dist[ n_trees ];
+            node_index< cursor >* indices[] = { &scratch_node_index< cursor , 0 >() , &scratch_node_index< cursor , 1 >() };
+            typename node_index< cursor >::index_range selectable_nodes[ n_trees ];
             for( size_t i = 0 ; i < n_trees; ++i )
             {
-                std::vector< cursor > internel_nodes , terminal_nodes;
-
-                seperate_nodes( trees[ i ]->root() , internel_nodes , terminal_nodes );
+                indices[ i ]->build( *( trees[ i ] ) );
 
+                // nodes with at least two children count as internal nodes
+                auto internal_nodes = indices[ i ]->with_arity_at_least( 2 );
                 bool select_internal_node = internal_node_favor_dist( m_rng ) <= m_internal_node_favor_rate;
-                if( select_internal_node and not internel_nodes.empty() )
-                    selectable_nodes[ i ] = std::move ( internel_nodes );
+                if( select_internal_node and not internal_nodes.empty() )
+                    selectable_nodes[ i ] = internal_nodes;
                 else
-                    selectable_nodes[ i ] = std::move ( terminal_nodes );
-
-                dist[ i ] = std::uniform_int_distribution< size_t >( 0 , selectable_nodes[ i ].size() - 1 );
+                    selectable_nodes[ i ] = indices[ i ]->with_arity_at_most( 1 );
             }
 
 
             bool good = true;
             size_t iteration = 0;
-            cursor cur[ n_trees ];
+            size_t index[ n_trees ];
             do
             {
                 for( size_t i = 0 ; i < n_trees; ++i )
-                    cur[ i ] = selectable_nodes[ i ][ dist[ i ]( m_rng ) ];
+                    index[ i ] = node_index< cursor >::sample( selectable_nodes[ i ] , m_rng );
 
-                size_t new_height[] = {  cur[ 0 ].level() + cur[ 1 ].height() - 1 , cur[ 1 ].level() + cur[ 0 ].height() - 1 };
+                size_t new_height[] = {
+                    indices[ 0 ]->level( index[ 0 ] ) + indices[ 1 ]->height( index[ 1 ] ) - 1 ,
+                    indices[ 1 ]->level( index[ 1 ] ) + indices[ 0 ]->height( index[ 0 ] ) - 1 };
 
                 good = true;
                 for( size_t i = 0 ; i < n_trees; ++i )
                     good = good && ( new_height[i] <= m_max_height );
+                ++iteration;
             }
             while( not good and ( iteration < m_max_iterations ) );
 
             if( good )
             {
-                swap_subtrees( *( trees[ 0 ] ) , cur[ 0 ] , *( trees[ 1 ] ) , cur[ 1 ] );
+                swap_subtrees( *( trees[ 0 ] ) , indices[ 0 ]->cursor( index[ 0 ] ) , *( trees[ 1 ] ) , indices[ 1 ]->cursor( index[ 1 ] ) );
                 return true;
             }
             else
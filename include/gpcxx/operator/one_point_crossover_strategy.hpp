@@ -9,6 +9,7 @@
 
 #include <gpcxx/operator/detail/operator_base.hpp>
 #include <gpcxx/tree/cursor_equal.hpp>
+#include <gpcxx/tree/node_index.hpp>
 
 #include <random>
 #include <stdexcept>
@@ -30,25 +31,43 @@ public:
     template< class Tree >
     bool operator()( Tree &t1 , Tree &t2 )
     {
-        typedef typename Tree::cursor cursor;
+        typename Tree::cursor n1 , n2;
+        if( ! select_points( t1 , t2 , n1 , n2 ) ) return false;
+        swap_subtrees( t1 , n1 , t2 , n2 );
+        return true;
+    }
+
+    /// Draws the crossover points without modifying the trees, Tree may be const.
+    template< class Tree , class Cursor >
+    bool select_points( Tree &t1 , Tree &t2 , Cursor &n1 , Cursor &n2 )
+    {
+        typedef Cursor cursor;
+
+        // levels and heights are looked up instead of walking the trees for every trial, the index is rebuilt in O(n)
+        // per call
+        auto& index1 = scratch_node_index< cursor , 0 >();
+        auto& index2 = scratch_node_index< cursor , 1 >();
+        index1.build( t1 );
+        index2.build( t2 );
 
         std::uniform_int_distribution< size_t > dist1( 0 , t1.size() - 1 );
         std::uniform_int_distribution< size_t > dist2( 0 , t2.size() - 1 );
 
         for( size_t iter = 0 ; iter < m_max_iterations ; ++iter )
         {
-            cursor n1 = t1.rank_is( dist1( m_rng ) );
-            cursor n2 = t2.rank_is( dist2( m_rng ) );
+            size_t i1 = dist1( m_rng );
+            size_t i2 = dist2( m_rng );
+            n1 = index1.cursor( i1 );
+            n2 = index2.cursor( i2 );
             if( cursor_equal( n1 , n2 ) )
             {
                 continue;
             }
 
-            size_t nh1 = n1.level() + n2.height();
-            size_t nh2 = n2.level() + n1.height();
+            size_t nh1 = index1.level( i1 ) + index2.height( i2 );
+            size_t nh2 = index2.level( i2 ) + index1.height( i1 );
             if( ( nh1 <= m_max_height ) && ( nh2 <= m_max_height ) )
             {
-                swap_subtrees( t1 , n1 , t2 , n2 );
                 return true;
             }
         }
@@ -13,12 +13,37 @@
 #define GPCXX_OPERATOR_POINT_MUTATION_HPP_INCLUDED
 
 #include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/node_index.hpp>
 
 #include <random>
+#include <type_traits>
+#include <utility>
 
 namespace gpcxx {
 
+namespace detail {
+
+// true if the tree generator can be called with a maximal height, like ramp and basic_generate_strategy
+template< typename TreeGenerator , typename Tree , typename = void >
+struct accepts_height_budget : std::false_type { };
+
+template< typename TreeGenerator , typename Tree >
+struct accepts_height_budget< TreeGenerator , Tree ,
+    decltype( void( std::declval< TreeGenerator& >()( std::declval< Tree& >() , size_t( 0 ) ) ) ) > : std::true_type { };
+
+} // namespace detail
+
     
+/**
+ * Replaces a random subtree by a newly generated one, such that the height of the tree stays below max_height.
+ *
+ * If the tree generator accepts a maximal height ( gen( tree , max_height ) ) the node is chosen first and the
+ * replacement is generated with the remaining height budget, hence no generated subtree is rejected. Only nodes
+ * at level max_height or below are skipped. Otherwise random subtrees are generated until one fits, at most
+ * max_trials times.
+ *
+ * The nodes are drawn from a scratch_node_index which is rebuilt in O(n) on every call.
+ */
 template< typename Rng             // models RandomNumberEngine
         , typename TreeGenerator   // models TreeGenerator
         >
@@ -36,20 +61,47 @@ public:
         typedef typename Tree::cursor cursor;
 
         if( t.empty() ) return;
+
+        auto& nodes = scratch_node_index< cursor >();
+        nodes.build( t );
+
+        mutate( t , nodes , detail::accepts_height_budget< TreeGenerator , Tree >() );
+    }
+    
+private:
+
+    template< class Tree , class Index >
+    void mutate( Tree &t , Index const& nodes , std::true_type )
+    {
         std::uniform_int_distribution< size_t > dist( 0 , t.size() - 1 );
+        for( size_t count = 0 ; count < m_max_trials ; ++count )
+        {
+            size_t index = dist( m_rng );
+            size_t level = nodes.level( index );
+            if( level >= m_max_height ) continue;
+
+            Tree new_subtree;
+            m_gen( new_subtree , m_max_height - level );
+            t.swap_subtrees( nodes.cursor( index ) , new_subtree , new_subtree.root() );
+            return;
+        }
+    }
 
+    template< class Tree , class Index >
+    void mutate( Tree &t , Index const& nodes , std::false_type )
+    {
+        std::uniform_int_distribution< size_t > dist( 0 , t.size() - 1 );
         size_t count = 0;
         do
         {
             size_t index = dist( m_rng );
-            cursor n = t.rank_is( index );
 
             Tree new_subtree;
             m_gen( new_subtree );
 
-            if( ( n.level() + new_subtree.root().height() ) <= m_max_height )
+            if( ( nodes.level( index ) + new_subtree.root().height() ) <= m_max_height )
             {
-                t.swap_subtrees( n , new_subtree , new_subtree.root() );
+                t.swap_subtrees( nodes.cursor( index ) , new_subtree , new_subtree.root() );
                 break;
             }
             ++count;
@@ -57,8 +109,6 @@ public:
         while( count < m_max_trials );
     }
     
-private:
-    
     Rng &m_rng;
     TreeGenerator &m_gen;
     size_t m_max_height;
@@ -0,0 +1,74 @@
+/*
+ * gpcxx/operator/shrink_mutation.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_SHRINK_MUTATION_HPP_INCLUDED
+#define GPCXX_OPERATOR_SHRINK_MUTATION_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/node_index.hpp>
+
+#include <random>
+
+namespace gpcxx {
+
+
+/**
+ * Replaces a subtree by a terminal, hence the tree always becomes smaller. The root of the subtree is drawn uniformly
+ * from the non-terminals, the terminal is one of its own leaves found by a random walk down the children. The leaf is
+ * relinked with move_subtree, no node is generated or copied. A tree without non-terminals is not changed.
+ */
+template< typename Rng >   // models RandomNumberEngine
+class shrink_mutation : public detail::operator_base< 1 >
+{
+public:
+
+    shrink_mutation( Rng &rng ) : m_rng( rng ) { }
+
+    template< class Tree >
+    void operator()( Tree &t )
+    {
+        typedef typename Tree::cursor cursor;
+
+        if( t.size() < 2 ) return;
+
+        auto& nodes = scratch_node_index< cursor >();
+        nodes.build( t );
+
+        auto functions = nodes.functions();
+        std::uniform_int_distribution< size_t > dist( 0 , functions.size() - 1 );
+        cursor position = nodes.cursor( functions[ dist( m_rng ) ] );
+
+        cursor leaf = position;
+        while( leaf.size() > 0 )
+        {
+            std::uniform_int_distribution< size_t > child_dist( 0 , leaf.size() - 1 );
+            leaf = leaf.children( child_dist( m_rng ) );
+        }
+        t.move_subtree( position , leaf );
+    }
+
+private:
+
+    Rng &m_rng;
+};
+
+
+template< typename Rng >
+shrink_mutation< Rng > make_shrink_mutation( Rng &rng )
+{
+    return shrink_mutation< Rng >( rng );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_SHRINK_MUTATION_HPP_INCLUDED
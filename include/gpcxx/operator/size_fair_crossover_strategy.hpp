@@ -0,0 +1,129 @@
+/*
+ * gpcxx/operator/size_fair_crossover_strategy.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_SIZE_FAIR_CROSSOVER_STRATEGY_HPP_INCLUDED
+#define GPCXX_OPERATOR_SIZE_FAIR_CROSSOVER_STRATEGY_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/tree/cursor_equal.hpp>
+#include <gpcxx/tree/node_index.hpp>
+
+#include <algorithm>
+#include <random>
+
+
+namespace gpcxx {
+
+
+/**
+ * Size fair crossover after Langdon. The first point is drawn uniformly from t1, let s be the size of its subtree.
+ * The second subtree is drawn from the subtrees of t2 with at most 1 + 2 s nodes, which are split into the smaller, the
+ * equally sized and the larger ones. A subtree of equal size is chosen with probability 1 / s, the remaining probability
+ * is divided between the smaller and the larger ones such that the mean size change of the offspring is zero. If t2 has
+ * no smaller or no larger candidates a subtree of the same size is chosen, if there is none the other side is used.
+ * Within the chosen class all subtrees are equally likely.
+ *
+ * The subtree sizes are taken from node_index, the classes are contiguous ranges of its size groups. Pairs for which
+ * an offspring exceeds max_height or the subtrees are equal are redrawn up to max_iterations times.
+ */
+template< typename Rng >
+class size_fair_crossover_strategy : public detail::operator_base< 2 >
+{
+public:
+
+    size_fair_crossover_strategy( Rng& rng , size_t max_height , size_t max_iterations = 100 )
+    : m_rng( rng ) , m_max_height( max_height ) , m_max_iterations( max_iterations ) { }
+
+    template< class Tree >
+    bool operator()( Tree& t1 , Tree& t2 )
+    {
+        typename Tree::cursor n1 , n2;
+        if( ! select_points( t1 , t2 , n1 , n2 ) ) return false;
+        swap_subtrees( t1 , n1 , t2 , n2 );
+        return true;
+    }
+
+    /// Draws the crossover points without modifying the trees, Tree may be const.
+    template< class Tree , class Cursor >
+    bool select_points( Tree& t1 , Tree& t2 , Cursor& n1 , Cursor& n2 )
+    {
+        typedef Cursor cursor;
+
+        if( t1.empty() || t2.empty() ) return false;
+
+        auto& index1 = scratch_node_index< cursor , 0 >();
+        auto& index2 = scratch_node_index< cursor , 1 >();
+        index1.build( t1 );
+        index2.build( t2 );
+
+        for( size_t iter = 0 ; iter < m_max_iterations ; ++iter )
+        {
+            size_t i1 = index1.sample( m_rng );
+            size_t i2 = partner( index2 , index1.subtree_size( i1 ) );
+
+            if( ( index1.level( i1 ) + index2.height( i2 ) > m_max_height ) ||
+                ( index2.level( i2 ) + index1.height( i1 ) > m_max_height ) ) continue;
+
+            n1 = index1.cursor( i1 );
+            n2 = index2.cursor( i2 );
+            if( cursor_equal( n1 , n2 ) ) continue;
+            return true;
+        }
+        return false;
+    }
+
+private:
+
+    template< class Index >
+    size_t partner( Index const& index , size_t s )
+    {
+        size_t max_size = std::min( 1 + 2 * s , index.size() );
+        auto smaller = index.with_subtree_size_between( 1 , s - 1 );
+        auto equal = index.with_subtree_size( s );
+        auto larger = index.with_subtree_size_between( s + 1 , max_size );
+
+        if( smaller.empty() || larger.empty() )
+        {
+            if( ! equal.empty() ) return Index::sample( equal , m_rng );
+            return Index::sample( smaller.empty() ? larger : smaller , m_rng );
+        }
+
+        // mean sizes of the smaller and the larger subtrees, the sizes of a class are looked up in the size groups
+        double sum_smaller = 0.0 , sum_larger = 0.0;
+        for( size_t k=1 ; k<s ; ++k ) sum_smaller += double( k * index.with_subtree_size( k ).size() );
+        for( size_t k=s+1 ; k<=max_size ; ++k ) sum_larger += double( k * index.with_subtree_size( k ).size() );
+        double below = double( s ) - sum_smaller / double( smaller.size() );
+        double above = sum_larger / double( larger.size() ) - double( s );
+
+        double p_equal = equal.empty() ? 0.0 : 1.0 / double( s );
+        double p_smaller = ( 1.0 - p_equal ) * above / ( above + below );
+        double r = std::uniform_real_distribution< double >( 0.0 , 1.0 )( m_rng );
+        if( r < p_equal ) return Index::sample( equal , m_rng );
+        if( r < p_equal + p_smaller ) return Index::sample( smaller , m_rng );
+        return Index::sample( larger , m_rng );
+    }
+
+    Rng& m_rng;
+    size_t m_max_height;
+    size_t m_max_iterations;
+};
+
+template< class Rng >
+size_fair_crossover_strategy< Rng > make_size_fair_crossover_strategy( Rng& rng , size_t max_height , size_t max_iterations = 100 )
+{
+    return size_fair_crossover_strategy< Rng >( rng , max_height , max_iterations );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_SIZE_FAIR_CROSSOVER_STRATEGY_HPP_INCLUDED
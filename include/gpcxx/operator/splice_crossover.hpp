@@ -0,0 +1,157 @@
+/*
+ * gpcxx/operator/splice_crossover.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_OPERATOR_SPLICE_CROSSOVER_HPP_INCLUDED
+#define GPCXX_OPERATOR_SPLICE_CROSSOVER_HPP_INCLUDED
+
+#include <gpcxx/operator/detail/operator_base.hpp>
+#include <gpcxx/util/assert.hpp>
+
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+namespace detail {
+
+/// Copies the subtree src below position, the subtree cut of src is replaced by a copy of replacement.
+template< typename Tree , typename InputCursor >
+void splice_copy( Tree& out , typename Tree::cursor position , InputCursor src , InputCursor cut , InputCursor replacement )
+{
+    if( src == cut )
+    {
+        out.insert_below( position , replacement );
+        return;
+    }
+    auto p = out.insert_below( position , *src );
+    for( InputCursor c = src.begin() ; c != src.end() ; ++c )
+        splice_copy( out , p , c , cut , replacement );
+}
+
+/// out becomes a copy of t with the subtree cut replaced by the subtree replacement.
+template< typename Tree , typename InputCursor >
+void splice_tree( Tree& out , Tree const& t , InputCursor cut , InputCursor replacement )
+{
+    out.clear();
+    splice_copy( out , out.root() , t.root() , cut , replacement );
+}
+
+} // namespace detail
+
+
+/**
+ * Crossover which builds the offspring directly from the parents. The strategy only draws the crossover points on the
+ * const parents, it must provide select_points( t1 , t2 , c1 , c2 ) like one_point_crossover_strategy and
+ * height_constrained_crossover_strategy. Then every offspring is assembled in its slot by copying the nodes of one
+ * parent outside of its crossover point and the subtree of the other parent, hence every node is copied once instead
+ * of copying both parents and swapping the subtrees. If only one slot is left, the second offspring is not built at
+ * all. If no crossover points are found the offspring are copies of the parents, as for crossover.
+ *
+ * The offspring are the same as the ones of crossover with the same strategy and the same random numbers.
+ */
+template< typename Strategy , typename Selector >
+class splice_crossover : public detail::operator_base< 2 >
+{
+public:
+
+    splice_crossover( Strategy strategy , Selector selector )
+    : m_strategy( std::move( strategy ) ) , m_selector( std::move( selector ) ) { }
+
+    template< typename Pop , typename Fitness >
+    std::vector< typename Pop::value_type >
+    operator()( Pop const& pop , Fitness const& fitness )
+    {
+        auto sel = selection( pop , fitness );
+        return operation( sel );
+    }
+
+    template< typename Pop , typename Fitness , typename OutputIterator >
+    OutputIterator operator()( Pop const& pop , Fitness const& fitness , OutputIterator first , OutputIterator last )
+    {
+        std::array< typename Pop::const_iterator , 2 > sel;
+        selection( pop , fitness , sel );
+        return operation( sel , first , last );
+    }
+
+    template< typename Pop , typename Fitness >
+    std::vector< typename Pop::const_iterator >
+    selection( Pop const& pop , Fitness const& fitness )
+    {
+        std::vector< typename Pop::const_iterator > s(2);
+        selection( pop , fitness , s );
+        return s;
+    }
+
+    /// Selects two different parents into s, which must hold two elements.
+    template< typename Pop , typename Fitness , typename Selection >
+    void selection( Pop const& pop , Fitness const& fitness , Selection& s )
+    {
+        GPCXX_ASSERT( pop.size() > 2 );
+        GPCXX_ASSERT( s.size() == 2 );
+        s[1] = s[0] = m_selector( pop , fitness );
+        while( s[0] == s[1] )
+            s[1] = m_selector( pop , fitness );
+    }
+
+    template< typename Selection >
+    std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type >
+    operation( Selection const& selection )
+    {
+        std::vector< typename std::iterator_traits< typename Selection::value_type >::value_type > nodes( 2 );
+        operation( selection , nodes.begin() , nodes.end() );
+        return nodes;
+    }
+
+    /// Builds the offspring in the slots [first,last) and returns the end of the written range.
+    template< typename Selection , typename OutputIterator >
+    OutputIterator operation( Selection const& selection , OutputIterator first , OutputIterator last )
+    {
+        GPCXX_ASSERT( selection.size() == 2 );
+        GPCXX_ASSERT( first != last );
+
+        auto const& t1 = *( selection[0] );
+        auto const& t2 = *( selection[1] );
+        typename std::decay< decltype( t1 ) >::type::const_cursor c1 , c2;
+        bool found = ( ! t1.empty() ) && ( ! t2.empty() ) && m_strategy.select_points( t1 , t2 , c1 , c2 );
+
+        if( found ) detail::splice_tree( *first , t1 , c1 , c2 );
+        else *first = t1;
+        ++first;
+        if( first != last )
+        {
+            if( found ) detail::splice_tree( *first , t2 , c2 , c1 );
+            else *first = t2;
+            ++first;
+        }
+        return first;
+    }
+
+private:
+
+    Strategy m_strategy;
+    Selector m_selector;
+};
+
+template< typename Strategy , typename Selector >
+splice_crossover< Strategy , Selector > make_splice_crossover( Strategy strategy , Selector selector )
+{
+    return splice_crossover< Strategy , Selector >( std::move( strategy ) , std::move( selector ) );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_OPERATOR_SPLICE_CROSSOVER_HPP_INCLUDED
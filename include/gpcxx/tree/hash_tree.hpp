@@ -0,0 +1,106 @@
+/*
+ * gpcxx/tree/hash_tree.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_TREE_HASH_TREE_HPP_INCLUDED
+#define GPCXX_TREE_HASH_TREE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+
+namespace gpcxx {
+
+namespace detail {
+
+inline std::uint64_t hash_mix( std::uint64_t h )
+{
+    // finalizer of splitmix64
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+inline std::uint64_t hash_combine( std::uint64_t seed , std::uint64_t h )
+{
+    return hash_mix( seed ^ ( h + 0x9e3779b97f4a7c15ull + ( seed << 6 ) + ( seed >> 2 ) ) );
+}
+
+struct node_hash_impl
+{
+    // nodes which know if they are constant, like algebraic_node. The name of a constant is usually rounded, hence the
+    // value is hashed too.
+    template< typename Node >
+    static auto apply( Node const& n , int ) -> decltype( n.constant() , std::hash< std::string >()( n.name() ) )
+    {
+        size_t h = std::hash< std::string >()( n.name() );
+        if( ! n.constant() ) return h;
+        typename Node::context_type context {};
+        return size_t( hash_combine( h , std::hash< typename Node::result_type >()( n.eval( context ) ) ) );
+    }
+
+    // nodes with a name, like the intrusive named nodes
+    template< typename Node >
+    static auto apply( Node const& n , long ) -> decltype( std::hash< std::string >()( n.name() ) )
+    {
+        return std::hash< std::string >()( n.name() );
+    }
+
+    template< typename Node >
+    static size_t apply( Node const& n , ... )
+    {
+        return std::hash< Node >()( n );
+    }
+};
+
+} // namespace detail
+
+
+/// Hash of a single node. Uses the name of the node if it has one and std::hash otherwise. Constants of nodes with
+/// constant() are also hashed by their value.
+struct node_hash
+{
+    template< typename Node >
+    size_t operator()( Node const& n ) const
+    {
+        return detail::node_hash_impl::apply( n , 0 );
+    }
+};
+
+
+/// Structural hash of the subtree at cursor c. Equal subtrees in the sense of cursor_equal have equal hashes if equal
+/// nodes have equal node hashes. The order of the children matters.
+template< typename Cursor , typename NodeHash = node_hash >
+std::uint64_t hash_cursor( Cursor const& c , NodeHash node_hash_f = NodeHash() )
+{
+    std::uint64_t h = detail::hash_combine( std::uint64_t( node_hash_f( *c ) ) , std::uint64_t( c.size() ) );
+    for( size_t i=0 ; i<c.size() ; ++i )
+        h = detail::hash_combine( h , hash_cursor( c.children( i ) , node_hash_f ) );
+    return h;
+}
+
+template< typename Tree , typename NodeHash = node_hash >
+std::uint64_t hash_tree( Tree const& t , NodeHash node_hash_f = NodeHash() )
+{
+    if( t.empty() ) return 0;
+    return hash_cursor( t.root() , node_hash_f );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_TREE_HASH_TREE_HPP_INCLUDED
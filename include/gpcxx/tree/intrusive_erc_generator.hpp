@@ -12,11 +12,36 @@
 #ifndef GPCXX_TREE_INTRUSIVE_ERC_GENERATOR_HPP_INCLUDED
 #define GPCXX_TREE_INTRUSIVE_ERC_GENERATOR_HPP_INCLUDED
 
+#include <limits>
+#include <sstream>
 #include <string>
 
 
 namespace gpcxx {
 
+namespace detail {
+
+// Shortest name which reads back as x, such that distinct constants have distinct names.
+template< typename T >
+std::string erc_name( T x )
+{
+    std::string name;
+    for( int precision = std::numeric_limits< T >::digits10 ; ; ++precision )
+    {
+        std::ostringstream str;
+        str.precision( precision );
+        str << x;
+        name = str.str();
+        std::istringstream in( name );
+        T y {};
+        in >> y;
+        if( ( y == x ) || ( precision >= std::numeric_limits< T >::max_digits10 ) ) break;
+    }
+    return name;
+}
+
+} // namespace detail
+
 
 template< typename Value , typename Dist >
 struct intrusive_erc_generator
@@ -30,7 +55,7 @@ struct intrusive_erc_generator
     value_type operator()( Rng& rng ) const
     {
         auto x = m_dist( rng );
-        return value_type { [x]( auto const& c , auto const& n ) { return x; } , std::to_string( x ) };
+        return value_type { [x]( auto const& c , auto const& n ) { return x; } , detail::erc_name( x ) };
     }
     
 private:
@@ -50,7 +75,7 @@ auto make_intrusive_erc_factory_generator( ValueFactory value_factory , Dist dis
 {
     return [ value_factory , dist ]( auto& rng ) {
         auto x = dist( rng );
-        return value_factory( [x]( auto const& c , auto const& n ) { return x; } , std::to_string( x ) );
+        return value_factory( [x]( auto const& c , auto const& n ) { return x; } , detail::erc_name( x ) );
     };
 }
 
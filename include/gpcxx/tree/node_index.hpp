@@ -0,0 +1,263 @@
+/*
+ * gpcxx/tree/node_index.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_TREE_NODE_INDEX_HPP_INCLUDED
+#define GPCXX_TREE_NODE_INDEX_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Table of all nodes of a tree with their level, height, arity and subtree size. The nodes are numbered in breadth
+ * first order, node i is the node returned by tree.rank_is( i ). Additionally the nodes are grouped by arity, level,
+ * height and subtree size, the groups are contiguous ranges of node numbers, hence a node can be drawn from a group in
+ * O(1). The groups are sorted lazily at the first query. The heights follow the convention of the cursors, a leaf has height 1 and the root has
+ * level 0.
+ *
+ * build() reuses the memory of the previous build, use scratch_node_index to get a thread local instance. The index is
+ * not updated when the tree is modified, it is a snapshot which has to be rebuilt in O(n) after every modification.
+ */
+template< typename Cursor >
+class node_index
+{
+public:
+
+    using cursor_type = Cursor;
+    using index_vector = std::vector< size_t >;
+    using index_range = boost::iterator_range< index_vector::const_iterator >;
+
+    struct node_info
+    {
+        cursor_type cursor;
+        size_t level;
+        size_t height;
+        size_t arity;
+        size_t first_child;
+        size_t subtree_size;
+    };
+
+    node_index( void ) = default;
+
+    template< typename Tree >
+    explicit node_index( Tree& t )
+    {
+        build( t );
+    }
+
+    template< typename Tree >
+    void build( Tree& t )
+    {
+        m_nodes.clear();
+
+        // breadth first, the table itself is the queue
+        if( ! t.empty() ) m_nodes.push_back( node_info { t.root() , 0 , 1 , t.root().size() , 0 , 1 } );
+        for( size_t i=0 ; i<m_nodes.size() ; ++i )
+        {
+            cursor_type c = m_nodes[i].cursor;
+            size_t level = m_nodes[i].level + 1;
+            m_nodes[i].first_child = m_nodes.size();
+            for( cursor_type child = c.begin() ; child != c.end() ; ++child )
+                m_nodes.push_back( node_info { child , level , 1 , child.size() , 0 , 1 } );
+        }
+
+        // children come after their parents
+        for( size_t i=m_nodes.size() ; i-- > 0 ; )
+        {
+            node_info& n = m_nodes[i];
+            for( size_t j=n.first_child ; j<n.first_child+n.arity ; ++j )
+            {
+                n.height = std::max( n.height , m_nodes[j].height + 1 );
+                n.subtree_size += m_nodes[j].subtree_size;
+            }
+        }
+
+        m_grouped = false;
+        m_histogram_valid = false;
+    }
+
+    size_t size( void ) const { return m_nodes.size(); }
+    bool empty( void ) const { return m_nodes.empty(); }
+
+    node_info const& operator[]( size_t i ) const { return m_nodes[i]; }
+    cursor_type cursor( size_t i ) const { return m_nodes[i].cursor; }
+    size_t level( size_t i ) const { return m_nodes[i].level; }
+    size_t height( size_t i ) const { return m_nodes[i].height; }
+    size_t arity( size_t i ) const { return m_nodes[i].arity; }
+    size_t subtree_size( size_t i ) const { return m_nodes[i].subtree_size; }
+    size_t first_child( size_t i ) const { return m_nodes[i].first_child; }
+
+    /// Height of the tree.
+    size_t tree_height( void ) const { return m_nodes.empty() ? 0 : m_nodes[0].height; }
+
+    index_range with_arity( size_t a ) const { return range( m_by_arity , m_arity_offsets , a , a + 1 ); }
+    index_range with_arity_at_most( size_t a ) const { return range( m_by_arity , m_arity_offsets , 0 , a + 1 ); }
+    index_range with_arity_at_least( size_t a ) const { return range( m_by_arity , m_arity_offsets , a , size_t( -1 ) ); }
+    index_range terminals( void ) const { return with_arity( 0 ); }
+    index_range functions( void ) const { return with_arity_at_least( 1 ); }
+
+    index_range at_level( size_t l ) const { return range( m_by_level , m_level_offsets , l , l + 1 ); }
+    index_range with_level_at_most( size_t l ) const { return range( m_by_level , m_level_offsets , 0 , l + 1 ); }
+
+    index_range with_height( size_t h ) const { return range( m_by_height , m_height_offsets , h , h + 1 ); }
+    index_range with_height_at_most( size_t h ) const { return range( m_by_height , m_height_offsets , 0 , h + 1 ); }
+
+    index_range with_subtree_size( size_t s ) const { return range( m_by_size , m_size_offsets , s , s + 1 ); }
+    index_range with_subtree_size_between( size_t first , size_t last ) const { return range( m_by_size , m_size_offsets , first , last + 1 ); }
+
+    /// Uniformly drawn node number of a non-empty group.
+    template< typename Rng >
+    static size_t sample( index_range r , Rng& rng )
+    {
+        GPCXX_ASSERT( ! r.empty() );
+        std::uniform_int_distribution< size_t > dist( 0 , r.size() - 1 );
+        return r[ dist( rng ) ];
+    }
+
+    /// Uniformly drawn node number.
+    template< typename Rng >
+    size_t sample( Rng& rng ) const
+    {
+        GPCXX_ASSERT( ! empty() );
+        std::uniform_int_distribution< size_t > dist( 0 , m_nodes.size() - 1 );
+        return dist( rng );
+    }
+
+    /// Number of nodes with height <= max_height and level <= max_level.
+    size_t count_fitting( size_t max_height , size_t max_level ) const
+    {
+        size_t count = 0;
+        for_fitting_heights( max_height , max_level , [&count]( size_t first , size_t last ) {
+            count += last - first;
+            return false; } );
+        return count;
+    }
+
+    /// Uniformly drawn node number among the nodes with height <= max_height and level <= max_level. For a crossover
+    /// point p of another tree and a height limit m, max_height = m - level( p ) and max_level = m - height( p ) give
+    /// the points which can be swapped with p. The nodes are looked up in a height-level histogram in O( tree_height ).
+    /// Returns size() if no node fits.
+    template< typename Rng >
+    size_t sample_fitting( size_t max_height , size_t max_level , Rng& rng ) const
+    {
+        size_t count = count_fitting( max_height , max_level );
+        if( count == 0 ) return m_nodes.size();
+        size_t r = std::uniform_int_distribution< size_t >( 0 , count - 1 )( rng );
+        size_t result = m_nodes.size();
+        for_fitting_heights( max_height , max_level , [&]( size_t first , size_t last ) {
+            if( r < last - first )
+            {
+                result = m_by_height_level[ first + r ];
+                return true;
+            }
+            r -= last - first;
+            return false; } );
+        return result;
+    }
+
+private:
+
+    // the groups are only sorted if they are used
+    void group_all( void ) const
+    {
+        group( []( node_info const& n ) { return n.arity; } , m_by_arity , m_arity_offsets );
+        group( []( node_info const& n ) { return n.level; } , m_by_level , m_level_offsets );
+        group( []( node_info const& n ) { return n.height; } , m_by_height , m_height_offsets );
+        group( []( node_info const& n ) { return n.subtree_size; } , m_by_size , m_size_offsets );
+        m_grouped = true;
+    }
+
+    // nodes ordered by height and by level within the same height, the key of height h and level l is
+    // ( h - 1 ) * tree_height + l since a node of level l has height h <= tree_height - l
+    void build_histogram( void ) const
+    {
+        size_t th = tree_height();
+        group( [th]( node_info const& n ) { return ( n.height - 1 ) * th + n.level; } , m_by_height_level , m_height_level_offsets );
+        m_height_level_offsets.resize( th * th + 1 , m_nodes.size() );
+        m_histogram_valid = true;
+    }
+
+    // calls f( first , last ) with the positions in m_by_height_level of the fitting nodes of every height, stops if f
+    // returns true
+    template< typename F >
+    void for_fitting_heights( size_t max_height , size_t max_level , F f ) const
+    {
+        if( m_nodes.empty() ) return;
+        if( ! m_histogram_valid ) build_histogram();
+        size_t th = tree_height();
+        size_t levels = std::min( max_level , th - 1 ) + 1;
+        for( size_t h=1 ; h<=std::min( max_height , th ) ; ++h )
+        {
+            size_t first = m_height_level_offsets[ ( h - 1 ) * th ];
+            size_t last = m_height_level_offsets[ ( h - 1 ) * th + levels ];
+            if( ( first != last ) && f( first , last ) ) return;
+        }
+    }
+
+    // stable counting sort by the key, offsets[k] is the first position of key k
+    template< typename Key >
+    void group( Key key , index_vector& order , index_vector& offsets ) const
+    {
+        size_t max_key = 0;
+        for( auto const& n : m_nodes ) max_key = std::max( max_key , key( n ) );
+        offsets.assign( max_key + 2 , 0 );
+        for( auto const& n : m_nodes ) ++offsets[ key( n ) + 1 ];
+        for( size_t k=1 ; k<offsets.size() ; ++k ) offsets[k] += offsets[k-1];
+        order.resize( m_nodes.size() );
+        for( size_t i=0 ; i<m_nodes.size() ; ++i ) order[ offsets[ key( m_nodes[i] ) ]++ ] = i;
+        for( size_t k=offsets.size()-1 ; k>0 ; --k ) offsets[k] = offsets[k-1];
+        offsets[0] = 0;
+    }
+
+    index_range range( index_vector const& order , index_vector const& offsets , size_t first , size_t last ) const
+    {
+        if( ! m_grouped ) group_all();
+        size_t n = offsets.size() - 1;
+        first = std::min( first , n );
+        last = std::min( last , n );
+        if( last < first ) last = first;
+        return index_range( order.begin() + offsets[ first ] , order.begin() + offsets[ last ] );
+    }
+
+    std::vector< node_info > m_nodes;
+    mutable index_vector m_by_arity , m_arity_offsets;
+    mutable index_vector m_by_level , m_level_offsets;
+    mutable index_vector m_by_height , m_height_offsets;
+    mutable index_vector m_by_size , m_size_offsets;
+    mutable index_vector m_by_height_level , m_height_level_offsets;
+    mutable bool m_grouped = false;
+    mutable bool m_histogram_valid = false;
+};
+
+
+/// Thread local node_index, the genetic operators use the slots 0 and 1 for their first and second tree. It is a per-call
+/// scratch index: the operators rebuild it in O(n) on every call, only the memory is reused, nothing is cached per tree.
+template< typename Cursor , size_t Slot = 0 >
+node_index< Cursor >& scratch_node_index( void )
+{
+    static thread_local node_index< Cursor > index;
+    return index;
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_TREE_NODE_INDEX_HPP_INCLUDED
@@ -0,0 +1,215 @@
+/*
+ * gpcxx/tree/semantic_individual.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_TREE_SEMANTIC_INDIVIDUAL_HPP_INCLUDED
+#define GPCXX_TREE_SEMANTIC_INDIVIDUAL_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+namespace detail {
+
+template< typename T >
+T logistic( T x )
+{
+    return T( 1 ) / ( T( 1 ) + std::exp( -x ) );
+}
+
+} // namespace detail
+
+
+/**
+ * Individual of geometric semantic GP. The expression is a directed acyclic graph whose leafs are trees and whose inner
+ * nodes are the geometric semantic operations
+ *
+ *     crossover( a , b , r ) = logistic( r ) * a + ( 1 - logistic( r ) ) * b
+ *     mutation( a , r1 , r2 , step ) = a + step * ( logistic( r1 ) - logistic( r2 ) )
+ *
+ * The operands are shared with the parents instead of copied, hence the expression grows linearly with the number of
+ * generations and not exponentially. Copying an individual copies two shared pointers.
+ *
+ * The semantics, the outputs on the training cases, are cached. The semantics of an offspring is computed from the
+ * semantics of its operands in O( cases ) without evaluating the expression. Only the semantics of the living
+ * individuals are kept, the expression of the ancestors keeps the trees but not their outputs.
+ */
+template< typename Tree , typename Value = double >
+class semantic_individual
+{
+public:
+
+    using tree_type = Tree;
+    using value_type = Value;
+    using semantics_type = std::vector< value_type >;
+
+    semantic_individual( void ) = default;
+
+    /// Individual of the tree t, semantics[i] is the output of t on training case i.
+    semantic_individual( tree_type t , semantics_type semantics )
+    : m_expression( std::make_shared< expression const >( expression { operation::tree , {} , value_type( 0 ) , std::move( t ) } ) )
+    , m_semantics( std::make_shared< semantics_type const >( std::move( semantics ) ) ) { }
+
+    bool empty( void ) const { return ! m_expression; }
+
+    semantics_type const& semantics( void ) const
+    {
+        GPCXX_ASSERT( ! empty() );
+        return *m_semantics;
+    }
+
+    size_t cases( void ) const { return empty() ? 0 : m_semantics->size(); }
+
+    /// Number of distinct nodes of the expression, shared operands are counted once.
+    size_t expression_size( void ) const
+    {
+        std::unordered_set< expression const* > visited;
+        std::vector< expression const* > stack;
+        if( m_expression ) stack.push_back( m_expression.get() );
+        while( ! stack.empty() )
+        {
+            expression const* e = stack.back();
+            stack.pop_back();
+            if( ! visited.insert( e ).second ) continue;
+            for( auto const& arg : e->args )
+                if( arg ) stack.push_back( arg.get() );
+        }
+        return visited.size();
+    }
+
+    /// Value of the expression for the context c, eval( tree , c ) evaluates a leaf tree. Every shared operand is
+    /// evaluated once.
+    template< typename Eval , typename Context >
+    value_type eval( Eval const& eval , Context const& c ) const
+    {
+        GPCXX_ASSERT( ! empty() );
+        std::unordered_map< expression const* , value_type > memo;
+        return eval_expression( *m_expression , eval , c , memo );
+    }
+
+    template< typename T , typename V >
+    friend semantic_individual< T , V > semantic_crossover( semantic_individual< T , V > const& a ,
+        semantic_individual< T , V > const& b , semantic_individual< T , V > const& r );
+
+    template< typename T , typename V >
+    friend semantic_individual< T , V > semantic_mutation( semantic_individual< T , V > const& a ,
+        semantic_individual< T , V > const& r1 , semantic_individual< T , V > const& r2 , V step );
+
+private:
+
+    enum class operation { tree , crossover , mutation };
+
+    struct expression
+    {
+        operation op;
+        std::array< std::shared_ptr< expression const > , 3 > args;
+        value_type step;
+        tree_type tree;
+    };
+
+    using expression_pointer = std::shared_ptr< expression const >;
+    using semantics_pointer = std::shared_ptr< semantics_type const >;
+
+    semantic_individual( expression_pointer e , semantics_pointer s )
+    : m_expression( std::move( e ) ) , m_semantics( std::move( s ) ) { }
+
+    template< typename Eval , typename Context >
+    static value_type eval_expression( expression const& e , Eval const& eval , Context const& c ,
+                                       std::unordered_map< expression const* , value_type >& memo )
+    {
+        auto iter = memo.find( &e );
+        if( iter != memo.end() ) return iter->second;
+
+        value_type v = value_type( 0 );
+        switch( e.op )
+        {
+            case operation::tree:
+                v = eval( e.tree , c );
+                break;
+            case operation::crossover:
+            {
+                value_type r = detail::logistic( eval_expression( *e.args[2] , eval , c , memo ) );
+                v = r * eval_expression( *e.args[0] , eval , c , memo ) + ( value_type( 1 ) - r ) * eval_expression( *e.args[1] , eval , c , memo );
+                break;
+            }
+            case operation::mutation:
+                v = eval_expression( *e.args[0] , eval , c , memo ) + e.step * (
+                    detail::logistic( eval_expression( *e.args[1] , eval , c , memo ) ) -
+                    detail::logistic( eval_expression( *e.args[2] , eval , c , memo ) ) );
+                break;
+            default:
+                GPCXX_ASSERT( false );
+        }
+        memo.emplace( &e , v );
+        return v;
+    }
+
+    expression_pointer m_expression;
+    semantics_pointer m_semantics;
+};
+
+
+/// Geometric semantic crossover of a and b with the random individual r, logistic( r ) * a + ( 1 - logistic( r ) ) * b.
+template< typename Tree , typename Value >
+semantic_individual< Tree , Value > semantic_crossover( semantic_individual< Tree , Value > const& a ,
+    semantic_individual< Tree , Value > const& b , semantic_individual< Tree , Value > const& r )
+{
+    using individual = semantic_individual< Tree , Value >;
+    using expression = typename individual::expression;
+    using semantics_type = typename individual::semantics_type;
+
+    GPCXX_ASSERT( ( a.cases() == b.cases() ) && ( a.cases() == r.cases() ) );
+    auto const& sa = a.semantics() , & sb = b.semantics() , & sr = r.semantics();
+    auto s = std::make_shared< semantics_type >( sa.size() );
+    for( size_t i=0 ; i<sa.size() ; ++i )
+    {
+        Value l = detail::logistic( sr[i] );
+        ( *s )[i] = l * sa[i] + ( Value( 1 ) - l ) * sb[i];
+    }
+    auto e = std::make_shared< expression const >( expression { individual::operation::crossover ,
+        { a.m_expression , b.m_expression , r.m_expression } , Value( 0 ) , Tree() } );
+    return individual( std::move( e ) , std::move( s ) );
+}
+
+/// Geometric semantic mutation of a with the random individuals r1 and r2, a + step * ( logistic( r1 ) - logistic( r2 ) ).
+template< typename Tree , typename Value >
+semantic_individual< Tree , Value > semantic_mutation( semantic_individual< Tree , Value > const& a ,
+    semantic_individual< Tree , Value > const& r1 , semantic_individual< Tree , Value > const& r2 , Value step )
+{
+    using individual = semantic_individual< Tree , Value >;
+    using expression = typename individual::expression;
+    using semantics_type = typename individual::semantics_type;
+
+    GPCXX_ASSERT( ( a.cases() == r1.cases() ) && ( a.cases() == r2.cases() ) );
+    auto const& sa = a.semantics() , & s1 = r1.semantics() , & s2 = r2.semantics();
+    auto s = std::make_shared< semantics_type >( sa.size() );
+    for( size_t i=0 ; i<sa.size() ; ++i )
+        ( *s )[i] = sa[i] + step * ( detail::logistic( s1[i] ) - detail::logistic( s2[i] ) );
+    auto e = std::make_shared< expression const >( expression { individual::operation::mutation ,
+        { a.m_expression , r1.m_expression , r2.m_expression } , step , Tree() } );
+    return individual( std::move( e ) , std::move( s ) );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_TREE_SEMANTIC_INDIVIDUAL_HPP_INCLUDED
@@ -0,0 +1,123 @@
+/*
+ * gpcxx/util/alias_table.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_ALIAS_TABLE_HPP_INCLUDED
+#define GPCXX_UTIL_ALIAS_TABLE_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Walker's alias method in the variant of Vose. Draws index i with probability weight[i] / sum( weights ) with one
+ * random number in O(1), independent of the number of weights. The table is built once in O(n). Drawing does not
+ * modify the table, hence one table can be shared between threads.
+ */
+class alias_table
+{
+public:
+
+    alias_table( void ) = default;
+
+    template< typename Iterator >
+    alias_table( Iterator first , Iterator last )
+    {
+        assign( first , last );
+    }
+
+    alias_table( std::initializer_list< double > weights )
+    {
+        assign( weights.begin() , weights.end() );
+    }
+
+    template< typename Iterator >
+    void assign( Iterator first , Iterator last )
+    {
+        size_t n = std::distance( first , last );
+        m_prob.assign( n , 1.0 );
+        m_alias.resize( n );
+        for( size_t i=0 ; i<n ; ++i ) m_alias[i] = i;
+        if( n == 0 ) return;
+
+        double sum = 0.0;
+        for( Iterator iter = first ; iter != last ; ++iter )
+        {
+            GPCXX_ASSERT( *iter >= 0.0 );
+            sum += double( *iter );
+        }
+        GPCXX_ASSERT( sum > 0.0 );
+
+        std::vector< double > scaled( n );
+        std::vector< size_t > small , large;
+        for( size_t i=0 ; i<n ; ++i , ++first )
+        {
+            scaled[i] = double( *first ) * double( n ) / sum;
+            ( scaled[i] < 1.0 ? small : large ).push_back( i );
+        }
+        while( ( ! small.empty() ) && ( ! large.empty() ) )
+        {
+            size_t s = small.back() , l = large.back();
+            small.pop_back();
+            m_prob[s] = scaled[s];
+            m_alias[s] = l;
+            scaled[l] -= 1.0 - scaled[s];
+            if( scaled[l] < 1.0 )
+            {
+                large.pop_back();
+                small.push_back( l );
+            }
+        }
+        // the remaining columns are full up to rounding errors
+        for( size_t i : small ) m_prob[i] = 1.0;
+        for( size_t i : large ) m_prob[i] = 1.0;
+    }
+
+    size_t size( void ) const { return m_prob.size(); }
+    bool empty( void ) const { return m_prob.empty(); }
+
+    template< typename Rng >
+    size_t operator()( Rng& rng ) const
+    {
+        GPCXX_ASSERT( ! empty() );
+        double x = std::uniform_real_distribution< double >( 0.0 , double( m_prob.size() ) )( rng );
+        size_t k = std::min( size_t( x ) , m_prob.size() - 1 );
+        return ( x - double( k ) < m_prob[k] ) ? k : m_alias[k];
+    }
+
+    /// Probability of drawing i, computed from the table.
+    double probability( size_t i ) const
+    {
+        double p = m_prob[i];
+        for( size_t k=0 ; k<m_prob.size() ; ++k )
+            if( ( m_alias[k] == i ) && ( k != i ) ) p += 1.0 - m_prob[k];
+        return p / double( m_prob.size() );
+    }
+
+private:
+
+    std::vector< double > m_prob;
+    std::vector< size_t > m_alias;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_UTIL_ALIAS_TABLE_HPP_INCLUDED
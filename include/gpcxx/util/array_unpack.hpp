@@ -13,6 +13,7 @@
 #define GPCXX_UTIL_ARRAY_UNPACK_HPP_DEFINED
 
 #include <array>
+#include <cstddef>
 
 
 namespace gpcxx {
@@ -0,0 +1,250 @@
+/*
+ * gpcxx/util/philox_engine.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_PHILOX_ENGINE_HPP_INCLUDED
+#define GPCXX_UTIL_PHILOX_ENGINE_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+
+namespace gpcxx {
+
+/**
+ * Counter based random number engine (Philox4x32-10 from Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+ *
+ * The engine is a pure function of a 64 bit key and a 128 bit counter. The key is the seed, the counter consists of
+ * the block index and the three stream words ( operator id , individual index , generation ). Hence, every
+ * ( seed , generation , individual , operator ) tuple selects an independent stream which can be created in O(1)
+ * anywhere, which makes offspring reproducible independent of the order in which they are created.
+ *
+ * Models UniformRandomBitGenerator and RandomNumberEngine.
+ */
+class philox_engine
+{
+public:
+
+    using result_type = std::uint32_t;
+    using key_type = std::array< std::uint32_t , 2 >;
+    using counter_type = std::array< std::uint32_t , 4 >;
+
+    static const std::uint64_t default_seed = 20111115u;
+    static const size_t block_size = 4;
+
+    static constexpr result_type min( void ) { return 0; }
+    static constexpr result_type max( void ) { return 0xffffffffu; }
+
+
+    //
+    // construct:
+    //
+    philox_engine( void )
+    : philox_engine( default_seed ) { }
+
+    explicit philox_engine( std::uint64_t seed )
+    : philox_engine( seed , 0 , 0 , 0 ) { }
+
+    /// Creates the stream identified by ( seed , generation , individual , operator_id ).
+    philox_engine( std::uint64_t seed , std::uint32_t generation , std::uint32_t individual , std::uint32_t operator_id )
+    : m_key() , m_counter() , m_buffer() , m_index( block_size )
+    {
+        set_stream( seed , generation , individual , operator_id );
+    }
+
+    template< typename Sseq , typename Enabler = std::enable_if_t< ! std::is_convertible< Sseq , std::uint64_t >::value > >
+    explicit philox_engine( Sseq& seq )
+    : m_key() , m_counter() , m_buffer() , m_index( block_size )
+    {
+        seed( seq );
+    }
+
+
+    //
+    // seeding:
+    //
+    void seed( std::uint64_t s = default_seed )
+    {
+        set_stream( s , 0 , 0 , 0 );
+    }
+
+    template< typename Sseq , typename Enabler = std::enable_if_t< ! std::is_convertible< Sseq , std::uint64_t >::value > >
+    void seed( Sseq& seq )
+    {
+        std::array< std::uint32_t , 2 > k;
+        seq.generate( k.begin() , k.end() );
+        set_stream( ( std::uint64_t( k[1] ) << 32 ) | std::uint64_t( k[0] ) , 0 , 0 , 0 );
+    }
+
+    /// Positions the engine at the start of the stream ( seed , generation , individual , operator_id ).
+    void set_stream( std::uint64_t seed , std::uint32_t generation , std::uint32_t individual , std::uint32_t operator_id )
+    {
+        m_key[0] = std::uint32_t( seed );
+        m_key[1] = std::uint32_t( seed >> 32 );
+        m_counter[0] = 0;
+        m_counter[1] = operator_id;
+        m_counter[2] = individual;
+        m_counter[3] = generation;
+        m_index = block_size;
+    }
+
+
+    //
+    // generation:
+    //
+    result_type operator()( void )
+    {
+        if( m_index == block_size )
+        {
+            m_buffer = generate_block( m_counter , m_key );
+            ++m_counter[0];
+            m_index = 0;
+        }
+        return m_buffer[ m_index++ ];
+    }
+
+    /// Writes the next n values to out, like n calls of operator(). Complete blocks are generated directly into out, the
+    /// blocks do not depend on each other.
+    void generate( result_type* out , size_t n )
+    {
+        while( ( n > 0 ) && ( m_index != block_size ) )
+        {
+            *out++ = m_buffer[ m_index++ ];
+            --n;
+        }
+        counter_type ctr = m_counter;
+        size_t blocks = n / block_size;
+        for( size_t b=0 ; b<blocks ; ++b , out += block_size )
+        {
+            counter_type r = generate_block( ctr , m_key );
+            for( size_t i=0 ; i<block_size ; ++i ) out[i] = r[i];
+            ++ctr[0];
+        }
+        m_counter = ctr;
+        for( size_t i=0 ; i<n%block_size ; ++i ) *out++ = ( *this )();
+    }
+
+    void discard( unsigned long long z )
+    {
+        // consume the buffered values first, then jump over complete blocks
+        while( ( z > 0 ) && ( m_index != block_size ) )
+        {
+            ++m_index;
+            --z;
+        }
+        m_counter[0] += std::uint32_t( z / block_size );
+        z %= block_size;
+        while( z-- > 0 ) ( *this )();
+    }
+
+
+    //
+    // accessors:
+    //
+    key_type const& key( void ) const noexcept { return m_key; }
+    counter_type const& counter( void ) const noexcept { return m_counter; }
+
+    /// The raw Philox4x32-10 bijection.
+    static counter_type generate_block( counter_type ctr , key_type key ) noexcept
+    {
+        for( size_t r=0 ; r<9 ; ++r )
+        {
+            ctr = round( ctr , key );
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        return round( ctr , key );
+    }
+
+
+    //
+    // compare and io:
+    //
+    friend bool operator==( philox_engine const& x , philox_engine const& y )
+    {
+        return ( x.m_key == y.m_key ) && ( x.m_counter == y.m_counter ) && ( x.m_index == y.m_index )
+            && ( ( x.m_index == block_size ) || ( x.m_buffer == y.m_buffer ) );
+    }
+
+    friend bool operator!=( philox_engine const& x , philox_engine const& y )
+    {
+        return !( x == y );
+    }
+
+    friend std::ostream& operator<<( std::ostream& out , philox_engine const& e )
+    {
+        out << e.m_key[0] << " " << e.m_key[1];
+        for( auto c : e.m_counter ) out << " " << c;
+        out << " " << e.m_index;
+        return out;
+    }
+
+    friend std::istream& operator>>( std::istream& in , philox_engine& e )
+    {
+        philox_engine tmp;
+        in >> tmp.m_key[0] >> tmp.m_key[1];
+        for( auto& c : tmp.m_counter ) in >> c;
+        in >> tmp.m_index;
+        if( ! in ) return in;
+        if( tmp.m_index > block_size )
+        {
+            in.setstate( std::ios::failbit );
+            return in;
+        }
+        if( tmp.m_index != block_size )
+        {
+            // the buffer is a function of the previous block
+            counter_type ctr = tmp.m_counter;
+            --ctr[0];
+            tmp.m_buffer = generate_block( ctr , tmp.m_key );
+        }
+        e = tmp;
+        return in;
+    }
+
+private:
+
+    static std::uint32_t mulhilo( std::uint32_t a , std::uint32_t b , std::uint32_t& hi ) noexcept
+    {
+        std::uint64_t product = std::uint64_t( a ) * std::uint64_t( b );
+        hi = std::uint32_t( product >> 32 );
+        return std::uint32_t( product );
+    }
+
+    static counter_type round( counter_type const& ctr , key_type const& key ) noexcept
+    {
+        std::uint32_t hi0 , hi1;
+        std::uint32_t lo0 = mulhilo( 0xD2511F53u , ctr[0] , hi0 );
+        std::uint32_t lo1 = mulhilo( 0xCD9E8D57u , ctr[2] , hi1 );
+        return counter_type {{ hi1 ^ ctr[1] ^ key[0] , lo1 , hi0 ^ ctr[3] ^ key[1] , lo0 }};
+    }
+
+    key_type m_key;
+    counter_type m_counter;
+    counter_type m_buffer;
+    size_t m_index;
+};
+
+
+/// Creates the independent stream for one genetic operation of one individual in one generation.
+inline philox_engine make_philox_stream( std::uint64_t seed , std::uint32_t generation , std::uint32_t individual , std::uint32_t operator_id = 0 )
+{
+    return philox_engine( seed , generation , individual , operator_id );
+}
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_UTIL_PHILOX_ENGINE_HPP_INCLUDED
@@ -0,0 +1,112 @@
+/*
+ * gpcxx/util/rank_cache.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_RANK_CACHE_HPP_INCLUDED
+#define GPCXX_UTIL_RANK_CACHE_HPP_INCLUDED
+
+#include <gpcxx/util/assert.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+
+namespace gpcxx {
+
+
+/**
+ * Ranking of the fitness values of one generation. The ranking is computed lazily and only as far as requested, a
+ * request for the best k individuals sorts only the part which is not sorted yet. Hence, elitism, best_individuals
+ * and other consumers of the same generation rank the population at most once. Call invalidate() whenever the fitness
+ * values change.
+ */
+class rank_cache
+{
+public:
+
+    using index_vector = std::vector< size_t >;
+    using index_range = boost::iterator_range< index_vector::const_iterator >;
+
+    rank_cache( void ) : m_indices() , m_finite( 0 ) , m_sorted( 0 ) , m_valid( false ) { }
+
+    void invalidate( void )
+    {
+        m_valid = false;
+    }
+
+    bool valid( void ) const { return m_valid; }
+
+    /// Indices of the min( k , fitness.size() ) best individuals in ascending order of their fitness. Individuals with
+    /// non-finite fitness come last in unspecified order.
+    template< typename Fitness >
+    index_range best( Fitness const& fitness , size_t k )
+    {
+        if( ! m_valid ) reset( fitness );
+        GPCXX_ASSERT( m_indices.size() == fitness.size() );
+
+        k = std::min( k , m_indices.size() );
+        if( k > m_sorted )
+        {
+            auto cmp = [&fitness]( size_t i1 , size_t i2 ) { return ( fitness[i1] < fitness[i2] ); };
+            auto first = m_indices.begin() + std::min( m_sorted , m_finite );
+            auto middle = m_indices.begin() + std::min( k , m_finite );
+            auto last = m_indices.begin() + m_finite;
+            if( middle != last ) std::nth_element( first , middle , last , cmp );
+            std::sort( first , middle , cmp );
+            m_sorted = k;
+        }
+        return index_range( m_indices.begin() , m_indices.begin() + k );
+    }
+
+    /// Complete ranking, the indices of all individuals ordered by their fitness.
+    template< typename Fitness >
+    index_vector const& ranking( Fitness const& fitness )
+    {
+        best( fitness , fitness.size() );
+        return m_indices;
+    }
+
+    /// Number of individuals with finite fitness.
+    template< typename Fitness >
+    size_t number_of_finite( Fitness const& fitness )
+    {
+        if( ! m_valid ) reset( fitness );
+        return m_finite;
+    }
+
+private:
+
+    template< typename Fitness >
+    void reset( Fitness const& fitness )
+    {
+        m_indices.resize( fitness.size() );
+        for( size_t i=0 ; i<m_indices.size() ; ++i ) m_indices[i] = i;
+        auto iter = std::partition( m_indices.begin() , m_indices.end() ,
+                                    [&fitness]( size_t i ) { return std::isfinite( fitness[i] ); } );
+        m_finite = iter - m_indices.begin();
+        m_sorted = 0;
+        m_valid = true;
+    }
+
+    index_vector m_indices;
+    size_t m_finite;
+    size_t m_sorted;
+    bool m_valid;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_UTIL_RANK_CACHE_HPP_INCLUDED
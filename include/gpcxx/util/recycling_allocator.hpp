@@ -0,0 +1,185 @@
+/*
+ * gpcxx/util/recycling_allocator.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_RECYCLING_ALLOCATOR_HPP_INCLUDED
+#define GPCXX_UTIL_RECYCLING_ALLOCATOR_HPP_INCLUDED
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+
+namespace gpcxx {
+
+namespace detail {
+
+// Thread local free lists of small blocks in size classes of 16 bytes. Blocks are never returned to the system before
+// the thread ends, hence tree nodes which are freed in one generation are reused by the offspring of the next.
+class recycling_pool
+{
+public:
+
+    static const size_t granularity = 16;
+    static const size_t number_of_classes = 16;
+    static const size_t max_block_size = granularity * number_of_classes;
+
+    static void* allocate( size_t bytes )
+    {
+        size_t c = size_class( bytes );
+        if( c >= number_of_classes ) return ::operator new( bytes );
+        // always a full block of the class, another thread may put it on its free list
+        if( destroyed() ) return ::operator new( ( c + 1 ) * granularity );
+        recycling_pool& p = instance();
+        block* b = p.m_free[c];
+        if( b == nullptr ) return ::operator new( ( c + 1 ) * granularity );
+        p.m_free[c] = b->next;
+        return b;
+    }
+
+    static void deallocate( void* ptr , size_t bytes ) noexcept
+    {
+        size_t c = size_class( bytes );
+        if( ( c >= number_of_classes ) || destroyed() )
+        {
+            ::operator delete( ptr );
+            return;
+        }
+        recycling_pool& p = instance();
+        block* b = static_cast< block* >( ptr );
+        b->next = p.m_free[c];
+        p.m_free[c] = b;
+    }
+
+    /// Returns all cached blocks of the calling thread to the system.
+    static void release( void ) noexcept
+    {
+        if( ! destroyed() ) instance().clear();
+    }
+
+private:
+
+    struct block { block* next; };
+
+    recycling_pool( void ) noexcept
+    {
+        for( auto& f : m_free ) f = nullptr;
+    }
+
+    ~recycling_pool( void )
+    {
+        clear();
+        destroyed() = true;
+    }
+
+    void clear( void ) noexcept
+    {
+        for( auto& f : m_free )
+        {
+            while( f != nullptr )
+            {
+                block* next = f->next;
+                ::operator delete( f );
+                f = next;
+            }
+        }
+    }
+
+    static size_t size_class( size_t bytes ) noexcept
+    {
+        return ( bytes == 0 ) ? 0 : ( bytes - 1 ) / granularity;
+    }
+
+    static recycling_pool& instance( void )
+    {
+        static thread_local recycling_pool pool;
+        return pool;
+    }
+
+    // trivially destructible, hence still valid while other thread local and static objects are destroyed
+    static bool& destroyed( void ) noexcept
+    {
+        static thread_local bool d = false;
+        return d;
+    }
+
+    block* m_free[ number_of_classes ];
+};
+
+} // namespace detail
+
+
+/**
+ * Stateless allocator which recycles freed memory through thread local free lists. Use it as tree allocator, e.g.
+ * basic_tree< std::string , recycling_allocator< std::string > >, to make the node allocations of the genetic operators
+ * nearly free once the population has reached its steady state.
+ */
+template< typename T >
+class recycling_allocator
+{
+    static_assert( alignof( T ) <= detail::recycling_pool::granularity , "recycling_allocator supports alignments up to 16 bytes" );
+
+public:
+
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using reference = T&;
+    using const_reference = T const&;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template< typename U >
+    struct rebind { using other = recycling_allocator< U >; };
+
+    recycling_allocator( void ) noexcept { }
+
+    template< typename U >
+    recycling_allocator( recycling_allocator< U > const& ) noexcept { }
+
+    pointer allocate( size_type n , void const* = nullptr )
+    {
+        return static_cast< pointer >( detail::recycling_pool::allocate( n * sizeof( T ) ) );
+    }
+
+    void deallocate( pointer p , size_type n ) noexcept
+    {
+        detail::recycling_pool::deallocate( p , n * sizeof( T ) );
+    }
+
+    template< typename U , typename ... Args >
+    void construct( U* p , Args&& ... args )
+    {
+        ::new( static_cast< void* >( p ) ) U( std::forward< Args >( args ) ... );
+    }
+
+    template< typename U >
+    void destroy( U* p )
+    {
+        p->~U();
+    }
+
+    size_type max_size( void ) const noexcept
+    {
+        return size_type( -1 ) / sizeof( T );
+    }
+};
+
+template< typename T , typename U >
+bool operator==( recycling_allocator< T > const& , recycling_allocator< U > const& ) noexcept { return true; }
+
+template< typename T , typename U >
+bool operator!=( recycling_allocator< T > const& , recycling_allocator< U > const& ) noexcept { return false; }
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_UTIL_RECYCLING_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,227 @@
+/*
+ * gpcxx/util/shm_ring_buffer.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_UTIL_SHM_RING_BUFFER_HPP_INCLUDED
+#define GPCXX_UTIL_SHM_RING_BUFFER_HPP_INCLUDED
+
+#include <gpcxx/util/exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace gpcxx {
+
+/**
+ * Single producer single consumer queue of byte messages in a POSIX shared memory object. Producer and consumer can
+ * live in different processes, each process maps the buffer by its name. Messages are stored as a 32 bit length
+ * followed by the bytes and might wrap around the end of the buffer.
+ */
+class shm_ring_buffer
+{
+    static_assert( ATOMIC_LLONG_LOCK_FREE == 2 , "shm_ring_buffer needs address free 64 bit atomics" );
+
+    struct header
+    {
+        std::atomic< std::uint64_t > head;      // bytes written, only modified by the producer
+        char pad1[ 64 - sizeof( std::atomic< std::uint64_t > ) ];
+        std::atomic< std::uint64_t > tail;      // bytes read, only modified by the consumer
+        char pad2[ 64 - sizeof( std::atomic< std::uint64_t > ) ];
+        std::uint64_t capacity;
+    };
+
+    static const size_t data_offset = ( sizeof( header ) + 63 ) / 64 * 64;
+
+public:
+
+    using length_type = std::uint32_t;
+
+    /// Creates (or truncates) the shared memory object name with room for capacity bytes.
+    static shm_ring_buffer create( std::string const& name , size_t capacity )
+    {
+        int fd = ::shm_open( name.c_str() , O_CREAT | O_RDWR | O_TRUNC , 0600 );
+        if( fd < 0 ) throw_error( "shm_open" , name );
+        size_t size = data_offset + capacity;
+        if( ::ftruncate( fd , off_t( size ) ) != 0 )
+        {
+            ::close( fd );
+            throw_error( "ftruncate" , name );
+        }
+        shm_ring_buffer buffer( fd , size , name );
+        header* h = new ( buffer.m_memory ) header;
+        h->head.store( 0 );
+        h->tail.store( 0 );
+        h->capacity = capacity;
+        return buffer;
+    }
+
+    /// Maps an existing buffer.
+    static shm_ring_buffer open( std::string const& name )
+    {
+        int fd = ::shm_open( name.c_str() , O_RDWR , 0600 );
+        if( fd < 0 ) throw_error( "shm_open" , name );
+        struct stat st;
+        if( ::fstat( fd , &st ) != 0 )
+        {
+            ::close( fd );
+            throw_error( "fstat" , name );
+        }
+        size_t size = size_t( st.st_size );
+        if( size < data_offset )
+        {
+            ::close( fd );
+            throw gpcxx_exception( "Shared memory " + name + " is too small for a shm_ring_buffer." );
+        }
+        shm_ring_buffer buffer( fd , size , name );
+        std::uint64_t capacity = buffer.get_header().capacity;
+        if( ( capacity == 0 ) || ( capacity > size - data_offset ) )
+            throw gpcxx_exception( "Shared memory " + name + " does not match the capacity of its shm_ring_buffer." );
+        return buffer;
+    }
+
+    /// Removes the name, mapped buffers stay valid until they are destroyed.
+    static void unlink( std::string const& name )
+    {
+        ::shm_unlink( name.c_str() );
+    }
+
+
+    shm_ring_buffer( shm_ring_buffer&& other ) noexcept
+    : m_memory( other.m_memory ) , m_size( other.m_size ) , m_name( std::move( other.m_name ) )
+    {
+        other.m_memory = nullptr;
+        other.m_size = 0;
+    }
+
+    shm_ring_buffer& operator=( shm_ring_buffer&& other ) noexcept
+    {
+        std::swap( m_memory , other.m_memory );
+        std::swap( m_size , other.m_size );
+        std::swap( m_name , other.m_name );
+        return *this;
+    }
+
+    shm_ring_buffer( shm_ring_buffer const& ) = delete;
+    shm_ring_buffer& operator=( shm_ring_buffer const& ) = delete;
+
+    ~shm_ring_buffer( void )
+    {
+        if( m_memory != nullptr ) ::munmap( m_memory , m_size );
+    }
+
+
+    std::string const& name( void ) const noexcept { return m_name; }
+    size_t capacity( void ) const noexcept { return size_t( get_header().capacity ); }
+
+    /// Producer side, returns false if the buffer has not enough free space.
+    bool try_push( char const* data , size_t n )
+    {
+        header& h = get_header();
+        size_t needed = sizeof( length_type ) + n;
+        if( needed > h.capacity ) throw gpcxx_exception( "Message is larger than the capacity of shm_ring_buffer " + m_name + "." );
+
+        std::uint64_t head = h.head.load( std::memory_order_relaxed );
+        std::uint64_t tail = h.tail.load( std::memory_order_acquire );
+        if( h.capacity - ( head - tail ) < needed ) return false;
+
+        length_type length = length_type( n );
+        copy_in( head , reinterpret_cast< char const* >( &length ) , sizeof( length ) );
+        copy_in( head + sizeof( length ) , data , n );
+        h.head.store( head + needed , std::memory_order_release );
+        return true;
+    }
+
+    bool try_push( std::string const& msg )
+    {
+        return try_push( msg.data() , msg.size() );
+    }
+
+    /// Consumer side, returns false if the buffer is empty.
+    bool try_pop( std::string& msg )
+    {
+        header& h = get_header();
+        std::uint64_t tail = h.tail.load( std::memory_order_relaxed );
+        std::uint64_t head = h.head.load( std::memory_order_acquire );
+        if( head == tail ) return false;
+
+        length_type length;
+        copy_out( tail , reinterpret_cast< char* >( &length ) , sizeof( length ) );
+        msg.resize( length );
+        copy_out( tail + sizeof( length ) , &msg[0] , length );
+        h.tail.store( tail + sizeof( length ) + length , std::memory_order_release );
+        return true;
+    }
+
+    bool empty( void ) const
+    {
+        header const& h = get_header();
+        return h.head.load( std::memory_order_acquire ) == h.tail.load( std::memory_order_acquire );
+    }
+
+private:
+
+    shm_ring_buffer( int fd , size_t size , std::string name )
+    : m_memory( nullptr ) , m_size( size ) , m_name( std::move( name ) )
+    {
+        void* mem = ::mmap( nullptr , size , PROT_READ | PROT_WRITE , MAP_SHARED , fd , 0 );
+        ::close( fd );
+        if( mem == MAP_FAILED ) throw_error( "mmap" , m_name );
+        m_memory = static_cast< char* >( mem );
+    }
+
+    [[noreturn]] static void throw_error( char const* what , std::string const& name )
+    {
+        throw gpcxx_exception( std::string( what ) + " failed for " + name + ": " + std::strerror( errno ) );
+    }
+
+    header& get_header( void ) { return *reinterpret_cast< header* >( m_memory ); }
+    header const& get_header( void ) const { return *reinterpret_cast< header const* >( m_memory ); }
+    char* data( void ) { return m_memory + data_offset; }
+
+    void copy_in( std::uint64_t pos , char const* src , size_t n )
+    {
+        size_t capacity = size_t( get_header().capacity );
+        size_t offset = size_t( pos % capacity );
+        size_t first = std::min( n , capacity - offset );
+        std::memcpy( data() + offset , src , first );
+        std::memcpy( data() , src + first , n - first );
+    }
+
+    void copy_out( std::uint64_t pos , char* dst , size_t n )
+    {
+        size_t capacity = size_t( get_header().capacity );
+        size_t offset = size_t( pos % capacity );
+        size_t first = std::min( n , capacity - offset );
+        std::memcpy( dst , data() + offset , first );
+        std::memcpy( dst + first , data() , n - first );
+    }
+
+    char* m_memory;
+    size_t m_size;
+    std::string m_name;
+};
+
+
+} // namespace gpcxx
+
+
+#endif // GPCXX_UTIL_SHM_RING_BUFFER_HPP_INCLUDED
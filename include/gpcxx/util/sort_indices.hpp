@@ -24,6 +24,25 @@ typename IndexContainer::iterator sort_indices( const Container &v , IndexContai
     return iter;
 }
 
+/**
+ * Like sort_indices, but only the first k positions are sorted. They hold the indices of the k smallest finite values,
+ * the remaining finite indices follow in unspecified order. Runs in O( n + k log k ).
+ */
+template < typename Container , typename IndexContainer >
+typename IndexContainer::iterator partial_sort_indices( const Container &v , IndexContainer &idx , size_t k )
+{
+    idx.resize( v.size() );
+    for( size_t i = 0 ; i != idx.size() ; ++i ) idx[i] = i;
+
+    auto iter = std::partition( idx.begin() , idx.end() ,
+                                [&v]( size_t i ) { return std::isfinite( v[i] ); } );
+    auto cmp = [&v]( size_t i1 , size_t i2 ) { return ( v[i1] < v[i2] ); };
+    auto middle = idx.begin() + std::min< size_t >( k , iter - idx.begin() );
+    if( middle != iter ) std::nth_element( idx.begin() , middle , iter , cmp );
+    std::sort( idx.begin() , middle , cmp );
+    return iter;
+}
+
 }
 
 #endif // GPCXX_UTIL_SORT_INDICES_HPP_INCLUDED
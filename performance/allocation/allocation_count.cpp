@@ -0,0 +1,131 @@
+/*
+ * allocation_count.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/evolve/double_buffered_population.hpp>
+#include <gpcxx/util/recycling_allocator.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include "../common/counting_new.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Counts the calls of the global operator new per generation of a dynamic_pipeline. Compares a plain population of
+// trees with std::allocator with a double buffered population of trees with the recycling allocator.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+
+
+template< typename Population >
+struct plain_population
+{
+    Population pop;
+    explicit plain_population( Population p ) : pop( std::move( p ) ) { }
+    Population& get( void ) { return pop; }
+    Population& evolve_arg( void ) { return pop; }
+};
+
+template< typename Population >
+struct double_buffered
+{
+    gpcxx::double_buffered_population< Population > pop;
+    explicit double_buffered( Population p ) : pop( std::move( p ) ) { }
+    Population& get( void ) { return pop.current(); }
+    gpcxx::double_buffered_population< Population >& evolve_arg( void ) { return pop; }
+};
+
+
+template< typename Tree , template< typename > class Holder >
+void run( std::string const& name , size_t population_size , size_t generations )
+{
+    using population_type = std::vector< Tree >;
+    using fitness_type = std::vector< double >;
+
+    rng_type rng;
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "log" , "exp" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+    auto node_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 2 , 6 , 0.5 );
+
+    population_type initial( population_size );
+    fitness_type fitness( population_size );
+    for( size_t i=0 ; i<population_size ; ++i )
+    {
+        tree_generator( initial[i] );
+        fitness[i] = double( initial[i].size() );
+    }
+    Holder< population_type > holder( std::move( initial ) );
+
+    gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > pipeline( rng , 1 );
+    pipeline.add_operator( gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( rng , node_generator ) ,
+        gpcxx::make_tournament_selector( rng , 7 ) ) , 0.2 );
+    pipeline.add_operator( gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng , 8 ) ,
+        gpcxx::make_tournament_selector( rng , 7 ) ) , 0.6 );
+    pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 7 ) ) , 0.2 );
+
+    std::cout << name << std::endl;
+    gpcxx::timer timer;
+    for( size_t g=0 ; g<generations ; ++g )
+    {
+        size_t before = allocation_count;
+        pipeline.next_generation( holder.evolve_arg() , fitness );
+        size_t allocations = allocation_count - before;
+        size_t nodes = 0;
+        for( size_t i=0 ; i<population_size ; ++i )
+        {
+            fitness[i] = double( holder.get()[i].size() );
+            nodes += holder.get()[i].size();
+        }
+        if( ( g < 3 ) || ( g + 3 >= generations ) )
+            std::cout << "\tgeneration " << g << " : " << allocations << " allocations, "
+                      << double( allocations ) / double( population_size ) << " per individual, "
+                      << nodes << " nodes" << std::endl;
+    }
+    std::cout << "\t" << timer.seconds() << " s" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 4096;
+    size_t const generations = 20;
+
+    using std_tree = gpcxx::basic_tree< value_type >;
+    using recycling_tree = gpcxx::basic_tree< value_type , gpcxx::recycling_allocator< value_type > >;
+
+    run< std_tree , plain_population >( "std::allocator, new population every generation" , population_size , generations );
+    run< recycling_tree , plain_population >( "recycling_allocator, new population every generation" , population_size , generations );
+    run< recycling_tree , double_buffered >( "recycling_allocator, double_buffered_population" , population_size , generations );
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * any_genetic_operator.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/any_genetic_operator.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+
+#include "../common/counting_new.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Per offspring overhead of the type erased operator: selection plus operation of reproduce and crossover on a
+// population of single node trees, hence the tree copies are cheap and the overhead of the type erasure dominates.
+// legacy_genetic_operator is the former implementation with a heap allocated model, virtual clone and std::vector
+// for the selection and the offspring.
+
+
+template< typename Pop , typename Fitness >
+class legacy_genetic_operator
+{
+public:
+
+    using population_type = Pop;
+    using fitness_type = Fitness;
+    using value_type = typename Pop::value_type;
+    using value_iterator = typename Pop::const_iterator;
+    using value_vector_type = std::vector< value_type >;
+    using selection_type = std::vector< value_iterator >;
+
+    template< typename T >
+    legacy_genetic_operator( T t ) : m_data( new model< T >( std::move( t ) ) ) { }
+
+    legacy_genetic_operator( legacy_genetic_operator const& op ) : m_data( op.m_data->clone() ) { }
+
+    selection_type selection( population_type const& pop , fitness_type const& fitness )
+    {
+        return m_data->selection( pop , fitness );
+    }
+
+    value_vector_type operation( selection_type const& selection )
+    {
+        return m_data->operation( selection );
+    }
+
+private:
+
+    struct concept
+    {
+        virtual ~concept( void ) { }
+        virtual selection_type selection( population_type const& , fitness_type const& ) = 0;
+        virtual value_vector_type operation( selection_type const& ) = 0;
+        virtual concept* clone( void ) const = 0;
+    };
+
+    template< typename T >
+    struct model : public concept
+    {
+        model( T t ) : m_data( std::move( t ) ) { }
+        selection_type selection( population_type const& pop , fitness_type const& fitness ) override
+        {
+            return m_data.selection( pop , fitness );
+        }
+        value_vector_type operation( selection_type const& selection ) override
+        {
+            return m_data.operation( selection );
+        }
+        concept* clone( void ) const override
+        {
+            return new model( m_data );
+        }
+        T m_data;
+    };
+
+    std::unique_ptr< concept > m_data;
+};
+
+
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< std::string >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+using clock_type = std::chrono::high_resolution_clock;
+
+
+template< typename Op >
+void report( std::string const& name , Op& op , population_type const& pop , fitness_type const& fitness , size_t offspring )
+{
+    population_type new_pop( pop.size() );
+    size_t before = allocation_count;
+    auto start = clock_type::now();
+    for( size_t i=0 ; i<offspring ; )
+    {
+        auto selection = op.selection( pop , fitness );
+        auto trees = op.operation( selection );
+        for( auto& t : trees )
+            new_pop[ ( i++ ) % new_pop.size() ] = std::move( t );
+    }
+    double ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    std::cout << "\t" << name << " : " << ns / double( offspring ) << " ns and "
+              << double( allocation_count - before ) / double( offspring ) << " allocations per offspring" << std::endl;
+}
+
+template< typename Op >
+void report_slots( std::string const& name , Op& op , population_type const& pop , fitness_type const& fitness , size_t offspring )
+{
+    population_type new_pop( pop.size() );
+    size_t before = allocation_count;
+    auto start = clock_type::now();
+    for( size_t i=0 ; i<offspring ; )
+    {
+        auto first = new_pop.begin() + ( i % new_pop.size() );
+        auto selection = op.selection( pop , fitness );
+        i += op.operation( selection , first , new_pop.end() ) - first;
+    }
+    double ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    std::cout << "\t" << name << " : " << ns / double( offspring ) << " ns and "
+              << double( allocation_count - before ) / double( offspring ) << " allocations per offspring" << std::endl;
+}
+
+template< typename Op , typename Legacy >
+void copies( Op const& op , Legacy const& legacy , size_t n )
+{
+    size_t before = allocation_count;
+    auto start = clock_type::now();
+    for( size_t i=0 ; i<n ; ++i ) { Legacy l( legacy ); }
+    double legacy_ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    size_t legacy_allocations = allocation_count - before;
+
+    before = allocation_count;
+    start = clock_type::now();
+    for( size_t i=0 ; i<n ; ++i ) { Op o( op ); }
+    double ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    size_t allocations = allocation_count - before;
+
+    std::cout << "\tcopy legacy : " << legacy_ns / double( n ) << " ns and " << double( legacy_allocations ) / double( n ) << " allocations" << std::endl;
+    std::cout << "\tcopy any    : " << ns / double( n ) << " ns and " << double( allocations ) / double( n ) << " allocations" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 1024;
+    size_t const offspring = 2000000;
+
+    rng_type rng;
+    population_type pop( population_size );
+    fitness_type fitness( population_size );
+    std::uniform_real_distribution< double > dist( 0.0 , 1.0 );
+    for( size_t i=0 ; i<population_size ; ++i )
+    {
+        pop[i].insert_below( pop[i].root() , "x" );
+        fitness[i] = dist( rng );
+    }
+
+    using any_type = gpcxx::any_genetic_operator< population_type , fitness_type >;
+    using legacy_type = legacy_genetic_operator< population_type , fitness_type >;
+
+    auto reproduce = gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 2 ) );
+    auto crossover = gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng , 10 ) ,
+        gpcxx::make_tournament_selector( rng , 2 ) );
+
+    std::cout << "reproduce" << std::endl;
+    {
+        legacy_type legacy( reproduce );
+        any_type any( reproduce );
+        report( "legacy      " , legacy , pop , fitness , offspring );
+        report( "any         " , any , pop , fitness , offspring );
+        report_slots( "any, slots  " , any , pop , fitness , offspring );
+        copies( any , legacy , offspring );
+    }
+
+    std::cout << "crossover" << std::endl;
+    {
+        legacy_type legacy( crossover );
+        any_type any( crossover );
+        report( "legacy      " , legacy , pop , fitness , offspring );
+        report( "any         " , any , pop , fitness , offspring );
+        report_slots( "any, slots  " , any , pop , fitness , offspring );
+        copies( any , legacy , offspring );
+    }
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * checkpoint.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/io/checkpoint.hpp>
+#include <gpcxx/io/population_json.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+// Time for writing and reading a checkpoint of 16k ramped trees, compared with the json output of the population.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< value_type >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+double milliseconds( clock_type::time_point start )
+{
+    return double( std::chrono::duration_cast< std::chrono::microseconds >( clock_type::now() - start ).count() ) * 1.0e-3;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 16384;
+    std::string const filename = "performance_checkpoint.bin";
+
+    rng_type rng;
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" , "1" , "2" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "exp" , "log" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+    auto node_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 2 , 8 , 0.5 );
+
+    population_type pop( population_size );
+    fitness_type fitness( population_size );
+    std::uniform_real_distribution< double > dist( 0.0 , 1.0 );
+    size_t nodes = 0;
+    for( size_t i=0 ; i<population_size ; ++i )
+    {
+        tree_generator( pop[i] );
+        fitness[i] = dist( rng );
+        nodes += pop[i].size();
+    }
+    std::cout << population_size << " trees with " << nodes << " nodes" << std::endl;
+
+    auto mapper = []( std::string const& s ) {
+        size_t arity = 0;
+        if( ( s == "sin" ) || ( s == "cos" ) || ( s == "exp" ) || ( s == "log" ) ) arity = 1;
+        if( ( s == "+" ) || ( s == "-" ) || ( s == "*" ) || ( s == "/" ) ) arity = 2;
+        return std::make_pair( arity , std::function< value_type( void ) >( [s]() { return s; } ) );
+    };
+
+    gpcxx::checkpoint_state state;
+    state.generation = 1000;
+    state.rng_state = gpcxx::rng_state( rng );
+
+    std::string buffer;
+    auto start = clock_type::now();
+    gpcxx::write_checkpoint( buffer , pop , fitness , state );
+    std::cout << "\twrite_checkpoint      : " << milliseconds( start ) << " ms, " << buffer.size() << " bytes" << std::endl;
+
+    start = clock_type::now();
+    gpcxx::write_checkpoint_file( filename , buffer );
+    std::cout << "\twrite_checkpoint_file : " << milliseconds( start ) << " ms" << std::endl;
+
+    population_type pop2;
+    fitness_type fitness2;
+    gpcxx::checkpoint_state state2;
+    start = clock_type::now();
+    gpcxx::read_checkpoint( gpcxx::read_checkpoint_file( filename ) , pop2 , fitness2 , state2 , mapper );
+    std::cout << "\tread_checkpoint       : " << milliseconds( start ) << " ms" << std::endl;
+
+    {
+        gpcxx::async_checkpoint_writer writer;
+        writer.write( filename , pop , fitness , state );
+        start = clock_type::now();
+        writer.write( filename , pop , fitness , state );
+        std::cout << "\tasync write, blocking : " << milliseconds( start ) << " ms" << std::endl;
+        writer.wait();
+    }
+    std::remove( filename.c_str() );
+
+    start = clock_type::now();
+    {
+        std::ofstream fout( filename );
+        gpcxx::write_population_json( fout , pop , fitness , 0 , "\n" , false );
+    }
+    std::cout << "\twrite_population_json : " << milliseconds( start ) << " ms" << std::endl;
+    std::remove( filename.c_str() );
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * gpcxx/performance/common/counting_new.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_PERFORMANCE_COMMON_COUNTING_NEW_HPP_INCLUDED
+#define GPCXX_PERFORMANCE_COMMON_COUNTING_NEW_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+
+// Replaces the global operator new and delete by malloc and free and counts the allocations in allocation_count. The
+// replacements are definitions, include this header in one translation unit of the benchmark only.
+//
+// All forms are replaced, hence every allocation of the program goes through malloc and every deallocation through
+// free. The replacements are not inlined, otherwise GCC sees free called on the result of operator new at the
+// call sites and reports -Wmismatched-new-delete.
+
+
+#if defined( __GNUC__ )
+#define GPCXX_COUNTING_NEW_NOINLINE __attribute__(( noinline ))
+#else
+#define GPCXX_COUNTING_NEW_NOINLINE
+#endif
+
+
+namespace {
+size_t allocation_count = 0;
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void* operator new( size_t n )
+{
+    ++allocation_count;
+    if( void* p = std::malloc( n ? n : 1 ) ) return p;
+    throw std::bad_alloc();
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void* operator new[]( size_t n )
+{
+    return ::operator new( n );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void* operator new( size_t n , std::nothrow_t const& ) noexcept
+{
+    ++allocation_count;
+    return std::malloc( n ? n : 1 );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void* operator new[]( size_t n , std::nothrow_t const& ) noexcept
+{
+    return ::operator new( n , std::nothrow );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete( void* p ) noexcept
+{
+    std::free( p );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete[]( void* p ) noexcept
+{
+    std::free( p );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete( void* p , size_t ) noexcept
+{
+    std::free( p );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete[]( void* p , size_t ) noexcept
+{
+    std::free( p );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete( void* p , std::nothrow_t const& ) noexcept
+{
+    std::free( p );
+}
+
+GPCXX_COUNTING_NEW_NOINLINE void operator delete[]( void* p , std::nothrow_t const& ) noexcept
+{
+    std::free( p );
+}
+
+#undef GPCXX_COUNTING_NEW_NOINLINE
+
+
+#endif // GPCXX_PERFORMANCE_COMMON_COUNTING_NEW_HPP_INCLUDED
@@ -0,0 +1,140 @@
+/*
+ * crossover_bloat.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/tree.hpp>
+#include <gpcxx/intrusive_nodes.hpp>
+#include <gpcxx/generate.hpp>
+#include <gpcxx/operator.hpp>
+#include <gpcxx/operator/size_fair_crossover_strategy.hpp>
+#include <gpcxx/operator/homologous_crossover_strategy.hpp>
+#include <gpcxx/eval.hpp>
+#include <gpcxx/evolve.hpp>
+#include <gpcxx/benchmark_problems.hpp>
+#include <gpcxx/primitive_sets.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Bloat of the crossover strategies on pagie1 with the height limit 17 of the artificial ant example. Every strategy
+// starts from the same population and prints the average tree size and the wall time of every tenth generation,
+// breeding and evaluation included.
+//
+// usage: performance_crossover_bloat [generations]
+
+
+auto problem = gpcxx::generate_pagie1();
+using problem_type = decltype( problem );
+static const size_t dim = problem_type::dim;
+
+using rng_type = std::mt19937;
+using context_type = gpcxx::regression_context< double , dim >;
+using node_type = gpcxx::intrusive_named_func_node< double , const context_type >;
+using tree_type = gpcxx::intrusive_tree< node_type >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+
+struct evaluator
+{
+    using context_type = gpcxx::regression_context< double , dim >;
+    using value_type = double;
+    value_type operator()( tree_type const& t , context_type const& c ) const
+    {
+        return t.root()->eval( c );
+    }
+};
+
+size_t const population_size = 1000;
+size_t const number_elite = 1;
+double const mutation_rate = 0.1;
+double const crossover_rate = 0.8;
+double const reproduction_rate = 0.1;
+size_t const min_tree_height = 2 , max_tree_height = 17;
+size_t const tournament_size = 7;
+
+
+template< typename Strategy , typename Evaluate , typename NodeGenerator >
+void run( std::string const& name , Strategy strategy , rng_type& rng , NodeGenerator& node_generator , Evaluate evaluate ,
+          population_type pop , fitness_type fitness , size_t generations )
+{
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 1 , 4 , 0.5 );
+    gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > evolver( rng , number_elite );
+    evolver.add_operator( gpcxx::make_mutation(
+        gpcxx::make_point_mutation( rng , tree_generator , max_tree_height , 20 ) ,
+        gpcxx::make_tournament_selector( rng , tournament_size ) ) , mutation_rate );
+    evolver.add_operator( gpcxx::make_crossover(
+        strategy , gpcxx::make_tournament_selector( rng , tournament_size ) ) , crossover_rate );
+    evolver.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , tournament_size ) ) , reproduction_rate );
+
+    std::cout << name << std::endl;
+    gpcxx::timer timer;
+    size_t last_report = 0;
+    for( size_t g=1 ; g<=generations ; ++g )
+    {
+        evolver.next_generation( pop , fitness );
+        for( size_t i=0 ; i<pop.size() ; ++i ) fitness[i] = evaluate( pop[i] );
+        if( ( g % 10 == 0 ) || ( g == generations ) )
+        {
+            double size = 0.0;
+            for( auto const& t : pop ) size += double( t.size() );
+            std::cout << "\tgeneration " << g << " : average size " << size / double( pop.size() )
+                      << " , " << timer.seconds() / double( g - last_report ) << " s / generation , best "
+                      << *std::min_element( fitness.begin() , fitness.end() ) << std::endl;
+            timer.restart();
+            last_report = g;
+        }
+    }
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t generations = ( argc > 1 ) ? size_t( std::atoi( argv[1] ) ) : 50;
+
+    auto node_generator = gpcxx::koza_intrusive_primitve_set< node_type , rng_type , dim , false >();
+    auto fitness_f = gpcxx::make_regression_fitness( evaluator {} );
+    auto evaluate = [fitness_f]( tree_type const& t ) { return fitness_f( t , problem ); };
+
+    population_type pop( population_size );
+    fitness_type fitness( population_size );
+    {
+        rng_type rng( 42 );
+        auto tree_generator = gpcxx::make_ramp( rng , node_generator , min_tree_height , 6 , 0.5 );
+        for( size_t i=0 ; i<population_size ; ++i )
+        {
+            tree_generator( pop[i] );
+            fitness[i] = evaluate( pop[i] );
+        }
+    }
+
+    {
+        rng_type rng( 1 );
+        run( "one_point_crossover_strategy" , gpcxx::make_one_point_crossover_strategy( rng , max_tree_height ) ,
+             rng , node_generator , evaluate , pop , fitness , generations );
+    }
+    {
+        rng_type rng( 1 );
+        run( "size_fair_crossover_strategy" , gpcxx::make_size_fair_crossover_strategy( rng , max_tree_height ) ,
+             rng , node_generator , evaluate , pop , fitness , generations );
+    }
+    {
+        rng_type rng( 1 );
+        run( "homologous_crossover_strategy" , gpcxx::make_homologous_crossover_strategy( rng , max_tree_height ) ,
+             rng , node_generator , evaluate , pop , fitness , generations );
+    }
+
+    return 0;
+}
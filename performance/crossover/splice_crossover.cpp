@@ -0,0 +1,98 @@
+/*
+ * splice_crossover.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/splice_crossover.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Time for filling a new population of 4096 slots with one point crossover. crossover copies both parents and swaps
+// the subtrees, splice_crossover builds the offspring directly. With one slot per operation the second offspring is
+// discarded, as it happens for the last slot of a generation.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< value_type >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+
+
+template< typename Crossover >
+void run( std::string const& name , Crossover c , population_type const& pop , fitness_type const& fitness ,
+          size_t slots_per_operation , size_t generations )
+{
+    population_type new_pop( pop.size() );
+    gpcxx::timer timer;
+    size_t nodes = 0;
+    for( size_t g=0 ; g<generations ; ++g )
+    {
+        for( auto first = new_pop.begin() ; first != new_pop.end() ; )
+        {
+            auto last = std::min( first + slots_per_operation , new_pop.end() );
+            first = c( pop , fitness , first , last );
+        }
+        for( auto const& t : new_pop ) nodes += t.size();
+    }
+    std::cout << name << " : " << timer.seconds() << " s , " << nodes << " nodes" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 4096;
+    size_t const generations = 50;
+    size_t const max_height = 10;
+
+    rng_type rng;
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" , "1" , "2" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "exp" , "log" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+    auto node_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 2 , max_height , 0.5 );
+
+    std::uniform_real_distribution< double > fitness_dist( 0.0 , 1.0 );
+    population_type pop( population_size );
+    fitness_type fitness( population_size );
+    for( size_t i=0 ; i<population_size ; ++i )
+    {
+        tree_generator( pop[i] );
+        fitness[i] = fitness_dist( rng );
+    }
+
+    for( size_t slots : { size_t( 2 ) , size_t( 1 ) } )
+    {
+        std::cout << slots << " slot(s) per operation" << std::endl;
+        rng_type rng1( 1 ) , rng2( 1 );
+        run( "\tcrossover       " , gpcxx::make_crossover(
+            gpcxx::make_one_point_crossover_strategy( rng1 , max_height ) ,
+            gpcxx::make_tournament_selector( rng1 , 7 ) ) , pop , fitness , slots , generations );
+        run( "\tsplice_crossover" , gpcxx::make_splice_crossover(
+            gpcxx::make_one_point_crossover_strategy( rng2 , max_height ) ,
+            gpcxx::make_tournament_selector( rng2 , 7 ) ) , pop , fitness , slots , generations );
+    }
+
+    return 0;
+}
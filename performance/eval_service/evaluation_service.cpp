@@ -0,0 +1,129 @@
+/*
+ * evaluation_service.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/eval/evaluation_service.hpp>
+#include <gpcxx/eval/regression_fitness.hpp>
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/tree/intrusive_tree.hpp>
+#include <gpcxx/tree/intrusive_nodes/intrusive_named_func_node.hpp>
+#include <gpcxx/tree/intrusive_functions.hpp>
+#include <gpcxx/app/benchmark_problems/pagie.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+// Latency of a single round trip through the evaluation service and throughput for an increasing number of
+// loopback workers. The individuals are ramped trees, the fitness is the regression fitness on pagie1.
+
+
+using rng_type = std::mt19937;
+using context_type = gpcxx::regression_context< double , 2 >;
+using node_type = gpcxx::intrusive_named_func_node< double , context_type const >;
+using tree_type = gpcxx::intrusive_tree< node_type >;
+using clock_type = std::chrono::steady_clock;
+
+struct evaluator
+{
+    using context_type = ::context_type;
+    using value_type = double;
+    value_type operator()( tree_type const& t , context_type const& c ) const { return t.root()->eval( c ); }
+};
+
+double seconds_since( clock_type::time_point start )
+{
+    return std::chrono::duration< double >( clock_type::now() - start ).count();
+}
+
+
+int main( int argc , char** argv )
+{
+    rng_type rng;
+    auto problem = gpcxx::generate_pagie1();
+
+    std::vector< node_type > terminals { node_type( gpcxx::array_terminal< 0 >() , "x" ) , node_type( gpcxx::array_terminal< 1 >() , "y" ) };
+    std::vector< node_type > unaries { node_type( gpcxx::sin_func() , "sin" ) , node_type( gpcxx::cos_func() , "cos" ) ,
+                                       node_type( gpcxx::exp_func() , "exp" ) , node_type( gpcxx::log_func() , "log" ) };
+    std::vector< node_type > binaries { node_type( gpcxx::plus_func() , "+" ) , node_type( gpcxx::minus_func() , "-" ) ,
+                                        node_type( gpcxx::multiplies_func() , "*" ) , node_type( gpcxx::divides_func() , "/" ) };
+
+    std::unordered_map< std::string , std::pair< size_t , node_type > > symbols;
+    for( auto const& n : terminals ) symbols.emplace( n.name() , std::make_pair( 0 , n ) );
+    for( auto const& n : unaries ) symbols.emplace( n.name() , std::make_pair( 1 , n ) );
+    for( auto const& n : binaries ) symbols.emplace( n.name() , std::make_pair( 2 , n ) );
+    auto mapper = [symbols]( std::string const& s ) {
+        auto const& entry = symbols.at( s );
+        node_type n = entry.second;
+        return std::make_pair( entry.first , [n]() { return n; } );
+    };
+
+    auto node_generator = gpcxx::node_generator< node_type , rng_type , 3 > {
+        { 1.0 , 0 , gpcxx::make_uniform_symbol( terminals ) } ,
+        { 1.0 , 1 , gpcxx::make_uniform_symbol( unaries ) } ,
+        { 1.0 , 2 , gpcxx::make_uniform_symbol( binaries ) } };
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 4 , 10 , 0.5 );
+
+    size_t const number_of_individuals = 20000;
+    std::vector< std::string > payloads;
+    for( size_t i=0 ; i<number_of_individuals ; ++i )
+    {
+        tree_type tree;
+        tree_generator( tree );
+        payloads.push_back( gpcxx::binary_string( tree ) );
+    }
+
+    auto fitness_f = gpcxx::make_regression_fitness( evaluator {} );
+    auto worker = gpcxx::make_loopback_worker< tree_type >( [fitness_f,problem]( tree_type const& t ) { return fitness_f( t , problem ); } , mapper );
+
+    std::cout << "Evaluation service, " << number_of_individuals << " ramped trees, pagie1 fitness" << std::endl;
+
+    {
+        auto start = clock_type::now();
+        double sum = 0.0;
+        for( auto const& p : payloads ) sum += worker( p );
+        std::cout << "\tsequential, no service          : " << seconds_since( start ) << " s (checksum " << sum << ")" << std::endl;
+    }
+
+    {
+        gpcxx::evaluation_service< double > service( 1 , worker );
+        size_t const n = 2000;
+        auto start = clock_type::now();
+        for( size_t i=0 ; i<n ; ++i ) service.submit( payloads[i] ).get();
+        std::cout << "\tround trip latency (1 worker)   : " << seconds_since( start ) / double( n ) * 1.0e6 << " us" << std::endl;
+    }
+
+    size_t hw = std::max( 1u , std::thread::hardware_concurrency() );
+    for( size_t workers = 1 ; workers <= hw ; workers *= 2 )
+    {
+        gpcxx::evaluation_service< double > service( workers , worker );
+        auto start = clock_type::now();
+        std::vector< std::future< double > > results;
+        results.reserve( payloads.size() );
+        for( auto const& p : payloads ) results.push_back( service.submit( p ) );
+        double sum = 0.0;
+        for( auto& r : results ) sum += r.get();
+        double t = seconds_since( start );
+        std::cout << "\tthroughput, " << workers << " workers" << std::string( workers < 10 ? 11 : 10 , ' ' ) << "  : "
+                  << double( number_of_individuals ) / t << " evaluations/s (checksum " << sum << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * ptc2.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/generate/ptc2.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Time for generating an initial population with ramped half and half and with PTC2, and the mean and the standard
+// deviation of the tree sizes. ramp only controls the height, PTC2 draws the size uniformly.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< value_type >;
+
+
+template< typename Generator >
+void run( std::string const& name , Generator const& generator )
+{
+    size_t const trees = 200000;
+
+    std::vector< tree_type > pop( trees );
+    gpcxx::timer timer;
+    for( auto& t : pop ) generator( t );
+    double time = timer.seconds();
+
+    double mean = 0.0 , sq = 0.0;
+    for( auto const& t : pop )
+    {
+        mean += double( t.size() );
+        sq += double( t.size() ) * double( t.size() );
+    }
+    mean /= double( trees );
+    double dev = std::sqrt( sq / double( trees ) - mean * mean );
+    std::cout << name << " : " << time << " s , " << time / ( mean * double( trees ) ) * 1.0e9 << " ns per node , size "
+              << mean << " +- " << dev << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    rng_type rng;
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" , "1" , "2" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "exp" , "log" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+    auto node_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+
+    run( "ramp( 2 , 8 )      " , gpcxx::make_ramp( rng , node_generator , 2 , 8 , 0.5 ) );
+    run( "ptc2( 1 , 18 , 8 ) " , gpcxx::make_ptc2( rng , node_generator , 1 , 18 , 8 ) );
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * mutation_bloat.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/tree.hpp>
+#include <gpcxx/intrusive_nodes.hpp>
+#include <gpcxx/generate.hpp>
+#include <gpcxx/operator.hpp>
+#include <gpcxx/operator/hoist_mutation.hpp>
+#include <gpcxx/operator/shrink_mutation.hpp>
+#include <gpcxx/eval.hpp>
+#include <gpcxx/evolve.hpp>
+#include <gpcxx/benchmark_problems.hpp>
+#include <gpcxx/primitive_sets.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Bloat on pagie1 with point mutation only and with a part of the mutations replaced by hoist and shrink mutation.
+// Every configuration starts from the same population, the average tree size, the evaluation time and the best
+// fitness of every tenth generation are averaged over the runs, which use different random numbers.
+//
+// usage: performance_mutation_bloat [generations] [runs]
+
+
+auto problem = gpcxx::generate_pagie1();
+using problem_type = decltype( problem );
+static const size_t dim = problem_type::dim;
+
+using rng_type = std::mt19937;
+using context_type = gpcxx::regression_context< double , dim >;
+using node_type = gpcxx::intrusive_named_func_node< double , const context_type >;
+using tree_type = gpcxx::intrusive_tree< node_type >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+
+struct evaluator
+{
+    using context_type = gpcxx::regression_context< double , dim >;
+    using value_type = double;
+    value_type operator()( tree_type const& t , context_type const& c ) const
+    {
+        return t.root()->eval( c );
+    }
+};
+
+size_t const population_size = 1000;
+size_t const number_elite = 1;
+double const mutation_rate = 0.1;
+double const crossover_rate = 0.8;
+double const reproduction_rate = 0.1;
+size_t const min_tree_height = 2 , max_tree_height = 17;
+size_t const tournament_size = 7;
+
+
+struct generation_stat
+{
+    double size = 0.0;
+    double eval_time = 0.0;
+    double best = 0.0;
+};
+
+
+// hoist_rate and shrink_rate are taken from the mutation rate, the statistics of every generation are added to stat
+template< typename Evaluate , typename NodeGenerator >
+void run( double hoist_rate , double shrink_rate , rng_type& rng , NodeGenerator& node_generator , Evaluate evaluate ,
+          population_type pop , fitness_type fitness , std::vector< generation_stat >& stat )
+{
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 1 , 4 , 0.5 );
+    gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > evolver( rng , number_elite );
+    evolver.add_operator( gpcxx::make_mutation(
+        gpcxx::make_point_mutation( rng , tree_generator , max_tree_height , 20 ) ,
+        gpcxx::make_tournament_selector( rng , tournament_size ) ) , mutation_rate - hoist_rate - shrink_rate );
+    if( hoist_rate > 0.0 )
+        evolver.add_operator( gpcxx::make_mutation( gpcxx::make_hoist_mutation( rng ) ,
+            gpcxx::make_tournament_selector( rng , tournament_size ) ) , hoist_rate );
+    if( shrink_rate > 0.0 )
+        evolver.add_operator( gpcxx::make_mutation( gpcxx::make_shrink_mutation( rng ) ,
+            gpcxx::make_tournament_selector( rng , tournament_size ) ) , shrink_rate );
+    evolver.add_operator( gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng , max_tree_height ) ,
+        gpcxx::make_tournament_selector( rng , tournament_size ) ) , crossover_rate );
+    evolver.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , tournament_size ) ) , reproduction_rate );
+
+    gpcxx::timer timer;
+    for( auto& st : stat )
+    {
+        evolver.next_generation( pop , fitness );
+        timer.restart();
+        for( size_t i=0 ; i<pop.size() ; ++i ) fitness[i] = evaluate( pop[i] );
+        st.eval_time += timer.seconds();
+        for( auto const& t : pop ) st.size += double( t.size() ) / double( pop.size() );
+        st.best += *std::min_element( fitness.begin() , fitness.end() );
+    }
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t generations = ( argc > 1 ) ? size_t( std::atoi( argv[1] ) ) : 50;
+    size_t runs = ( argc > 2 ) ? size_t( std::atoi( argv[2] ) ) : 5;
+
+    auto node_generator = gpcxx::koza_intrusive_primitve_set< node_type , rng_type , dim , false >();
+    auto fitness_f = gpcxx::make_regression_fitness( evaluator {} );
+    auto evaluate = [fitness_f]( tree_type const& t ) { return fitness_f( t , problem ); };
+
+    population_type pop( population_size );
+    fitness_type fitness( population_size );
+    {
+        rng_type rng( 42 );
+        auto tree_generator = gpcxx::make_ramp( rng , node_generator , min_tree_height , 6 , 0.5 );
+        for( size_t i=0 ; i<population_size ; ++i )
+        {
+            tree_generator( pop[i] );
+            fitness[i] = evaluate( pop[i] );
+        }
+    }
+
+    struct configuration
+    {
+        std::string name;
+        double hoist_rate;
+        double shrink_rate;
+    };
+    std::vector< configuration > configurations = {
+        { "point_mutation" , 0.0 , 0.0 } ,
+        { "point_mutation + hoist_mutation" , 0.05 , 0.0 } ,
+        { "point_mutation + shrink_mutation" , 0.0 , 0.05 } ,
+        { "point_mutation + hoist_mutation + shrink_mutation" , 0.025 , 0.025 } };
+
+    for( auto const& c : configurations )
+    {
+        std::vector< generation_stat > stat( generations );
+        for( size_t r=0 ; r<runs ; ++r )
+        {
+            rng_type rng( r + 1 );
+            run( c.hoist_rate , c.shrink_rate , rng , node_generator , evaluate , pop , fitness , stat );
+        }
+
+        std::cout << c.name << std::endl;
+        double total_eval_time = 0.0;
+        for( auto const& st : stat ) total_eval_time += st.eval_time / double( runs );
+        for( size_t g=1 ; g<=generations ; ++g )
+        {
+            if( ( g % 10 != 0 ) && ( g != generations ) ) continue;
+            auto const& st = stat[ g - 1 ];
+            std::cout << "\tgeneration " << g << " : average size " << st.size / double( runs )
+                      << " , eval " << st.eval_time / double( runs ) << " s , best " << st.best / double( runs ) << std::endl;
+        }
+        std::cout << "\ttotal eval " << total_eval_time << " s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * node_generation.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/point_mutation.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/static_node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Time for generating trees and for point mutations with node_generator, which calls the symbol generators through
+// std::function, and with static_node_generator, which calls them directly.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< value_type >;
+
+
+template< typename NodeGenerator >
+void run( std::string const& name , NodeGenerator& node_generator , std::vector< tree_type > pop )
+{
+    size_t const trees = 200000;
+    size_t const rounds = 20;
+
+    rng_type rng;
+    auto tree_generator = gpcxx::make_ramp( rng , node_generator , 2 , 8 , 0.5 );
+    size_t nodes = 0;
+    gpcxx::timer timer;
+    for( size_t i=0 ; i<trees ; ++i )
+    {
+        tree_type t;
+        tree_generator( t );
+        nodes += t.size();
+    }
+    double generation_time = timer.seconds();
+
+    auto subtree_generator = gpcxx::make_ramp( rng , node_generator , 1 , 4 , 0.5 );
+    auto mutation = gpcxx::make_point_mutation( rng , subtree_generator , 8 , 20 );
+    timer.restart();
+    for( size_t r=0 ; r<rounds ; ++r )
+        for( auto& t : pop ) mutation( t );
+    double mutation_time = timer.seconds();
+
+    std::cout << name << " : generation " << generation_time << " s ( " << nodes << " nodes ) , mutation "
+              << mutation_time << " s" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" , "1" , "2" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "exp" , "log" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+
+    auto dynamic_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+    auto static_generator = gpcxx::make_static_node_generator< value_type >(
+        gpcxx::make_weighted_generator( 2.0 * double( terminals.num_symbols() ) , 0 , terminals ) ,
+        gpcxx::make_weighted_generator( double( unaries.num_symbols() ) , 1 , unaries ) ,
+        gpcxx::make_weighted_generator( double( binaries.num_symbols() ) , 2 , binaries ) );
+
+    std::vector< tree_type > pop( 4096 );
+    {
+        rng_type rng( 42 );
+        auto tree_generator = gpcxx::make_ramp( rng , dynamic_generator , 2 , 8 , 0.5 );
+        for( auto& t : pop ) tree_generator( t );
+    }
+
+    run( "node_generator       " , dynamic_generator , pop );
+    run( "static_node_generator" , static_generator , pop );
+
+    return 0;
+}
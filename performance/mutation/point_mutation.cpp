@@ -0,0 +1,88 @@
+/*
+ * point_mutation.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/point_mutation.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/generate/uniform_symbol.hpp>
+#include <gpcxx/generate/node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include "../common/counting_new.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Time, generated subtrees and calls of the global operator new per point mutation of trees close to the height
+// limit. The first run hides the height budget of ramp, hence point_mutation generates subtrees until one fits. The
+// second run generates only subtrees which fit into the remaining height.
+
+
+using value_type = std::string;
+using rng_type = std::mt19937;
+using tree_type = gpcxx::basic_tree< value_type >;
+using population_type = std::vector< tree_type >;
+
+
+template< typename Generator >
+void run( std::string const& name , rng_type& rng , Generator& generator , size_t const& generated ,
+          population_type pop , size_t max_height , size_t rounds )
+{
+    auto mutation = gpcxx::make_point_mutation( rng , generator , max_height , 128 );
+    size_t mutations = 0;
+    size_t allocations = allocation_count;
+    size_t generated_before = generated;
+    gpcxx::timer timer;
+    for( size_t r=0 ; r<rounds ; ++r )
+    {
+        for( auto& t : pop ) mutation( t );
+        mutations += pop.size();
+    }
+    double seconds = timer.seconds();
+    allocations = allocation_count - allocations;
+    std::cout << name << " : " << seconds << " s , "
+              << double( generated - generated_before ) / double( mutations ) << " generated subtrees / mutation , "
+              << double( allocations ) / double( mutations ) << " allocations / mutation" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 4096;
+    size_t const rounds = 20;
+    size_t const max_height = 8;
+
+    rng_type rng;
+    auto terminals = gpcxx::uniform_symbol< value_type >{ { "x" , "y" , "z" , "1" , "2" } };
+    auto unaries = gpcxx::uniform_symbol< value_type >{ { "sin" , "cos" , "exp" , "log" } };
+    auto binaries = gpcxx::uniform_symbol< value_type >{ { "+" , "-" , "*" , "/" } };
+    auto node_generator = gpcxx::node_generator< value_type , rng_type , 3 >{
+        { 2.0 * double( terminals.num_symbols() ) , 0 , terminals } ,
+        { double( unaries.num_symbols() ) , 1 , unaries } ,
+        { double( binaries.num_symbols() ) , 2 , binaries } };
+
+    auto init_generator = gpcxx::make_ramp( rng , node_generator , max_height - 1 , max_height , 0.0 );
+    population_type pop( population_size );
+    for( auto& t : pop ) init_generator( t );
+
+    auto subtree_generator = gpcxx::make_ramp( rng , node_generator , 1 , 5 , 0.5 );
+    size_t generated = 0;
+    auto rejecting = [&]( tree_type& t ) { ++generated; subtree_generator( t ); };
+    auto budgeted = [&]( tree_type& t , size_t h ) { ++generated; subtree_generator( t , h ); };
+
+    run( "rejection    " , rng , rejecting , generated , pop , max_height , rounds );
+    run( "height budget" , rng , budgeted , generated , pop , max_height , rounds );
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * pipelined_symbolic_regression.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/tree.hpp>
+#include <gpcxx/intrusive_nodes.hpp>
+#include <gpcxx/generate.hpp>
+#include <gpcxx/operator.hpp>
+#include <gpcxx/eval.hpp>
+#include <gpcxx/evolve.hpp>
+#include <gpcxx/evolve/pipelined_evolution.hpp>
+#include <gpcxx/benchmark_problems.hpp>
+#include <gpcxx/primitive_sets.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+// The pagie1 setup of performance/benchmarks/symbolic_regression.cpp with a fixed seed. Compares the generation
+// barrier, where a single thread breeds and all threads evaluate afterwards, with pipelined_evolution. The CPU
+// utilisation is the process CPU time divided by wall time times number of threads.
+//
+// usage: performance_pipelined_symbolic_regression [threads] [generations]
+
+
+auto problem = gpcxx::generate_pagie1();
+using problem_type = decltype( problem );
+static const size_t dim = problem_type::dim;
+
+using rng_type = std::mt19937;
+using context_type = gpcxx::regression_context< double , dim >;
+using node_type = gpcxx::intrusive_named_func_node< double , const context_type >;
+using tree_type = gpcxx::intrusive_tree< node_type >;
+using population_type = std::vector< tree_type >;
+using fitness_type = std::vector< double >;
+
+struct evaluator
+{
+    using context_type = gpcxx::regression_context< double , dim >;
+    using value_type = double;
+    value_type operator()( tree_type const& t , context_type const& c ) const
+    {
+        return t.root()->eval( c );
+    }
+};
+
+size_t const population_size = 4000;
+size_t const number_elite = 1;
+double const mutation_rate = 0.2;
+double const crossover_rate = 0.6;
+double const reproduction_rate = 0.3;
+size_t const min_tree_height = 4 , max_tree_height = 12;
+size_t const tournament_size = 15;
+
+using clock_type = std::chrono::steady_clock;
+
+
+template< typename Evolver , typename TreeGenerator >
+void add_operators( Evolver& evolver , rng_type& rng , TreeGenerator& tree_generator )
+{
+    evolver.add_operator( gpcxx::make_mutation(
+        gpcxx::make_point_mutation( rng , tree_generator , max_tree_height , 20 ) ,
+        gpcxx::make_tournament_selector( rng , tournament_size ) ) , mutation_rate );
+    evolver.add_operator( gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng , 10 ) ,
+        gpcxx::make_tournament_selector( rng , tournament_size ) ) , crossover_rate );
+    evolver.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , tournament_size ) ) , reproduction_rate );
+}
+
+struct measurement
+{
+    double wall;
+    double cpu;
+    double best;
+};
+
+template< typename Run >
+measurement measure( Run run )
+{
+    auto start = clock_type::now();
+    std::clock_t cpu_start = std::clock();
+    double best = run();
+    double cpu = double( std::clock() - cpu_start ) / double( CLOCKS_PER_SEC );
+    double wall = std::chrono::duration< double >( clock_type::now() - start ).count();
+    return measurement { wall , cpu , best };
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t threads = ( argc > 1 ) ? size_t( std::atoi( argv[1] ) ) : std::max< size_t >( std::thread::hardware_concurrency() , 1 );
+    size_t generations = ( argc > 2 ) ? size_t( std::atoi( argv[2] ) ) : 20;
+
+    auto node_generator = gpcxx::koza_intrusive_primitve_set< node_type , rng_type , dim , false >();
+    auto fitness_f = gpcxx::make_regression_fitness( evaluator {} );
+    auto evaluate = [fitness_f]( tree_type const& t ) { return fitness_f( t , problem ); };
+
+    population_type initial( population_size );
+    fitness_type initial_fitness( population_size );
+    {
+        rng_type rng( 42 );
+        auto tree_generator = gpcxx::make_ramp( rng , node_generator , min_tree_height , max_tree_height , 0.5 );
+        for( size_t i=0 ; i<population_size ; ++i )
+        {
+            tree_generator( initial[i] );
+            initial_fitness[i] = evaluate( initial[i] );
+        }
+    }
+
+    auto barrier = [&]() {
+        rng_type rng( 1 );
+        auto tree_generator = gpcxx::make_ramp( rng , node_generator , min_tree_height , max_tree_height , 0.5 );
+        gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > evolver( rng , number_elite );
+        add_operators( evolver , rng , tree_generator );
+        population_type pop = initial;
+        fitness_type fitness = initial_fitness;
+        for( size_t g=0 ; g<generations ; ++g )
+        {
+            evolver.next_generation( pop , fitness );
+            std::vector< std::thread > pool;
+            auto work = [&]( size_t t ) {
+                for( size_t i=t ; i<pop.size() ; i+=threads ) fitness[i] = evaluate( pop[i] );
+            };
+            for( size_t t=1 ; t<threads ; ++t ) pool.emplace_back( work , t );
+            work( 0 );
+            for( auto& th : pool ) th.join();
+        }
+        return *std::min_element( fitness.begin() , fitness.end() );
+    };
+
+    auto pipelined = [&]( double min_evaluated ) {
+        return [&,min_evaluated]() {
+            rng_type rng( 1 );
+            auto tree_generator = gpcxx::make_ramp( rng , node_generator , min_tree_height , max_tree_height , 0.5 );
+            gpcxx::pipelined_evolution< population_type , fitness_type , rng_type > evolver( rng , number_elite , threads , min_evaluated );
+            add_operators( evolver , rng , tree_generator );
+            population_type pop = initial;
+            fitness_type fitness = initial_fitness;
+            evolver.evolve( pop , fitness , generations , evaluate );
+            return *std::min_element( fitness.begin() , fitness.end() );
+        };
+    };
+
+    auto report = [&]( char const* name , measurement m ) {
+        std::cout << name << " : wall " << m.wall << " s , cpu " << m.cpu << " s , utilisation "
+                  << 100.0 * m.cpu / ( m.wall * double( threads ) ) << " % , best " << m.best << std::endl;
+    };
+
+    std::cout << "threads " << threads << " , generations " << generations << " , population " << population_size << std::endl;
+    report( "barrier              " , measure( barrier ) );
+    report( "pipelined min 1.0    " , measure( pipelined( 1.0 ) ) );
+    report( "pipelined min 0.5    " , measure( pipelined( 0.5 ) ) );
+
+    return 0;
+}
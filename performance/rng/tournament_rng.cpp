@@ -0,0 +1,92 @@
+/*
+ * tournament_rng.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/philox_engine.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/app/timer.hpp>
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cstdint>
+
+
+// Compares the shared std::mt19937 with the counter based engine for tournament heavy workloads:
+// 16k individuals, tournament size 15, one tournament per parent.
+
+
+template< typename Rng >
+size_t run_shared( Rng& rng , std::vector< int > const& pop , std::vector< double > const& fitness , size_t generations )
+{
+    auto selector = gpcxx::make_tournament_selector( rng , 15 );
+    size_t checksum = 0;
+    for( size_t g=0 ; g<generations ; ++g )
+        for( size_t i=0 ; i<pop.size() ; ++i )
+            checksum += *selector( pop , fitness );
+    return checksum;
+}
+
+size_t run_streams( std::uint64_t seed , std::vector< int > const& pop , std::vector< double > const& fitness , size_t generations )
+{
+    size_t checksum = 0;
+    for( size_t g=0 ; g<generations ; ++g )
+        for( size_t i=0 ; i<pop.size() ; ++i )
+        {
+            // every offspring owns its stream, hence it can be recreated independently
+            auto rng = gpcxx::make_philox_stream( seed , std::uint32_t( g ) , std::uint32_t( i ) , 0 );
+            auto selector = gpcxx::make_tournament_selector( rng , 15 );
+            checksum += *selector( pop , fitness );
+        }
+    return checksum;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 16384;
+    size_t const generations = 200;
+
+    std::vector< int > pop( population_size );
+    std::vector< double > fitness( population_size );
+    {
+        std::mt19937 rng;
+        std::uniform_real_distribution< double > dist( 0.0 , 1.0 );
+        for( size_t i=0 ; i<population_size ; ++i )
+        {
+            pop[i] = int( i );
+            fitness[i] = dist( rng );
+        }
+    }
+
+    std::cout << "Tournament selection, population " << population_size << ", tournament size 15, " << generations << " generations" << std::endl;
+
+    {
+        std::mt19937 rng;
+        gpcxx::timer timer;
+        size_t checksum = run_shared( rng , pop , fitness , generations );
+        std::cout << "\tstd::mt19937 (shared)            : " << timer.seconds() << " s (checksum " << checksum << ")" << std::endl;
+    }
+
+    {
+        gpcxx::philox_engine rng( 42 );
+        gpcxx::timer timer;
+        size_t checksum = run_shared( rng , pop , fitness , generations );
+        std::cout << "\tphilox_engine (shared)           : " << timer.seconds() << " s (checksum " << checksum << ")" << std::endl;
+    }
+
+    {
+        gpcxx::timer timer;
+        size_t checksum = run_streams( 42 , pop , fitness , generations );
+        std::cout << "\tphilox_engine (stream/offspring) : " << timer.seconds() << " s (checksum " << checksum << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * lexicase_selection.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/lexicase_selector.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// Time for the epsilon lexicase selection of one generation of 4096 individuals on 1024 cases. The errors of an
+// individual are correlated over the cases, like the errors of regression models.
+
+
+using clock_type = std::chrono::high_resolution_clock;
+
+int main( int argc , char** argv )
+{
+    size_t const individuals = 4096;
+    size_t const cases = 1024;
+    size_t const generations = 10;
+
+    std::mt19937 rng;
+    std::lognormal_distribution< double > quality( 0.0 , 1.0 );
+    std::normal_distribution< double > noise( 0.0 , 1.0 );
+    gpcxx::error_matrix<> errors( individuals , cases );
+    for( size_t i=0 ; i<individuals ; ++i )
+    {
+        double q = quality( rng );
+        for( size_t c=0 ; c<cases ; ++c ) errors( i , c ) = q * std::abs( noise( rng ) );
+    }
+
+    gpcxx::epsilon_lexicase_selector< std::mt19937 > selector( rng );
+    std::vector< size_t > winners;
+    auto start = clock_type::now();
+    size_t check = 0;
+    for( size_t g=0 ; g<generations ; ++g )
+    {
+        selector.select( errors , individuals , winners );
+        for( auto w : winners ) check += w;
+    }
+    double ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    std::cout << "epsilon lexicase, " << individuals << " x " << cases << " : " << ns / double( generations ) * 1.0e-6
+              << " ms per generation, " << ns / double( generations * individuals ) << " ns per selection ("
+              << check << ")" << std::endl;
+
+    return 0;
+}
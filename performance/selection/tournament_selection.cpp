@@ -0,0 +1,81 @@
+/*
+ * tournament_selection.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/operator/batch_tournament_selector.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Time for the selection of the parents of one generation: tournament_selector selects one parent per call,
+// batch_tournament_selector draws the winners of all tournaments at once.
+
+
+using clock_type = std::chrono::high_resolution_clock;
+
+template< typename F >
+void report( std::string const& name , F f , size_t generations , size_t selections )
+{
+    auto start = clock_type::now();
+    size_t check = 0;
+    for( size_t g=0 ; g<generations ; ++g ) check += f();
+    double ns = double( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+    std::cout << "\t" << name << " : " << ns / double( generations ) * 1.0e-6 << " ms per generation, "
+              << ns / double( generations * selections ) << " ns per selection (" << check << ")" << std::endl;
+}
+
+
+int main( int argc , char** argv )
+{
+    size_t const population_size = 16384;
+    size_t const generations = 50;
+
+    std::mt19937 rng;
+    std::vector< size_t > pop( population_size );
+    std::vector< double > fitness( population_size );
+    std::uniform_real_distribution< double > dist( 0.0 , 1.0 );
+    for( auto& f : fitness ) f = dist( rng );
+
+    size_t const threads = std::max< size_t >( std::thread::hardware_concurrency() , 1 );
+
+    for( size_t tournament_size : { 2 , 7 , 15 } )
+    {
+        std::cout << "tournament size " << tournament_size << std::endl;
+
+        auto selector = gpcxx::make_tournament_selector( rng , tournament_size );
+        report( "tournament_selector                " , [&]() {
+            size_t sum = 0;
+            for( size_t i=0 ; i<population_size ; ++i ) sum += size_t( selector( pop , fitness ) - pop.begin() );
+            return sum; } , generations , population_size );
+
+        std::vector< size_t > winners;
+        gpcxx::batch_tournament_selector batch1( 1 , tournament_size );
+        report( "batch_tournament_selector, 1 thread" , [&]() {
+            batch1.select( fitness , population_size , winners );
+            size_t sum = 0;
+            for( auto w : winners ) sum += w;
+            return sum; } , generations , population_size );
+
+        gpcxx::batch_tournament_selector batchn( 1 , tournament_size , threads );
+        report( "batch_tournament_selector, " + std::to_string( threads ) + " threads" , [&]() {
+            batchn.select( fitness , population_size , winners );
+            size_t sum = 0;
+            for( auto w : winners ) sum += w;
+            return sum; } , generations , population_size );
+    }
+
+    return 0;
+}
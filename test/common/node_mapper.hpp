@@ -0,0 +1,47 @@
+/*
+ * gpcxx/test/common/node_mapper.hpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef GPCXX_TEST_COMMON_NODE_MAPPER_HPP_INCLUDED
+#define GPCXX_TEST_COMMON_NODE_MAPPER_HPP_INCLUDED
+
+#include "test_tree.hpp"
+
+#include <functional>
+#include <string>
+#include <utility>
+
+
+// Maps the symbols of the test trees to ( arity , node generator ), as needed by read_polish and read_binary.
+template< typename TreeTag >
+struct node_mapper
+{
+    using tree_type = typename get_tree_type< TreeTag >::type;
+    using node_type = typename tree_type::value_type;
+    using factory_type = typename get_node_factory< TreeTag >::type;
+    using mapped_type = std::pair< size_t , std::function< node_type( void ) > >;
+
+    mapped_type operator()( std::string const& s ) const
+    {
+        factory_type factory;
+        return mapped_type( arity( s ) , [factory,s]() { return node_type( factory( s ) ); } );
+    }
+
+    static size_t arity( std::string const& s )
+    {
+        if( s == "plus3" ) return 3;
+        if( ( s == "plus" ) || ( s == "minus" ) || ( s == "multiplies" ) ) return 2;
+        if( ( s == "sin" ) || ( s == "cos" ) || ( s == "exp" ) ) return 1;
+        return 0;
+    }
+};
+
+
+#endif // GPCXX_TEST_COMMON_NODE_MAPPER_HPP_INCLUDED
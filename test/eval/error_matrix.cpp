@@ -0,0 +1,84 @@
+/*
+ * test/eval/error_matrix.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/eval/error_matrix.hpp>
+#include <gpcxx/eval/regression_fitness.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#define TESTNAME error_matrix_tests
+
+using namespace std;
+
+namespace {
+
+// the individual is the slope of a line through the origin
+struct slope_eval
+{
+    using context_type = std::array< double , 1 >;
+    using value_type = double;
+    double operator()( double slope , context_type const& x ) const { return slope * x[0]; }
+};
+
+}
+
+TEST( TESTNAME , column_major_layout )
+{
+    gpcxx::error_matrix<> m( 3 , 2 );
+    EXPECT_EQ( m.individuals() , size_t( 3 ) );
+    EXPECT_EQ( m.cases() , size_t( 2 ) );
+    for( size_t i=0 ; i<3 ; ++i )
+        for( size_t c=0 ; c<2 ; ++c )
+            m( i , c ) = double( 10 * i + c );
+
+    // the errors of one case are contiguous
+    EXPECT_EQ( m.data()[0] , 0.0 );
+    EXPECT_EQ( m.data()[1] , 10.0 );
+    EXPECT_EQ( m.data()[2] , 20.0 );
+    EXPECT_EQ( m.data()[3] , 1.0 );
+
+    auto col = m.column( 1 );
+    ASSERT_EQ( col.size() , 3 );
+    EXPECT_EQ( col[0] , 1.0 );
+    EXPECT_EQ( col[1] , 11.0 );
+    EXPECT_EQ( col[2] , 21.0 );
+
+    auto row = m.row( 2 );
+    EXPECT_EQ( row.size() , size_t( 2 ) );
+    row[1] = 42.0;
+    EXPECT_EQ( m( 2 , 1 ) , 42.0 );
+}
+
+TEST( TESTNAME , regression_fitness_stores_errors )
+{
+    gpcxx::regression_training_data< double , 1 > data;
+    data.x[0] = { 1.0 , 2.0 , 3.0 };
+    data.y = { 2.0 , 4.0 , 6.0 };
+
+    auto fitness_f = gpcxx::make_regression_fitness( slope_eval {} );
+    std::vector< double > pop = { 2.0 , 1.0 , 3.0 };
+    std::vector< double > fitness;
+    gpcxx::error_matrix<> errors;
+    gpcxx::evaluate_errors( pop , fitness , errors , data.y.size() ,
+                            [&]( double slope , auto&& e ) { return fitness_f( slope , data , e ); } );
+
+    ASSERT_EQ( errors.individuals() , size_t( 3 ) );
+    ASSERT_EQ( errors.cases() , size_t( 3 ) );
+    for( size_t i=0 ; i<pop.size() ; ++i )
+    {
+        EXPECT_DOUBLE_EQ( fitness[i] , fitness_f( pop[i] , data ) );
+        for( size_t c=0 ; c<3 ; ++c )
+            EXPECT_DOUBLE_EQ( errors( i , c ) , std::abs( pop[i] - 2.0 ) * data.x[0][c] );
+    }
+}
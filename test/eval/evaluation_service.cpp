@@ -0,0 +1,83 @@
+/*
+ * test/eval/evaluation_service.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/eval/evaluation_service.hpp>
+#include <gpcxx/io/binary.hpp>
+
+#include "../common/test_template.hpp"
+#include "../common/node_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define TESTNAME evaluation_service_tests
+
+
+TEST( TESTNAME , results_are_returned_by_futures )
+{
+    gpcxx::evaluation_service< double > service( 4 , []( std::string const& s ) { return double( s.size() ); } );
+    EXPECT_EQ( service.number_of_workers() , size_t( 4 ) );
+
+    std::vector< std::future< double > > results;
+    for( size_t i=0 ; i<100 ; ++i )
+        results.push_back( service.submit( std::string( i , 'x' ) ) );
+    for( size_t i=0 ; i<100 ; ++i )
+        EXPECT_DOUBLE_EQ( results[i].get() , double( i ) );
+}
+
+TEST( TESTNAME , exceptions_are_propagated )
+{
+    gpcxx::evaluation_service< double > service( 2 , []( std::string const& s ) -> double {
+        if( s == "fail" ) throw std::runtime_error( "fail" );
+        return 1.0; } );
+    auto f1 = service.submit( "fail" );
+    auto f2 = service.submit( "ok" );
+    EXPECT_THROW( f1.get() , std::runtime_error );
+    EXPECT_DOUBLE_EQ( f2.get() , 1.0 );
+}
+
+TEST( TESTNAME , workers_own_their_state )
+{
+    // every worker counts its own calls, a shared counter would reach 20 in one of the threads
+    gpcxx::evaluation_service< int > service( 4 , [count = 0]( std::string const& ) mutable { return ++count; } );
+    std::vector< std::future< int > > results;
+    for( size_t i=0 ; i<20 ; ++i ) results.push_back( service.submit( "" ) );
+    int sum = 0;
+    for( auto& r : results ) sum += ( r.get() > 0 ) ? 1 : 0;
+    EXPECT_EQ( sum , 20 );
+}
+
+TEST( TESTNAME , pending_tasks_are_finished_on_destruction )
+{
+    std::vector< std::future< double > > results;
+    {
+        gpcxx::evaluation_service< double > service( 1 , []( std::string const& s ) { return double( s.size() ); } );
+        for( size_t i=0 ; i<10 ; ++i ) results.push_back( service.submit( "ab" ) );
+    }
+    for( auto& r : results ) EXPECT_DOUBLE_EQ( r.get() , 2.0 );
+}
+
+TEST( TESTNAME , loopback_worker )
+{
+    using tree_type = get_tree_type< intrusive_tree_tag >::type;
+    test_tree< intrusive_tree_tag > trees;
+    auto worker = gpcxx::make_loopback_worker< tree_type >(
+        []( tree_type const& t ) { return t.root()->eval( context_type {{ 1.0 , 2.0 , 3.0 }} ); } ,
+        node_mapper< intrusive_tree_tag >() );
+    gpcxx::evaluation_service< double > service( 2 , worker );
+    auto result = service.submit( gpcxx::binary_string( trees.data ) );
+    EXPECT_DOUBLE_EQ( result.get() , std::sin( 1.0 ) + ( 2.0 - 2.0 ) );
+}
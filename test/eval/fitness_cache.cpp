@@ -0,0 +1,148 @@
+/*
+ * test/eval/fitness_cache.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "../canonic/canonic_test_trees.hpp"
+
+#include <gpcxx/eval/fitness_cache.hpp>
+#include <gpcxx/canonic/algebras.hpp>
+#include <gpcxx/canonic/sort_commutative.hpp>
+#include <gpcxx/tree/transform_tree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#define TESTNAME fitness_cache_tests
+
+using namespace std;
+
+TEST( TESTNAME , hits_and_misses )
+{
+    gpcxx::fitness_cache<> cache( 16 , 4 );
+    double value = 0.0;
+    EXPECT_FALSE( cache.find( 1 , value ) );
+    cache.insert( 1 , 0.5 );
+    EXPECT_TRUE( cache.find( 1 , value ) );
+    EXPECT_DOUBLE_EQ( value , 0.5 );
+
+    size_t calls = 0;
+    auto f = [&calls]() { ++calls; return 2.0; };
+    EXPECT_DOUBLE_EQ( cache.get_or_evaluate( 2 , f ) , 2.0 );
+    EXPECT_DOUBLE_EQ( cache.get_or_evaluate( 2 , f ) , 2.0 );
+    EXPECT_EQ( calls , size_t( 1 ) );
+    EXPECT_EQ( cache.hits() , size_t( 2 ) );
+    EXPECT_EQ( cache.misses() , size_t( 2 ) );
+    EXPECT_EQ( cache.size() , size_t( 2 ) );
+
+    cache.clear();
+    EXPECT_EQ( cache.size() , size_t( 0 ) );
+    EXPECT_EQ( cache.hits() , size_t( 0 ) );
+}
+
+TEST( TESTNAME , bounded_size )
+{
+    gpcxx::fitness_cache<> cache( 8 , 1 );
+    for( std::uint64_t k=0 ; k<100 ; ++k ) cache.insert( k , double( k ) );
+    EXPECT_EQ( cache.size() , size_t( 8 ) );
+
+    // the oldest entries are evicted
+    double value = 0.0;
+    EXPECT_FALSE( cache.find( 0 , value ) );
+    EXPECT_FALSE( cache.find( 91 , value ) );
+    EXPECT_TRUE( cache.find( 92 , value ) );
+    EXPECT_TRUE( cache.find( 99 , value ) );
+    EXPECT_DOUBLE_EQ( value , 99.0 );
+}
+
+TEST( TESTNAME , concurrent_lookup )
+{
+    gpcxx::fitness_cache<> cache( 1024 , 8 );
+    std::vector< std::thread > threads;
+    for( size_t t=0 ; t<4 ; ++t )
+    {
+        threads.emplace_back( [&cache]() {
+            for( size_t i=0 ; i<1000 ; ++i )
+            {
+                std::uint64_t key = gpcxx::detail::hash_mix( i % 100 );
+                double v = cache.get_or_evaluate( key , [i]() { return double( i % 100 ); } );
+                EXPECT_DOUBLE_EQ( v , double( i % 100 ) );
+            }
+        } );
+    }
+    for( auto& t : threads ) t.join();
+    EXPECT_EQ( cache.hits() + cache.misses() , size_t( 4000 ) );
+    EXPECT_GE( cache.misses() , size_t( 100 ) );
+    EXPECT_EQ( cache.size() , size_t( 100 ) );
+}
+
+TEST( TESTNAME , memoized_fitness_canonical_form )
+{
+    using node_type = canonic_test_trees::node_type;
+    using tree_type = canonic_test_trees::tree_type;
+    using algebras_type = gpcxx::algebras< node_type >;
+    using group_type = algebras_type::group_type;
+
+    algebras_type algebras;
+    algebras.add_abelian_group( group_type {
+        node_type::make_binary_operation( gpcxx::plus_func {} , "+" ) ,
+        node_type::make_constant_terminal( gpcxx::double_terminal<> { 0.0 } , "0" ) ,
+        node_type::make_binary_operation( gpcxx::minus_func {} , "-" ) ,
+        node_type::make_identity_operation( gpcxx::unary_minus_func {} , "um" ) } );
+    auto rules = std::vector< std::function< gpcxx::rule_result( tree_type& , tree_type::cursor ) > > {
+        gpcxx::make_sort_commutative( algebras ) };
+
+    size_t evaluations = 0;
+    gpcxx::fitness_cache<> cache( 128 );
+    auto fitness = gpcxx::make_memoized_fitness(
+        [&evaluations]( tree_type const& t ) { ++evaluations; return double( t.size() ); } ,
+        [&rules]( tree_type& t ) { gpcxx::transform_tree( rules , t ); } ,
+        cache );
+
+    // y + x and x + y
+    tree_type t1 = canonic_test_trees::test_tree1();
+    tree_type t2;
+    auto root = t2.insert_below( t2.root() , node_type::make_binary_operation( gpcxx::plus_func {} , "+" ) );
+    t2.insert_below( root , node_type::make_variable_terminal( gpcxx::array_terminal<0> {} , "x" ) );
+    t2.insert_below( root , node_type::make_variable_terminal( gpcxx::array_terminal<1> {} , "y" ) );
+
+    EXPECT_DOUBLE_EQ( fitness( t1 ) , 3.0 );
+    EXPECT_DOUBLE_EQ( fitness( t2 ) , 3.0 );
+    EXPECT_EQ( evaluations , size_t( 1 ) );
+    EXPECT_EQ( cache.hits() , size_t( 1 ) );
+    EXPECT_EQ( cache.misses() , size_t( 1 ) );
+
+    // the individual itself is not transformed
+    EXPECT_EQ( t1.root()->name() , "+" );
+    EXPECT_EQ( t1.root().children( 0 )->name() , "y" );
+}
+
+TEST( TESTNAME , memoized_fitness_distinguishes_constants_with_equal_names )
+{
+    using node_type = canonic_test_trees::node_type;
+    using tree_type = canonic_test_trees::tree_type;
+
+    gpcxx::fitness_cache<> cache( 128 );
+    auto fitness = gpcxx::make_memoized_fitness(
+        []( tree_type const& t ) { std::array< double , 2 > c {{ 0.0 , 0.0 }}; return t.root()->eval( c ); } ,
+        []( tree_type& t ) { } ,
+        cache );
+
+    // constants named by std::to_string round to six decimals
+    tree_type t1 , t2;
+    t1.insert_below( t1.root() , node_type::make_constant_terminal( gpcxx::double_terminal<> { 0.1 } , std::to_string( 0.1 ) ) );
+    t2.insert_below( t2.root() , node_type::make_constant_terminal( gpcxx::double_terminal<> { 0.1000001 } , std::to_string( 0.1000001 ) ) );
+    ASSERT_EQ( t1.root()->name() , t2.root()->name() );
+
+    EXPECT_DOUBLE_EQ( fitness( t1 ) , 0.1 );
+    EXPECT_DOUBLE_EQ( fitness( t2 ) , 0.1000001 );
+    EXPECT_EQ( cache.hits() , size_t( 0 ) );
+}
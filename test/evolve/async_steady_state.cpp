@@ -0,0 +1,83 @@
+/*
+ * test/evolve/async_steady_state.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/async_steady_state.hpp>
+#include <gpcxx/evolve/steady_state_pipeline.hpp>
+#include <gpcxx/eval/evaluation_service.hpp>
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+#include "../common/node_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+template <class T>
+struct async_steady_state_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using pipeline_type = gpcxx::steady_state_pipeline< population_type , fitness_type , typename test_template< T >::generator_type::rng_type >;
+
+    async_steady_state_tests( void )
+    : pop() , fitness()
+    {
+        for( size_t i=0 ; i<20 ; ++i )
+        {
+            pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+            fitness.push_back( eval( pop.back() ) );
+        }
+    }
+
+    static double eval( tree_type const& t ) { return double( t.size() ); }
+
+    population_type pop;
+    fitness_type fitness;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( async_steady_state_tests , Implementations );
+
+TYPED_TEST( async_steady_state_tests , evaluations_are_inserted )
+{
+    using tree_type = typename TestFixture::tree_type;
+
+    size_t observed = 0;
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 2 , []( auto& ) {} ,
+        [&observed]( int , std::vector< size_t > const& , std::vector< size_t > const& out ) { observed += out.size(); } );
+    pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+    pipeline.add_operator( gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+        gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+
+    gpcxx::evaluation_service< double > service( 3 , gpcxx::make_loopback_worker< tree_type >( TestFixture::eval , node_mapper< TypeParam >() ) );
+    size_t n = gpcxx::evolve_async( pipeline , this->pop , this->fitness , service ,
+        []( tree_type const& t ) { return gpcxx::binary_string( t ); } , 200 , 6 );
+
+    EXPECT_EQ( n , size_t( 200 ) );
+    EXPECT_EQ( observed , size_t( 200 ) );
+    EXPECT_EQ( this->pop.size() , size_t( 20 ) );
+    for( size_t i=0 ; i<this->pop.size() ; ++i )
+        EXPECT_DOUBLE_EQ( this->fitness[i] , TestFixture::eval( this->pop[i] ) );
+
+    // an empty observer is skipped
+    pipeline.operator_observer() = nullptr;
+    n = gpcxx::evolve_async( pipeline , this->pop , this->fitness , service ,
+        []( tree_type const& t ) { return gpcxx::binary_string( t ); } , 20 , 6 );
+    EXPECT_EQ( n , size_t( 20 ) );
+}
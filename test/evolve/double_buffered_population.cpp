@@ -0,0 +1,121 @@
+/*
+ * test/evolve/double_buffered_population.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/double_buffered_population.hpp>
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/evolve/static_pipeline.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+template <class T>
+struct double_buffered_population_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using rng_type = typename test_template< T >::generator_type::rng_type;
+
+    double_buffered_population_tests( void )
+    : pop() , fitness()
+    {
+        for( size_t i=0 ; i<20 ; ++i )
+        {
+            pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+            fitness.push_back( eval( pop.back() ) );
+        }
+    }
+
+    static double eval( tree_type const& t ) { return double( t.size() ); }
+
+    population_type pop;
+    fitness_type fitness;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( double_buffered_population_tests , Implementations );
+
+TYPED_TEST( double_buffered_population_tests , construct_and_swap )
+{
+    gpcxx::double_buffered_population< typename TestFixture::population_type > pop( this->pop );
+    EXPECT_EQ( pop.size() , size_t( 20 ) );
+    EXPECT_EQ( pop.next().size() , size_t( 20 ) );
+    EXPECT_EQ( pop[0] , this->m_test_trees.data );
+    EXPECT_TRUE( pop.next()[0].empty() );
+
+    auto* current = &pop.current();
+    pop.swap_buffers();
+    EXPECT_EQ( &pop.next() , current );
+    EXPECT_TRUE( pop[0].empty() );
+}
+
+TYPED_TEST( double_buffered_population_tests , dynamic_pipeline )
+{
+    gpcxx::dynamic_pipeline< typename TestFixture::population_type , typename TestFixture::fitness_type , typename TestFixture::rng_type >
+        pipeline( this->m_gen.rng , 2 );
+    pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+    pipeline.add_operator( gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+        gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+
+    gpcxx::double_buffered_population< typename TestFixture::population_type > pop( this->pop );
+    for( size_t g=0 ; g<5 ; ++g )
+    {
+        auto const* storage = pop.next().data();
+        pipeline.next_generation( pop , this->fitness );
+        EXPECT_EQ( pop.current().data() , storage );
+        EXPECT_EQ( pop.size() , size_t( 20 ) );
+        for( size_t i=0 ; i<pop.size() ; ++i )
+        {
+            EXPECT_FALSE( pop[i].empty() );
+            this->fitness[i] = TestFixture::eval( pop[i] );
+        }
+    }
+}
+
+TYPED_TEST( double_buffered_population_tests , static_pipeline )
+{
+    gpcxx::static_pipeline< typename TestFixture::population_type , typename TestFixture::fitness_type , typename TestFixture::rng_type >
+        pipeline( 1 , 0.3 , 0.4 , 0.3 , this->m_gen.rng );
+    pipeline.mutation_function() = gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+        gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) );
+    pipeline.crossover_function() = gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( this->m_gen.rng , 10 ) ,
+        gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) );
+    pipeline.reproduction_function() = gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) );
+
+    gpcxx::double_buffered_population< typename TestFixture::population_type > pop( this->pop );
+    for( size_t g=0 ; g<5 ; ++g )
+    {
+        pipeline.next_generation( pop , this->fitness );
+        EXPECT_EQ( pop.size() , size_t( 20 ) );
+        for( size_t i=0 ; i<pop.size() ; ++i )
+        {
+            EXPECT_FALSE( pop[i].empty() );
+            this->fitness[i] = TestFixture::eval( pop[i] );
+        }
+    }
+
+    // the plain overload still works
+    pipeline.next_generation( this->pop , this->fitness );
+    EXPECT_EQ( this->pop.size() , size_t( 20 ) );
+}
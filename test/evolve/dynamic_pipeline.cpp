@@ -0,0 +1,122 @@
+/*
+ * test/evolve/dynamic_pipeline.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/util/sort_indices.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+template <class T>
+struct dynamic_pipeline_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using rng_type = typename test_template< T >::generator_type::rng_type;
+    using pipeline_type = gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type >;
+
+    dynamic_pipeline_tests( void )
+    : pop() , fitness() , pipeline( this->m_gen.rng , 2 )
+    {
+        for( size_t i=0 ; i<21 ; ++i )
+        {
+            pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+            fitness.push_back( double( pop.back().size() ) + 0.01 * double( i ) );
+        }
+        pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.2 );
+        pipeline.add_operator( gpcxx::make_mutation(
+            gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+            gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.3 );
+        pipeline.add_operator( gpcxx::make_crossover(
+            gpcxx::make_one_point_crossover_strategy( this->m_gen.rng , 10 ) ,
+            gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+    }
+
+    population_type pop;
+    fitness_type fitness;
+    pipeline_type pipeline;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( dynamic_pipeline_tests , Implementations );
+
+TYPED_TEST( dynamic_pipeline_tests , without_observer )
+{
+    EXPECT_FALSE( this->pipeline.operator_observer() );
+    EXPECT_FALSE( this->pipeline.lineage_observer() );
+    this->pipeline.next_generation( this->pop , this->fitness );
+    EXPECT_EQ( this->pop.size() , size_t( 21 ) );
+}
+
+TYPED_TEST( dynamic_pipeline_tests , lineage_table_covers_generation )
+{
+    std::vector< size_t > elite;
+    gpcxx::sort_indices( this->fitness , elite );
+    size_t calls = 0;
+    std::vector< int > slots( this->pop.size() , 0 );
+    this->pipeline.lineage_observer() = [&]( gpcxx::lineage_table const& lineage ) {
+        ++calls;
+        ASSERT_GE( lineage.size() , size_t( 2 ) );
+        EXPECT_EQ( lineage[0].choice , -1 );
+        EXPECT_EQ( lineage[1].choice , -1 );
+        EXPECT_EQ( lineage.parents( lineage[0] ).front() , elite[0] );
+        EXPECT_EQ( lineage.parents( lineage[1] ).front() , elite[1] );
+        for( auto const& r : lineage )
+        {
+            size_t arity = ( r.choice == 2 ) ? 2 : 1;
+            EXPECT_EQ( r.number_of_parents , arity );
+            for( auto p : lineage.parents( r ) ) EXPECT_LT( p , this->pop.size() );
+            for( size_t i=r.first_child ; i<r.first_child + r.number_of_children ; ++i ) ++slots[i];
+        }
+    };
+    this->pipeline.next_generation( this->pop , this->fitness );
+    EXPECT_EQ( calls , size_t( 1 ) );
+    for( auto s : slots ) EXPECT_EQ( s , 1 );
+}
+
+TYPED_TEST( dynamic_pipeline_tests , operator_observer_matches_lineage_table )
+{
+    using index_vector = typename TestFixture::pipeline_type::index_vector;
+    std::vector< std::tuple< int , index_vector , index_vector > > calls;
+    this->pipeline.operator_observer() = [&]( int choice , index_vector const& in , index_vector const& out ) {
+        calls.emplace_back( choice , in , out );
+    };
+    gpcxx::lineage_table table;
+    this->pipeline.lineage_observer() = [&]( gpcxx::lineage_table const& lineage ) { table = lineage; };
+
+    this->pipeline.next_generation( this->pop , this->fitness );
+
+    ASSERT_EQ( calls.size() , table.size() );
+    for( size_t i=0 ; i<table.size() ; ++i )
+    {
+        auto const& r = table[i];
+        EXPECT_EQ( std::get< 0 >( calls[i] ) , r.choice );
+        auto parents = table.parents( r );
+        EXPECT_EQ( std::get< 1 >( calls[i] ) , index_vector( parents.begin() , parents.end() ) );
+        index_vector children;
+        for( size_t j=0 ; j<r.number_of_children ; ++j ) children.push_back( r.first_child + j );
+        EXPECT_EQ( std::get< 2 >( calls[i] ) , children );
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * test/evolve/island_model.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/island_model.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+template <class T>
+struct island_model_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using generator_type = typename test_template< T >::generator_type;
+    using model_type = gpcxx::island_model< population_type , fitness_type , typename generator_type::rng_type >;
+
+    static double eval( tree_type const& t ) { return double( t.size() ); }
+
+    // every island needs its own operators, they hold references to the island rng
+    void setup( model_type& model )
+    {
+        generators.clear();
+        for( size_t i=0 ; i<model.size() ; ++i ) generators.emplace_back( new generator_type );
+        model.setup( [this]( size_t i , auto& rng , auto& pipeline ) {
+            pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 3 ) ) , 0.5 );
+            pipeline.add_operator( gpcxx::make_mutation(
+                gpcxx::make_simple_mutation_strategy( rng , generators[i]->node_generator ) ,
+                gpcxx::make_tournament_selector( rng , 3 ) ) , 0.5 ); } );
+        model.initialize( [this]( size_t i , auto& rng , auto& pop ) {
+            for( size_t j=0 ; j<20 ; ++j )
+                pop.push_back( ( j % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 ); } ,
+            eval );
+    }
+
+    std::vector< std::unique_ptr< generator_type > > generators;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( island_model_tests , Implementations );
+
+TYPED_TEST( island_model_tests , ring_topology )
+{
+    auto t = gpcxx::make_ring_topology( 4 );
+    ASSERT_EQ( t.size() , size_t( 4 ) );
+    for( size_t i=0 ; i<4 ; ++i )
+    {
+        ASSERT_EQ( t[i].size() , size_t( 1 ) );
+        EXPECT_EQ( t[i][0] , ( i + 1 ) % 4 );
+    }
+    EXPECT_TRUE( gpcxx::make_ring_topology( 1 )[0].empty() );
+}
+
+TYPED_TEST( island_model_tests , torus_topology )
+{
+    auto t = gpcxx::make_torus_topology( 3 , 4 );
+    ASSERT_EQ( t.size() , size_t( 12 ) );
+    for( auto const& dest : t ) EXPECT_EQ( dest.size() , size_t( 4 ) );
+    EXPECT_EQ( t[0] , ( std::vector< size_t > { 1 , 3 , 4 , 8 } ) );
+
+    // neighbours coincide on small tori
+    auto t2 = gpcxx::make_torus_topology( 2 , 1 );
+    EXPECT_EQ( t2[0] , ( std::vector< size_t > { 1 } ) );
+    EXPECT_EQ( t2[1] , ( std::vector< size_t > { 0 } ) );
+}
+
+TYPED_TEST( island_model_tests , run_and_statistics )
+{
+    typename TestFixture::model_type model( 4 , 1 , gpcxx::make_ring_topology( 4 ) , 2 , 3 , 42 );
+    this->setup( model );
+    model.run( 5 , TestFixture::eval );
+    EXPECT_EQ( model.generation() , size_t( 5 ) );
+    for( size_t i=0 ; i<model.size() ; ++i )
+    {
+        auto const& stat = model.statistics( i );
+        EXPECT_EQ( model.population( i ).size() , size_t( 20 ) );
+        EXPECT_EQ( stat.generations , size_t( 5 ) );
+        EXPECT_EQ( stat.evaluations , size_t( 6 * 20 ) );
+        EXPECT_EQ( stat.emigrants , size_t( 2 * 3 ) );
+        EXPECT_EQ( stat.immigrants , size_t( 2 * 3 ) );
+        for( size_t j=0 ; j<20 ; ++j )
+            EXPECT_DOUBLE_EQ( model.fitness( i )[j] , TestFixture::eval( model.population( i )[j] ) );
+    }
+    auto best = model.best();
+    EXPECT_DOUBLE_EQ( model.fitness( best.first )[ best.second ] , model.statistics( best.first ).best_fitness );
+}
+
+TYPED_TEST( island_model_tests , reproducible_per_seed )
+{
+    typename TestFixture::model_type model1( 6 , 1 , gpcxx::make_torus_topology( 2 , 3 ) , 1 , 2 , 17 );
+    typename TestFixture::model_type model2( 6 , 1 , gpcxx::make_torus_topology( 2 , 3 ) , 1 , 2 , 17 );
+    this->setup( model1 );
+    model1.run( 8 , TestFixture::eval );
+    this->setup( model2 );
+    model2.run( 8 , TestFixture::eval );
+    for( size_t i=0 ; i<model1.size() ; ++i )
+        EXPECT_EQ( model1.fitness( i ) , model2.fitness( i ) );
+}
+
+TYPED_TEST( island_model_tests , evaluator_exceptions_are_propagated )
+{
+    typename TestFixture::model_type model( 3 , 1 , gpcxx::make_ring_topology( 3 ) , 1 , 1 , 1 );
+    this->setup( model );
+    std::atomic< size_t > calls( 0 );
+    auto eval = [&calls]( auto const& t ) -> double {
+        if( ++calls > 50 ) throw std::runtime_error( "eval failed" );
+        return double( t.size() ); };
+    EXPECT_THROW( model.run( 10 , eval ) , std::runtime_error );
+}
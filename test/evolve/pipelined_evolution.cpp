@@ -0,0 +1,147 @@
+/*
+ * test/evolve/pipelined_evolution.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/pipelined_evolution.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/tree/hash_tree.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+template <class T>
+struct pipelined_evolution_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using rng_type = typename test_template< T >::generator_type::rng_type;
+    using evolution_type = gpcxx::pipelined_evolution< population_type , fitness_type , rng_type >;
+
+    pipelined_evolution_tests( void ) : pop() , fitness()
+    {
+        for( size_t i=0 ; i<50 ; ++i )
+        {
+            pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+            fitness.push_back( evaluate( pop.back() ) );
+        }
+    }
+
+    static double evaluate( tree_type const& t )
+    {
+        return double( t.size() ) + 0.1 * double( t.root().height() );
+    }
+
+    void add_operators( evolution_type& evolution , rng_type& rng )
+    {
+        evolution.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 3 ) ) , 0.2 );
+        evolution.add_operator( gpcxx::make_mutation(
+            gpcxx::make_simple_mutation_strategy( rng , this->m_gen.node_generator ) ,
+            gpcxx::make_tournament_selector( rng , 3 ) ) , 0.3 );
+        evolution.add_operator( gpcxx::make_crossover(
+            gpcxx::make_one_point_crossover_strategy( rng , 10 ) ,
+            gpcxx::make_tournament_selector( rng , 3 ) ) , 0.5 );
+    }
+
+    population_type pop;
+    fitness_type fitness;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( pipelined_evolution_tests , Implementations );
+
+TYPED_TEST( pipelined_evolution_tests , evaluates_every_generation )
+{
+    using tree_type = typename TestFixture::tree_type;
+    typename TestFixture::rng_type rng( 3 );
+    typename TestFixture::evolution_type evolution( rng , 1 , 3 , 0.5 , 4 , 2 );
+    this->add_operators( evolution , rng );
+
+    std::atomic< size_t > evaluations( 0 );
+    auto evaluator = [&evaluations]( tree_type const& t ) {
+        ++evaluations;
+        return TestFixture::evaluate( t ); };
+
+    std::vector< size_t > generations;
+    evolution.generation_observer() = [&]( size_t g , auto const& pop , auto const& fitness ) {
+        generations.push_back( g );
+        ASSERT_EQ( pop.size() , size_t( 50 ) );
+        ASSERT_EQ( fitness.size() , size_t( 50 ) );
+        for( size_t i=0 ; i<pop.size() ; ++i ) EXPECT_DOUBLE_EQ( fitness[i] , TestFixture::evaluate( pop[i] ) );
+    };
+
+    evolution.evolve( this->pop , this->fitness , 5 , evaluator );
+
+    EXPECT_EQ( generations , std::vector< size_t >( { 1 , 2 , 3 , 4 , 5 } ) );
+    EXPECT_EQ( evaluations.load() , size_t( 5 * 50 ) );
+    ASSERT_EQ( this->pop.size() , size_t( 50 ) );
+    for( size_t i=0 ; i<this->pop.size() ; ++i )
+    {
+        EXPECT_FALSE( this->pop[i].empty() );
+        EXPECT_DOUBLE_EQ( this->fitness[i] , TestFixture::evaluate( this->pop[i] ) );
+    }
+}
+
+TYPED_TEST( pipelined_evolution_tests , independent_of_number_of_threads )
+{
+    auto run = [this]( size_t threads ) {
+        auto pop = this->pop;
+        auto fitness = this->fitness;
+        typename TestFixture::rng_type rng( 7 );
+        typename TestFixture::evolution_type evolution( rng , 2 , threads , 1.0 , 3 , 2 );
+        this->add_operators( evolution , rng );
+        evolution.evolve( pop , fitness , 4 , &TestFixture::evaluate );
+        std::vector< size_t > hashes;
+        for( auto const& t : pop ) hashes.push_back( gpcxx::hash_tree( t ) );
+        return std::make_pair( hashes , fitness );
+    };
+    auto r1 = run( 1 );
+    auto r4 = run( 4 );
+    EXPECT_EQ( r1.first , r4.first );
+    EXPECT_EQ( r1.second , r4.second );
+}
+
+TYPED_TEST( pipelined_evolution_tests , keeps_the_elite )
+{
+    typename TestFixture::rng_type rng( 11 );
+    typename TestFixture::evolution_type evolution( rng , 1 , 2 );
+    this->add_operators( evolution , rng );
+
+    double best = *std::min_element( this->fitness.begin() , this->fitness.end() );
+    evolution.evolve( this->pop , this->fitness , 3 , &TestFixture::evaluate );
+    EXPECT_LE( *std::min_element( this->fitness.begin() , this->fitness.end() ) , best );
+}
+
+TYPED_TEST( pipelined_evolution_tests , propagates_exceptions )
+{
+    using tree_type = typename TestFixture::tree_type;
+    typename TestFixture::rng_type rng( 5 );
+    typename TestFixture::evolution_type evolution( rng , 1 , 3 , 1.0 , 5 , 1 );
+    this->add_operators( evolution , rng );
+
+    std::atomic< size_t > evaluations( 0 );
+    auto evaluator = [&evaluations]( tree_type const& t ) -> double {
+        if( ++evaluations == 70 ) throw std::runtime_error( "evaluation failed" );
+        return TestFixture::evaluate( t ); };
+    EXPECT_THROW( evolution.evolve( this->pop , this->fitness , 3 , evaluator ) , std::runtime_error );
+}
@@ -0,0 +1,126 @@
+/*
+ * test/evolve/process_island.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/process_island.hpp>
+#include <gpcxx/evolve/island_model.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+#include "../common/node_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+template <class T>
+struct process_island_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using generator_type = typename test_template< T >::generator_type;
+    using rng_type = typename generator_type::rng_type;
+
+    static double eval( tree_type const& t ) { return double( t.size() ); }
+
+    template< typename Pipeline >
+    void add_operators( Pipeline& pipeline , rng_type& rng , generator_type& gen )
+    {
+        pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 3 ) ) , 0.5 );
+        pipeline.add_operator( gpcxx::make_mutation(
+            gpcxx::make_simple_mutation_strategy( rng , gen.node_generator ) ,
+            gpcxx::make_tournament_selector( rng , 3 ) ) , 0.5 );
+    }
+
+    void init( population_type& pop )
+    {
+        for( size_t j=0 ; j<20 ; ++j )
+            pop.push_back( ( j % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+    }
+
+    // runs the islands in processes and compares them with an island_model in threads
+    void processes_evolve_like_threads( size_t migrants , size_t capacity )
+    {
+        size_t const islands = 3 , elite = 1 , interval = 2 , generations = 6 , seed = 23;
+        auto topology = gpcxx::make_ring_topology( islands );
+
+        // reference run with threads
+        gpcxx::island_model< population_type , fitness_type , rng_type > model( islands , elite , topology , interval , migrants , seed );
+        std::vector< generator_type > generators( islands );
+        model.setup( [&]( size_t i , rng_type& rng , auto& pipeline ) { this->add_operators( pipeline , rng , generators[i] ); } );
+        model.initialize( [&]( size_t , rng_type& , population_type& pop ) { this->init( pop ); } , eval );
+        model.run( generations , eval );
+
+        std::string prefix = "/gpcxx_test_process_island_" + std::to_string( ::getpid() );
+        gpcxx::create_migration_channels( prefix , topology , capacity );
+
+        std::vector< pid_t > children;
+        for( size_t i=0 ; i<islands ; ++i )
+        {
+            pid_t pid = ::fork();
+            ASSERT_GE( pid , 0 );
+            if( pid == 0 )
+            {
+                int result = 1;
+                try
+                {
+                    gpcxx::process_island< population_type , fitness_type , rng_type > island( i , elite , topology , interval , migrants , seed , prefix , std::chrono::seconds( 10 ) );
+                    generator_type gen;
+                    this->add_operators( island.pipeline() , island.rng() , gen );
+                    island.initialize( [&]( size_t , rng_type& , population_type& pop ) { this->init( pop ); } , eval );
+                    island.run( generations , eval , node_mapper< T >() );
+                    bool equal = ( island.fitness() == model.fitness( i ) );
+                    equal = equal && ( island.statistics().immigrants == model.statistics( i ).immigrants );
+                    result = equal ? 0 : 2;
+                }
+                catch( ... ) { }
+                ::_exit( result );
+            }
+            children.push_back( pid );
+        }
+
+        for( auto pid : children )
+        {
+            int status = 0;
+            ::waitpid( pid , &status , 0 );
+            EXPECT_TRUE( WIFEXITED( status ) );
+            EXPECT_EQ( WEXITSTATUS( status ) , 0 );
+        }
+        gpcxx::remove_migration_channels( prefix , topology );
+    }
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( process_island_tests , Implementations );
+
+TYPED_TEST( process_island_tests , processes_evolve_like_threads )
+{
+    this->processes_evolve_like_threads( 2 , 4096 );
+}
+
+TYPED_TEST( process_island_tests , channels_holding_one_migrant )
+{
+    // the migrants have between 38 and 50 bytes including the length, hence a channel holds only one of them and the
+    // islands of the ring have to interleave sending and receiving
+    this->processes_evolve_like_threads( 2 , 64 );
+}
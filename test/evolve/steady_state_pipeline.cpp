@@ -0,0 +1,127 @@
+/*
+ * test/evolve/steady_state_pipeline.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/evolve/steady_state_pipeline.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <numeric>
+
+template <class T>
+struct steady_state_pipeline_tests : public test_template< T >
+{
+    using tree_type = typename test_template< T >::tree_type;
+    using population_type = std::vector< tree_type >;
+    using fitness_type = std::vector< double >;
+    using pipeline_type = gpcxx::steady_state_pipeline< population_type , fitness_type , typename test_template< T >::generator_type::rng_type >;
+
+    steady_state_pipeline_tests( void )
+    : pop() , fitness()
+    {
+        for( size_t i=0 ; i<20 ; ++i )
+        {
+            pop.push_back( ( i % 3 == 0 ) ? this->m_test_trees.data : ( ( i % 3 == 1 ) ? this->m_test_trees.data2 : this->m_test_trees.data3 ) );
+            fitness.push_back( eval( pop.back() ) );
+        }
+    }
+
+    static double eval( tree_type const& t ) { return double( t.size() ); }
+
+    void add_operators( pipeline_type& pipeline )
+    {
+        pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+        pipeline.add_operator( gpcxx::make_mutation(
+            gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+            gpcxx::make_tournament_selector( this->m_gen.rng , 3 ) ) , 0.5 );
+    }
+
+    population_type pop;
+    fitness_type fitness;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( steady_state_pipeline_tests , Implementations );
+
+TYPED_TEST( steady_state_pipeline_tests , step_keeps_population_consistent )
+{
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 2 );
+    this->add_operators( pipeline );
+    for( size_t i=0 ; i<100 ; ++i )
+    {
+        size_t n = pipeline.step( this->pop , this->fitness , TestFixture::eval );
+        EXPECT_EQ( n , size_t( 1 ) );
+    }
+    EXPECT_EQ( this->pop.size() , size_t( 20 ) );
+    EXPECT_EQ( this->fitness.size() , size_t( 20 ) );
+    for( size_t i=0 ; i<this->pop.size() ; ++i )
+        EXPECT_DOUBLE_EQ( this->fitness[i] , TestFixture::eval( this->pop[i] ) );
+}
+
+TYPED_TEST( steady_state_pipeline_tests , observer_receives_replaced_indices )
+{
+    size_t calls = 0;
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 2 , []( auto& ) {} ,
+        [&calls]( int choice , std::vector< size_t > const& in , std::vector< size_t > const& out ) {
+            ++calls;
+            EXPECT_TRUE( ( choice == 0 ) || ( choice == 1 ) );
+            EXPECT_EQ( in.size() , size_t( 1 ) );
+            EXPECT_EQ( out.size() , size_t( 1 ) );
+            for( auto i : in ) EXPECT_LT( i , size_t( 20 ) );
+            for( auto i : out ) EXPECT_LT( i , size_t( 20 ) );
+        } );
+    this->add_operators( pipeline );
+    pipeline.next_generation( this->pop , this->fitness , TestFixture::eval );
+    EXPECT_EQ( calls , size_t( 20 ) );
+}
+
+TYPED_TEST( steady_state_pipeline_tests , replaces_non_finite_first )
+{
+    // the inverse tournament is large enough to hit index 7 almost surely
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 1000 );
+    this->fitness[7] = std::numeric_limits< double >::quiet_NaN();
+    EXPECT_EQ( pipeline.select_loser( this->fitness ) , size_t( 7 ) );
+    this->fitness[7] = std::numeric_limits< double >::infinity();
+    EXPECT_EQ( pipeline.select_loser( this->fitness ) , size_t( 7 ) );
+
+    size_t index = pipeline.insert( this->pop , this->fitness , this->m_test_trees.data , 1.0 );
+    EXPECT_EQ( index , size_t( 7 ) );
+    EXPECT_DOUBLE_EQ( this->fitness[7] , 1.0 );
+}
+
+TYPED_TEST( steady_state_pipeline_tests , reproduction_does_not_increase_mean_fitness )
+{
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 4 );
+    pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( this->m_gen.rng , 4 ) ) , 1.0 );
+    double before = std::accumulate( this->fitness.begin() , this->fitness.end() , 0.0 );
+    for( size_t g=0 ; g<5 ; ++g )
+        pipeline.next_generation( this->pop , this->fitness , TestFixture::eval );
+    double after = std::accumulate( this->fitness.begin() , this->fitness.end() , 0.0 );
+    EXPECT_LE( after , before );
+}
+
+TYPED_TEST( steady_state_pipeline_tests , empty_observer_is_skipped )
+{
+    typename TestFixture::pipeline_type pipeline( this->m_gen.rng , 2 , []( auto& ) {} ,
+        []( int choice , std::vector< size_t > const& in , std::vector< size_t > const& out ) {} );
+    this->add_operators( pipeline );
+    pipeline.operator_observer() = nullptr;
+    EXPECT_NO_THROW( pipeline.next_generation( this->pop , this->fitness , TestFixture::eval ) );
+}
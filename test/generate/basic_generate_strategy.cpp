@@ -10,6 +10,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 template <class T>
 struct basic_generate_strategy_tests : public test_template< T > { };
 
@@ -31,3 +33,18 @@ TYPED_TEST( basic_generate_strategy_tests , instanciation )
         EXPECT_TRUE( tree.root().height() <= 4 );
     }
 }
+
+TYPED_TEST( basic_generate_strategy_tests , height_budget )
+{
+    auto generator = gpcxx::make_basic_generate_strategy( this->m_gen.rng , this->m_gen.node_generator , 2 , 4 );
+    for( size_t budget=1 ; budget<=5 ; ++budget )
+    {
+        for( size_t i=0 ; i<200 ; ++i )
+        {
+            typename TestFixture::tree_type tree;
+            generator( tree , budget );
+            EXPECT_GE( tree.root().height() , std::min( budget , size_t( 2 ) ) );
+            EXPECT_LE( tree.root().height() , std::min( budget , size_t( 4 ) ) );
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * test/generate/generate_population.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/generate/generate_population.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/generate/basic_generate_strategy.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+template <class T>
+struct generate_population_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( generate_population_tests , Implementations );
+
+TYPED_TEST( generate_population_tests , unique_trees )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    auto& node_generator = this->m_gen.node_generator;
+    auto factory = [&node_generator]( std::mt19937& rng ) { return gpcxx::make_ramp( rng , node_generator , 2 , 6 , 0.5 ); };
+
+    for( size_t threads : { size_t( 1 ) , size_t( 4 ) } )
+    {
+        gpcxx::generate_population_options options;
+        options.number_of_threads = threads;
+        auto pop = gpcxx::generate_population< population_type , std::mt19937 >( 300 , factory , options );
+        ASSERT_EQ( pop.size() , size_t( 300 ) );
+        for( size_t i=0 ; i<pop.size() ; ++i )
+        {
+            EXPECT_GE( pop[i].root().height() , size_t( 2 ) );
+            EXPECT_LE( pop[i].root().height() , size_t( 6 ) );
+            for( size_t j=0 ; j<i ; ++j )
+                EXPECT_FALSE( pop[i] == pop[j] );
+        }
+    }
+}
+
+TYPED_TEST( generate_population_tests , reproducible_streams )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    auto& node_generator = this->m_gen.node_generator;
+    auto factory = [&node_generator]( std::mt19937& rng ) { return gpcxx::make_ramp( rng , node_generator , 1 , 4 , 0.5 ); };
+
+    gpcxx::generate_population_options options;
+    options.number_of_threads = 3;
+    options.unique = false;
+    population_type pop1( 100 ) , pop2( 100 );
+    gpcxx::generate_population< std::mt19937 >( pop1 , factory , options );
+    gpcxx::generate_population< std::mt19937 >( pop2 , factory , options );
+    EXPECT_EQ( pop1 , pop2 );
+
+    options.seed = 17;
+    gpcxx::generate_population< std::mt19937 >( pop2 , factory , options );
+    EXPECT_NE( pop1 , pop2 );
+}
+
+TYPED_TEST( generate_population_tests , too_few_distinct_trees )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    auto& node_generator = this->m_gen.node_generator;
+    // only the three terminals
+    auto factory = [&node_generator]( std::mt19937& rng ) {
+        return gpcxx::make_basic_generate_strategy( rng , node_generator , 1 , 1 ); };
+
+    gpcxx::generate_population_options options;
+    options.number_of_threads = 2;
+    EXPECT_THROW( ( gpcxx::generate_population< population_type , std::mt19937 >( 10 , factory , options ) ) , gpcxx::gpcxx_exception );
+
+    options.max_trials = 100;
+    auto pop = gpcxx::generate_population< population_type , std::mt19937 >( 3 , factory , options );
+    EXPECT_EQ( pop.size() , size_t( 3 ) );
+}
@@ -0,0 +1,115 @@
+/*
+ * test/generate/ptc2.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/generate/ptc2.hpp>
+#include <gpcxx/operator/point_mutation.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+template <class T>
+struct ptc2_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( ptc2_tests , Implementations );
+
+TYPED_TEST( ptc2_tests , exact_size )
+{
+    // the maximal arity of the test generator is two, the size is exceeded by at most one
+    for( size_t size=1 ; size<=30 ; ++size )
+    {
+        auto generator = gpcxx::make_ptc2( this->m_gen.rng , this->m_gen.node_generator , size , size , 100 );
+        for( size_t i=0 ; i<100 ; ++i )
+        {
+            typename TestFixture::tree_type tree;
+            generator( tree );
+            EXPECT_GE( tree.size() , size );
+            EXPECT_LE( tree.size() , size + 1 );
+        }
+    }
+}
+
+TYPED_TEST( ptc2_tests , preorder_structure )
+{
+    auto const& g = this->m_gen;
+    auto arity = [&g]( auto const& v ) -> size_t {
+        if( std::find( g.term_symbols.begin() , g.term_symbols.end() , v ) != g.term_symbols.end() ) return 0;
+        if( std::find( g.unary_symbols.begin() , g.unary_symbols.end() , v ) != g.unary_symbols.end() ) return 1;
+        return 2; };
+    auto generator = gpcxx::make_ptc2( this->m_gen.rng , this->m_gen.node_generator , 1 , 50 , 100 );
+    for( size_t i=0 ; i<100 ; ++i )
+    {
+        typename TestFixture::tree_type tree;
+        generator( tree );
+        for( size_t j=0 ; j<tree.size() ; ++j )
+        {
+            auto c = tree.rank_is( j );
+            EXPECT_EQ( c.size() , arity( *c ) );
+        }
+    }
+}
+
+TYPED_TEST( ptc2_tests , size_distribution )
+{
+    // weights for the sizes 0 ... 4
+    std::vector< double > weights = { 0.0 , 1.0 , 0.0 , 3.0 , 0.0 };
+    auto generator = gpcxx::ptc2< typename TestFixture::generator_type::rng_type ,
+        typename TestFixture::generator_type::node_generator_type >(
+            this->m_gen.rng , this->m_gen.node_generator , weights , 100 );
+    size_t n = 10000 , ones = 0;
+    for( size_t i=0 ; i<n ; ++i )
+    {
+        typename TestFixture::tree_type tree;
+        generator( tree );
+        if( tree.size() == 1 ) { ++ones; }
+        else { EXPECT_TRUE( ( tree.size() == 3 ) || ( tree.size() == 4 ) ); }
+    }
+    EXPECT_NEAR( double( ones ) / double( n ) , 0.25 , 0.02 );
+}
+
+TYPED_TEST( ptc2_tests , height_limit )
+{
+    auto generator = gpcxx::make_ptc2( this->m_gen.rng , this->m_gen.node_generator , 1 , 100 , 5 );
+    for( size_t i=0 ; i<200 ; ++i )
+    {
+        typename TestFixture::tree_type tree;
+        generator( tree );
+        EXPECT_LE( tree.root().height() , size_t( 5 ) );
+    }
+    for( size_t budget=1 ; budget<=6 ; ++budget )
+    {
+        for( size_t i=0 ; i<100 ; ++i )
+        {
+            typename TestFixture::tree_type tree;
+            generator( tree , budget );
+            EXPECT_LE( tree.root().height() , std::min( budget , size_t( 5 ) ) );
+        }
+    }
+}
+
+TYPED_TEST( ptc2_tests , point_mutation )
+{
+    auto generator = gpcxx::make_ptc2( this->m_gen.rng , this->m_gen.node_generator , 1 , 10 , 4 );
+    auto mutation = gpcxx::make_point_mutation( this->m_gen.rng , generator , 6 , 10 );
+    for( size_t i=0 ; i<100 ; ++i )
+    {
+        typename TestFixture::tree_type tree = this->m_test_trees.data;
+        mutation( tree );
+        EXPECT_LE( tree.root().height() , size_t( 6 ) );
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * test/generate/static_node_generator.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/generate/static_node_generator.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+#include <gpcxx/util/philox_engine.hpp>
+
+#include "../common/test_generator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+#define TESTNAME static_node_generator_tests
+
+
+using namespace std;
+using namespace gpcxx;
+
+struct TESTNAME : public ::testing::Test
+{
+    size_t m_num_trials = 300000;
+    test_generator m_gen;
+
+    size_t arity_of( std::string const& s ) const
+    {
+        if( contains( m_gen.term_symbols , s ) ) return 0;
+        if( contains( m_gen.unary_symbols , s ) ) return 1;
+        return 2;
+    }
+
+    auto make_generator( double w0 , double w1 , double w2 )
+    {
+        return make_static_node_generator< std::string >(
+            make_weighted_generator( w1 , 1 , m_gen.gen1 ) ,
+            make_weighted_generator( w0 , 0 , m_gen.gen0 ) ,
+            make_weighted_generator( w2 , 2 , m_gen.gen2 ) );
+    }
+};
+
+TEST_F( TESTNAME , weights_and_arities )
+{
+    auto generator = make_generator( 5.0 , 2.0 , 1.0 );
+    EXPECT_EQ( generator.dim , size_t( 3 ) );
+    EXPECT_EQ( generator.arity( 0 ) , size_t( 1 ) );
+    EXPECT_EQ( generator.arity( 1 ) , size_t( 0 ) );
+    EXPECT_DOUBLE_EQ( generator.weight( 0 ) , 2.0 );
+    EXPECT_DOUBLE_EQ( generator.weight( 2 ) , 1.0 );
+}
+
+TEST_F( TESTNAME , node_frequencies )
+{
+    auto generator = make_generator( 5.0 , 2.0 , 1.0 );
+    std::array< size_t , 3 > any = {{ 0 , 0 , 0 }} , non_terminal = {{ 0 , 0 , 0 }};
+    for( size_t i=0 ; i<m_num_trials ; ++i )
+    {
+        auto n = generator.get_node( m_gen.rng );
+        EXPECT_EQ( n.second , arity_of( n.first ) );
+        ++any[ n.second ];
+        auto m = generator.get_non_terminal_node( m_gen.rng );
+        EXPECT_EQ( m.second , arity_of( m.first ) );
+        ++non_terminal[ m.second ];
+        EXPECT_EQ( arity_of( generator.get_terminal( m_gen.rng ).first ) , size_t( 0 ) );
+    }
+    double n = double( m_num_trials );
+    EXPECT_NEAR( double( any[0] ) / n , 5.0 / 8.0 , 0.005 );
+    EXPECT_NEAR( double( any[1] ) / n , 2.0 / 8.0 , 0.005 );
+    EXPECT_NEAR( double( any[2] ) / n , 1.0 / 8.0 , 0.005 );
+    EXPECT_EQ( non_terminal[0] , size_t( 0 ) );
+    EXPECT_NEAR( double( non_terminal[1] ) / n , 2.0 / 3.0 , 0.005 );
+    EXPECT_NEAR( double( non_terminal[2] ) / n , 1.0 / 3.0 , 0.005 );
+
+    EXPECT_EQ( arity_of( generator.get_node2( m_gen.rng , 2 ) ) , size_t( 2 ) );
+}
+
+TEST_F( TESTNAME , generates_trees_with_any_engine )
+{
+    auto generator = make_generator( 1.0 , 1.0 , 1.0 );
+    gpcxx::philox_engine rng( 42 );
+    auto tree_generator = make_ramp( rng , generator , 2 , 5 , 0.5 );
+    for( size_t i=0 ; i<100 ; ++i )
+    {
+        gpcxx::basic_tree< std::string > tree;
+        tree_generator( tree );
+        EXPECT_GE( tree.root().height() , size_t( 2 ) );
+        EXPECT_LE( tree.root().height() , size_t( 5 ) );
+        for( size_t j=0 ; j<tree.size() ; ++j )
+        {
+            auto c = tree.rank_is( j );
+            EXPECT_EQ( arity_of( *c ) , c.size() );
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * test/io/best_individuals.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/io/best_individuals.hpp>
+
+#include "../common/test_tree.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#define TESTNAME best_individuals_tests
+
+TEST( TESTNAME , best_individuals )
+{
+    test_tree< basic_tree_tag > trees;
+    std::vector< basic_tree< std::string > > pop = { trees.data , trees.data2 , trees.data };
+    std::vector< double > fitness = { 3.0 , 1.0 , 2.0 };
+
+    std::ostringstream str;
+    str << gpcxx::best_individuals( pop , fitness , 0 , 2 );
+    EXPECT_EQ( str.str() , "0 1 : cos( y ) minus x\n1 2 : sin( x ) plus ( y minus 2 )" );
+}
+
+TEST( TESTNAME , more_individuals_requested_than_available )
+{
+    test_tree< basic_tree_tag > trees;
+    std::vector< basic_tree< std::string > > pop = { trees.data , trees.data2 };
+    std::vector< double > fitness = { 3.0 , 1.0 };
+
+    std::ostringstream str;
+    str << gpcxx::best_individuals( pop , fitness , 0 , 10 );
+    EXPECT_EQ( str.str() , "0 1 : cos( y ) minus x\n1 3 : sin( x ) plus ( y minus 2 )" );
+}
+
+TEST( TESTNAME , best_individuals_with_rank_cache )
+{
+    test_tree< basic_tree_tag > trees;
+    std::vector< basic_tree< std::string > > pop = { trees.data , trees.data2 , trees.data };
+    std::vector< double > fitness = { 3.0 , 1.0 , 2.0 };
+    gpcxx::rank_cache ranks;
+
+    std::ostringstream str1 , str2;
+    str1 << gpcxx::best_individuals( pop , fitness , 0 , 2 );
+    str2 << gpcxx::best_individuals( pop , fitness , ranks , 0 , 2 );
+    EXPECT_EQ( str1.str() , str2.str() );
+    EXPECT_TRUE( ranks.valid() );
+    EXPECT_EQ( ranks.best( fitness , 1 )[0] , size_t( 1 ) );
+}
@@ -0,0 +1,131 @@
+/*
+ * test/io/binary.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/io/binary.hpp>
+#include <gpcxx/io/polish.hpp>
+
+#include "../common/test_template.hpp"
+#include "../common/node_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+
+template <class T>
+struct binary_tests : public test_template< T >
+{
+    node_mapper< T > m_mapper;
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( binary_tests , Implementations );
+
+TYPED_TEST( binary_tests , empty_tree )
+{
+    std::string buffer = gpcxx::binary_string( this->m_tree );
+    EXPECT_EQ( buffer.size() , size_t( 1 ) );
+    typename TestFixture::tree_type tree;
+    gpcxx::read_binary( buffer , tree , this->m_mapper );
+    EXPECT_TRUE( tree.empty() );
+}
+
+TYPED_TEST( binary_tests , round_trip )
+{
+    for( auto const* t : { &this->m_test_trees.data , &this->m_test_trees.data2 , &this->m_test_trees.data3 } )
+    {
+        std::string buffer = gpcxx::binary_string( *t );
+        auto tree = gpcxx::read_binary< typename TestFixture::tree_type >( buffer , this->m_mapper );
+        EXPECT_EQ( tree.size() , t->size() );
+        EXPECT_EQ( gpcxx::polish_string( tree ) , gpcxx::polish_string( *t ) );
+    }
+}
+
+TYPED_TEST( binary_tests , several_trees_in_one_buffer )
+{
+    std::string buffer;
+    gpcxx::write_binary( buffer , this->m_test_trees.data );
+    gpcxx::write_binary( buffer , this->m_test_trees.data2 );
+
+    typename TestFixture::tree_type t1 , t2;
+    char const* last = buffer.data() + buffer.size();
+    char const* pos = gpcxx::read_binary( buffer.data() , last , t1 , this->m_mapper );
+    pos = gpcxx::read_binary( pos , last , t2 , this->m_mapper );
+    EXPECT_EQ( pos , last );
+    EXPECT_EQ( gpcxx::polish_string( t1 ) , gpcxx::polish_string( this->m_test_trees.data ) );
+    EXPECT_EQ( gpcxx::polish_string( t2 ) , gpcxx::polish_string( this->m_test_trees.data2 ) );
+}
+
+TYPED_TEST( binary_tests , shared_symbol_table )
+{
+    std::string buffer , separate;
+    gpcxx::binary_write_table write_table;
+    gpcxx::write_binary( buffer , this->m_test_trees.data , gpcxx::identity() , write_table );
+    gpcxx::write_binary( buffer , this->m_test_trees.data , gpcxx::identity() , write_table );
+    gpcxx::write_binary( separate , this->m_test_trees.data );
+    gpcxx::write_binary( separate , this->m_test_trees.data );
+    EXPECT_LT( buffer.size() , separate.size() );
+
+    typename TestFixture::tree_type t1 , t2;
+    gpcxx::binary_read_table< node_mapper< TypeParam > > read_table( this->m_mapper );
+    char const* last = buffer.data() + buffer.size();
+    char const* pos = gpcxx::read_binary( buffer.data() , last , t1 , read_table );
+    pos = gpcxx::read_binary( pos , last , t2 , read_table );
+    EXPECT_EQ( pos , last );
+    EXPECT_EQ( gpcxx::polish_string( t1 ) , gpcxx::polish_string( this->m_test_trees.data ) );
+    EXPECT_EQ( gpcxx::polish_string( t2 ) , gpcxx::polish_string( this->m_test_trees.data ) );
+}
+
+TYPED_TEST( binary_tests , symbols_are_written_once )
+{
+    typename TestFixture::tree_type tree;
+    auto c = tree.insert_below( tree.root() , this->m_factory( "plus" ) );
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        tree.insert_below( c , this->m_factory( "x" ) );
+        c = tree.insert_below( c , this->m_factory( "plus" ) );
+    }
+    tree.insert_below( c , this->m_factory( "x" ) );
+    tree.insert_below( c , this->m_factory( "x" ) );
+
+    std::string buffer = gpcxx::binary_string( tree );
+    EXPECT_LT( buffer.size() , gpcxx::polish_string( tree ).size() );
+    EXPECT_EQ( gpcxx::polish_string( gpcxx::read_binary< typename TestFixture::tree_type >( buffer , this->m_mapper ) ) ,
+               gpcxx::polish_string( tree ) );
+}
+
+TYPED_TEST( binary_tests , malformed_data_throws )
+{
+    std::string buffer = gpcxx::binary_string( this->m_test_trees.data );
+    typename TestFixture::tree_type t1 , t2;
+    EXPECT_THROW( gpcxx::read_binary( buffer.substr( 0 , buffer.size() - 1 ) , t1 , this->m_mapper ) , gpcxx::gpcxx_exception );
+    buffer[0] = char( 7 );
+    EXPECT_THROW( gpcxx::read_binary( buffer , t2 , this->m_mapper ) , gpcxx::gpcxx_exception );
+}
+
+TYPED_TEST( binary_tests , wrong_arity_throws )
+{
+    // sin with two children
+    std::string buffer;
+    gpcxx::detail::write_varint( buffer , 3 );
+    for( auto s : { std::make_pair( 2 , "sin" ) , std::make_pair( 0 , "x" ) , std::make_pair( 0 , "y" ) } )
+    {
+        gpcxx::detail::write_varint( buffer , s.first );
+        gpcxx::detail::write_varint( buffer , 0 );
+        gpcxx::detail::write_varint( buffer , std::string( s.second ).size() );
+        buffer.append( s.second );
+    }
+    typename TestFixture::tree_type t;
+    EXPECT_THROW( gpcxx::read_binary( buffer , t , this->m_mapper ) , gpcxx::gpcxx_exception );
+}
@@ -0,0 +1,220 @@
+/*
+ * test/io/checkpoint.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/io/checkpoint.hpp>
+#include <gpcxx/io/polish.hpp>
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/tournament_selector.hpp>
+
+#include "../common/test_template.hpp"
+#include "../common/node_mapper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+
+template <class T>
+struct checkpoint_tests : public test_template< T >
+{
+    using population_type = std::vector< typename test_template< T >::tree_type >;
+
+    node_mapper< T > m_mapper;
+
+    population_type make_population( size_t n )
+    {
+        population_type pop;
+        for( size_t i=0 ; i<n ; ++i )
+            pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+        return pop;
+    }
+};
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( checkpoint_tests , Implementations );
+
+TYPED_TEST( checkpoint_tests , round_trip )
+{
+    auto pop = this->make_population( 10 );
+    pop.push_back( this->m_tree );
+    std::vector< double > fitness( pop.size() );
+    for( size_t i=0 ; i<fitness.size() ; ++i ) fitness[i] = std::sqrt( double( i ) ) / 3.0;
+    fitness[3] = NAN;
+
+    std::mt19937 rng;
+    rng.discard( 17 );
+    gpcxx::checkpoint_state state;
+    state.generation = 42;
+    state.rng_state = gpcxx::rng_state( rng );
+    state.parameters[ "number_elite" ] = "1";
+    state.parameters[ "tournament_size" ] = "15";
+
+    std::string buffer;
+    gpcxx::write_checkpoint( buffer , pop , fitness , state );
+
+    typename TestFixture::population_type pop2( 3 );
+    std::vector< double > fitness2;
+    gpcxx::checkpoint_state state2;
+    gpcxx::read_checkpoint( buffer , pop2 , fitness2 , state2 , this->m_mapper );
+
+    ASSERT_EQ( pop2.size() , pop.size() );
+    ASSERT_EQ( fitness2.size() , fitness.size() );
+    for( size_t i=0 ; i<pop.size() ; ++i )
+    {
+        EXPECT_EQ( gpcxx::polish_string( pop2[i] ) , gpcxx::polish_string( pop[i] ) );
+        if( i != 3 ) { EXPECT_EQ( fitness2[i] , fitness[i] ); }
+    }
+    EXPECT_TRUE( std::isnan( fitness2[3] ) );
+    EXPECT_EQ( state2.generation , std::uint64_t( 42 ) );
+    EXPECT_EQ( state2.parameters , state.parameters );
+
+    std::mt19937 rng2;
+    gpcxx::restore_rng_state( rng2 , state2.rng_state );
+    EXPECT_EQ( rng2() , rng() );
+}
+
+TYPED_TEST( checkpoint_tests , individuals_with_several_trees )
+{
+    using individual_type = std::array< typename TestFixture::tree_type , 2 >;
+    std::vector< individual_type > pop( 2 );
+    pop[0][0] = this->m_test_trees.data;
+    pop[0][1] = this->m_test_trees.data2;
+    pop[1][0] = this->m_test_trees.data3;
+    std::vector< double > fitness = { 1.0 , 2.0 };
+
+    std::string buffer;
+    gpcxx::write_checkpoint( buffer , pop , fitness , gpcxx::checkpoint_state() );
+
+    std::vector< individual_type > pop2;
+    std::vector< double > fitness2;
+    gpcxx::checkpoint_state state2;
+    gpcxx::read_checkpoint( buffer , pop2 , fitness2 , state2 , this->m_mapper );
+    ASSERT_EQ( pop2.size() , size_t( 2 ) );
+    for( size_t i=0 ; i<2 ; ++i )
+        for( size_t j=0 ; j<2 ; ++j )
+            EXPECT_EQ( gpcxx::polish_string( pop2[i][j] ) , gpcxx::polish_string( pop[i][j] ) );
+}
+
+TYPED_TEST( checkpoint_tests , symbols_are_written_once_per_checkpoint )
+{
+    auto pop = this->make_population( 100 );
+    std::vector< double > fitness( pop.size() , 0.0 );
+    std::string buffer , single;
+    gpcxx::write_checkpoint( buffer , pop , fitness , gpcxx::checkpoint_state() );
+    for( auto const& t : pop ) gpcxx::write_binary( single , t );
+    EXPECT_LT( buffer.size() , single.size() + pop.size() * sizeof( double ) );
+}
+
+TYPED_TEST( checkpoint_tests , corrupted_data_throws )
+{
+    auto pop = this->make_population( 4 );
+    std::vector< double > fitness( pop.size() , 1.0 );
+    std::string buffer;
+    gpcxx::write_checkpoint( buffer , pop , fitness , gpcxx::checkpoint_state() );
+
+    typename TestFixture::population_type pop2;
+    std::vector< double > fitness2;
+    gpcxx::checkpoint_state state2;
+
+    std::string corrupted = buffer;
+    corrupted[ corrupted.size() / 2 ] ^= 1;
+    EXPECT_THROW( gpcxx::read_checkpoint( corrupted , pop2 , fitness2 , state2 , this->m_mapper ) , gpcxx::gpcxx_exception );
+    EXPECT_THROW( gpcxx::read_checkpoint( buffer.substr( 0 , buffer.size() - 1 ) , pop2 , fitness2 , state2 , this->m_mapper ) , gpcxx::gpcxx_exception );
+    EXPECT_THROW( gpcxx::read_checkpoint( std::string( "no checkpoint at all" ) , pop2 , fitness2 , state2 , this->m_mapper ) , gpcxx::gpcxx_exception );
+}
+
+TYPED_TEST( checkpoint_tests , async_writer )
+{
+    std::string filename = "checkpoint_tests_async_writer.bin";
+    auto pop = this->make_population( 20 );
+    std::vector< double > fitness( pop.size() , 0.25 );
+    gpcxx::checkpoint_state state;
+    {
+        gpcxx::async_checkpoint_writer writer;
+        for( size_t g=0 ; g<5 ; ++g )
+        {
+            state.generation = g;
+            writer.write( filename , pop , fitness , state );
+        }
+        writer.wait();
+        EXPECT_GE( writer.written() , size_t( 1 ) );
+    }
+
+    typename TestFixture::population_type pop2;
+    std::vector< double > fitness2;
+    gpcxx::checkpoint_state state2;
+    gpcxx::read_checkpoint( gpcxx::read_checkpoint_file( filename ) , pop2 , fitness2 , state2 , this->m_mapper );
+    EXPECT_EQ( state2.generation , std::uint64_t( 4 ) );
+    EXPECT_EQ( pop2.size() , pop.size() );
+    std::remove( filename.c_str() );
+
+    gpcxx::async_checkpoint_writer writer;
+    writer.write( "/nonexistent_directory/checkpoint.bin" , pop , fitness , state );
+    EXPECT_THROW( writer.wait() , gpcxx::gpcxx_exception );
+}
+
+TYPED_TEST( checkpoint_tests , resume_bit_identically )
+{
+    using population_type = typename TestFixture::population_type;
+    using fitness_type = std::vector< double >;
+    using rng_type = std::mt19937;
+
+    auto evolve = []( rng_type& rng , population_type& pop , fitness_type& fitness , size_t generations ) {
+        gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > pipeline( rng , 1 );
+        pipeline.add_operator( gpcxx::make_crossover(
+            gpcxx::make_one_point_crossover_strategy( rng , 6 ) ,
+            gpcxx::make_tournament_selector( rng , 3 ) ) , 0.6 );
+        pipeline.add_operator( gpcxx::make_reproduce( gpcxx::make_tournament_selector( rng , 3 ) ) , 0.4 );
+        for( size_t g=0 ; g<generations ; ++g )
+        {
+            pipeline.next_generation( pop , fitness );
+            for( size_t i=0 ; i<pop.size() ; ++i ) fitness[i] = double( pop[i].size() ) + 1.0 / double( i + 1 );
+        }
+    };
+
+    rng_type rng;
+    auto pop = this->make_population( 32 );
+    fitness_type fitness( pop.size() );
+    for( size_t i=0 ; i<pop.size() ; ++i ) fitness[i] = double( pop[i].size() );
+    evolve( rng , pop , fitness , 3 );
+
+    gpcxx::checkpoint_state state;
+    state.generation = 3;
+    state.rng_state = gpcxx::rng_state( rng );
+    std::string buffer;
+    gpcxx::write_checkpoint( buffer , pop , fitness , state );
+
+    evolve( rng , pop , fitness , 3 );
+
+    rng_type rng2;
+    population_type pop2;
+    fitness_type fitness2;
+    gpcxx::checkpoint_state state2;
+    gpcxx::read_checkpoint( buffer , pop2 , fitness2 , state2 , this->m_mapper );
+    gpcxx::restore_rng_state( rng2 , state2.rng_state );
+    evolve( rng2 , pop2 , fitness2 , 3 );
+
+    ASSERT_EQ( pop2.size() , pop.size() );
+    for( size_t i=0 ; i<pop.size() ; ++i )
+        EXPECT_EQ( gpcxx::polish_string( pop2[i] ) , gpcxx::polish_string( pop[i] ) );
+    EXPECT_EQ( fitness2 , fitness );
+}
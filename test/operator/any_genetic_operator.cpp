@@ -19,12 +19,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <array>
+
 #define TESTNAME any_genetic_operator_tests
 
 using population_type = std::vector< gpcxx::basic_tree< std::string > >;
 using fitness_type = std::vector< double > ;
-using selection_type = std::vector< population_type::const_iterator >;
 using any_genetic_operator_type = gpcxx::any_genetic_operator< population_type , fitness_type >;
+using selection_type = any_genetic_operator_type::selection_type;
 
 struct mocker
 {
@@ -276,3 +278,100 @@ TEST( TESTNAME , operation )
     op.operation( selection_type {} );
 }
 
+
+TEST( TESTNAME , operation_into_slots_falls_back_to_vector_operation )
+{
+    mocker m;
+    EXPECT_CALL( m , copy() )
+        .Times( 1 );
+    population_type offspring( 1 );
+    offspring[0].insert_below( offspring[0].root() , "x" );
+    EXPECT_CALL( m , operation( testing::_ ) )
+        .Times( 1 )
+        .WillOnce( Return( offspring ) );
+    mock_functor f( m );
+    any_genetic_operator_type op( f );
+    population_type new_pop( 2 );
+    auto iter = op.operation( selection_type {} , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.begin() + 1 );
+    EXPECT_EQ( new_pop[0] , offspring[0] );
+    EXPECT_TRUE( new_pop[1].empty() );
+}
+
+struct slot_functor
+{
+    static const size_t arity = 1;
+
+    population_type operator()( population_type const& pop , fitness_type const& fitness ) { return population_type {}; }
+    selection_type selection( population_type const& pop , fitness_type const& fitness ) { return selection_type( 1 , pop.begin() ); }
+    population_type operation( selection_type const& selection ) { return population_type {}; }
+    population_type::iterator operation( selection_type const& selection , population_type::iterator first , population_type::iterator last )
+    {
+        *first = *( selection[0] );
+        return ++first;
+    }
+};
+
+TEST( TESTNAME , operation_into_slots )
+{
+    population_type pop( 1 );
+    pop[0].insert_below( pop[0].root() , "y" );
+    any_genetic_operator_type op( slot_functor {} );
+    population_type new_pop( 1 );
+    auto iter = op.operation( op.selection( pop , fitness_type( 1 ) ) , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.end() );
+    EXPECT_EQ( new_pop[0] , pop[0] );
+}
+
+struct large_functor : slot_functor
+{
+    std::array< double , 32 > m_payload;
+    size_t* m_copies;
+
+    large_functor( size_t* copies ) : m_payload() , m_copies( copies ) { }
+    large_functor( large_functor const& f ) : m_payload( f.m_payload ) , m_copies( f.m_copies ) { ++( *m_copies ); }
+    large_functor( large_functor&& f ) = default;
+};
+
+TEST( TESTNAME , large_operator_is_stored_out_of_place )
+{
+    static_assert( sizeof( large_functor ) > any_genetic_operator_type::buffer_size , "large_functor must not fit into the buffer" );
+    size_t copies = 0;
+    any_genetic_operator_type op( large_functor { &copies } );
+    any_genetic_operator_type op2( op );
+    EXPECT_EQ( copies , size_t( 1 ) );
+    any_genetic_operator_type op3( std::move( op2 ) );
+    EXPECT_EQ( copies , size_t( 1 ) );
+    EXPECT_FALSE( op2 );
+    EXPECT_TRUE( op3 );
+
+    population_type pop( 1 );
+    pop[0].insert_below( pop[0].root() , "z" );
+    population_type new_pop( 1 );
+    op3.operation( op3.selection( pop , fitness_type( 1 ) ) , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( new_pop[0] , pop[0] );
+}
+
+struct in_place_selection_functor : slot_functor
+{
+    size_t* m_calls;
+    in_place_selection_functor( size_t* calls ) : m_calls( calls ) { }
+
+    selection_type selection( population_type const& pop , fitness_type const& fitness ) { return selection_type {}; }
+    void selection( population_type const& pop , fitness_type const& fitness , selection_type& s )
+    {
+        ++( *m_calls );
+        s[0] = pop.begin();
+    }
+};
+
+TEST( TESTNAME , selection_in_place )
+{
+    size_t calls = 0;
+    population_type pop( 2 );
+    any_genetic_operator_type op( in_place_selection_functor { &calls } );
+    auto s = op.selection( pop , fitness_type( 2 ) );
+    EXPECT_EQ( calls , size_t( 1 ) );
+    ASSERT_EQ( s.size() , size_t( 1 ) );
+    EXPECT_EQ( s[0] , pop.begin() );
+}
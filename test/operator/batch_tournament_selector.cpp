@@ -0,0 +1,195 @@
+/*
+ * test/operator/batch_tournament_selector.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/batch_tournament_selector.hpp>
+#include <gpcxx/operator/reproduce.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/simple_mutation_strategy.hpp>
+#include <gpcxx/evolve/dynamic_pipeline.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define TESTNAME batch_tournament_selector_tests
+
+
+TEST( TESTNAME , bounded_uint32 )
+{
+    gpcxx::philox_engine rng( 17 );
+    std::vector< size_t > counts( 7 , 0 );
+    for( size_t i=0 ; i<70000 ; ++i )
+    {
+        auto x = gpcxx::detail::bounded_uint32( rng , 7 );
+        ASSERT_LT( x , 7u );
+        ++counts[x];
+    }
+    for( auto c : counts ) EXPECT_NEAR( double( c ) , 10000.0 , 500.0 );
+}
+
+TEST( TESTNAME , batched_bounded_uint32 )
+{
+    gpcxx::philox_engine rng( 17 );
+    std::vector< std::uint32_t > raw( 70000 ) , x( raw.size() );
+    rng.generate( raw.data() , raw.size() );
+    gpcxx::detail::bounded_uint32( rng , 7 , raw.data() , x.data() , x.size() );
+    std::vector< size_t > counts( 7 , 0 );
+    for( auto v : x )
+    {
+        ASSERT_LT( v , 7u );
+        ++counts[v];
+    }
+    for( auto c : counts ) EXPECT_NEAR( double( c ) , 10000.0 , 500.0 );
+
+    // a power of two is never biased, the indices are the high bits of the raw values
+    gpcxx::detail::bounded_uint32( rng , 16 , raw.data() , x.data() , x.size() );
+    for( size_t i=0 ; i<x.size() ; ++i ) EXPECT_EQ( x[i] , raw[i] >> 28 );
+}
+
+TEST( TESTNAME , winners_independent_of_number_of_threads )
+{
+    std::vector< double > fitness( 1000 );
+    for( size_t i=0 ; i<fitness.size() ; ++i ) fitness[i] = std::sin( double( i ) );
+
+    gpcxx::batch_tournament_selector sel1( 42 , 15 , 1 );
+    gpcxx::batch_tournament_selector sel3( 42 , 15 , 3 );
+    std::vector< size_t > w1 , w3;
+    for( size_t g=0 ; g<3 ; ++g )
+    {
+        sel1.select( fitness , 1000 , w1 );
+        sel3.select( fitness , 1000 , w3 );
+        EXPECT_EQ( w1 , w3 );
+    }
+    EXPECT_EQ( sel1.generation() , 3u );
+
+    // a new generation gives new winners
+    std::vector< size_t > w2;
+    sel1.select( fitness , 1000 , w2 );
+    EXPECT_NE( w1 , w2 );
+}
+
+TEST( TESTNAME , large_tournaments_select_the_best )
+{
+    std::vector< double > fitness = { 3.0 , INFINITY , 1.0 , 2.0 , 4.0 };
+    gpcxx::batch_tournament_selector sel( 1 , 1000 );
+    std::vector< size_t > winners;
+    sel.select( fitness , 600 , winners );
+    ASSERT_EQ( winners.size() , size_t( 600 ) );
+    for( auto w : winners ) EXPECT_EQ( w , size_t( 2 ) );
+}
+
+TEST( TESTNAME , selection_pressure )
+{
+    std::vector< double > fitness( 100 );
+    for( size_t i=0 ; i<fitness.size() ; ++i ) fitness[i] = double( i );
+    gpcxx::batch_tournament_selector sel( 3 , 2 );
+    std::vector< size_t > winners;
+    sel.select( fitness , 10000 , winners );
+    double mean = 0.0;
+    for( auto w : winners ) mean += double( w );
+    mean /= double( winners.size() );
+    // the expected rank of the winner of a binary tournament is about n / 3
+    EXPECT_NEAR( mean , 33.0 , 2.0 );
+}
+
+
+template <class T>
+struct batched_tournament_selector_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( batched_tournament_selector_tests , Implementations );
+
+TYPED_TEST( batched_tournament_selector_tests , refills_for_new_population )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    population_type pop = { this->m_test_trees.data , this->m_test_trees.data2 , this->m_test_trees.data };
+    std::vector< double > fitness = { 2.0 , 1.0 , 3.0 };
+
+    auto selector = gpcxx::make_batched_tournament_selector( 5 , 100 );
+    auto copy = selector;
+    for( size_t i=0 ; i<3 ; ++i ) EXPECT_EQ( selector( pop , fitness ) , pop.begin() + 1 );
+    EXPECT_EQ( selector.batch().generation() , 1u );
+    EXPECT_EQ( copy( pop , fitness ) , pop.begin() + 1 );
+    EXPECT_EQ( selector.batch().generation() , 2u );
+
+    // a population of another size
+    population_type pop2 = { this->m_test_trees.data , this->m_test_trees.data2 };
+    std::vector< double > fitness2 = { 0.0 , 1.0 };
+    EXPECT_EQ( copy( pop2 , fitness2 ) , pop2.begin() );
+    EXPECT_EQ( selector.batch().generation() , 3u );
+
+    fitness2[1] = -1.0;
+    selector.invalidate();
+    EXPECT_EQ( selector( pop2 , fitness2 ) , pop2.begin() + 1 );
+    EXPECT_EQ( selector.batch().generation() , 4u );
+}
+
+TYPED_TEST( batched_tournament_selector_tests , refills_for_new_epoch )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    population_type pop = { this->m_test_trees.data , this->m_test_trees.data2 , this->m_test_trees.data };
+    std::vector< double > fitness = { 2.0 , 1.0 , 3.0 };
+    size_t epoch = 0;
+
+    auto selector = gpcxx::make_batched_tournament_selector( 5 , 100 );
+    selector.set_epoch( epoch );
+    EXPECT_EQ( selector( pop , fitness ) , pop.begin() + 1 );
+    EXPECT_EQ( selector( pop , fitness ) , pop.begin() + 1 );
+    EXPECT_EQ( selector.batch().generation() , 1u );
+
+    // the population is changed in place
+    fitness[2] = 0.0;
+    ++epoch;
+    EXPECT_EQ( selector( pop , fitness ) , pop.begin() + 2 );
+    EXPECT_EQ( selector.batch().generation() , 2u );
+}
+
+TYPED_TEST( batched_tournament_selector_tests , dynamic_pipeline )
+{
+    using population_type = std::vector< typename TestFixture::tree_type >;
+    using fitness_type = std::vector< double >;
+    using rng_type = typename TestFixture::generator_type::rng_type;
+
+    population_type pop;
+    fitness_type fitness;
+    for( size_t i=0 ; i<20 ; ++i )
+    {
+        pop.push_back( ( i % 2 == 0 ) ? this->m_test_trees.data : this->m_test_trees.data2 );
+        fitness.push_back( double( pop.back().size() ) );
+    }
+
+    auto selector = gpcxx::make_batched_tournament_selector( 11 , 3 , 2 );
+    gpcxx::dynamic_pipeline< population_type , fitness_type , rng_type > pipeline( this->m_gen.rng , 1 );
+    selector.set_epoch( pipeline.selection_epoch() );
+    pipeline.add_operator( gpcxx::make_reproduce( selector ) , 0.5 );
+    pipeline.add_operator( gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) , selector ) , 0.5 );
+
+    for( size_t g=0 ; g<5 ; ++g )
+    {
+        pipeline.next_generation( pop , fitness );
+        ASSERT_EQ( pop.size() , size_t( 20 ) );
+        for( size_t i=0 ; i<pop.size() ; ++i )
+        {
+            EXPECT_FALSE( pop[i].empty() );
+            fitness[i] = double( pop[i].size() );
+        }
+    }
+    // one batch per generation
+    EXPECT_EQ( selector.batch().generation() , 5u );
+}
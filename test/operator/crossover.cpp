@@ -36,3 +36,24 @@ TYPED_TEST( crossover_tests , instanciation )
     EXPECT_EQ( crossover_nodes.size() , size_t( 2 ) );
 }
 
+
+TYPED_TEST( crossover_tests , write_into_slots )
+{
+    std::vector< typename TestFixture::tree_type > pop = { this->m_test_trees.data , this->m_test_trees.data2 , this->m_test_trees.data };
+    std::vector< double > fitness( 3 );
+    auto c = gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( this->m_gen.rng , 10 ) ,
+        gpcxx::make_random_selector( this->m_gen.rng ) );
+
+    std::vector< typename TestFixture::tree_type > new_pop( 3 );
+    auto iter = c( pop , fitness , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.begin() + 2 );
+    EXPECT_FALSE( new_pop[0].empty() );
+    EXPECT_FALSE( new_pop[1].empty() );
+    EXPECT_TRUE( new_pop[2].empty() );
+
+    // only one slot left, the second offspring is discarded
+    iter = c.operation( c.selection( pop , fitness ) , iter , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.end() );
+    EXPECT_FALSE( new_pop[2].empty() );
+}
@@ -0,0 +1,130 @@
+/*
+ * test/operator/geometric_semantic_operators.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/geometric_semantic_crossover_strategy.hpp>
+#include <gpcxx/operator/geometric_semantic_mutation_strategy.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/random_selector.hpp>
+#include <gpcxx/eval/regression_fitness.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#define TESTNAME geometric_semantic_operators_tests
+
+using namespace std;
+
+namespace {
+
+// the tree is the slope of a line through the origin
+struct slope_eval
+{
+    using context_type = std::array< double , 1 >;
+    using value_type = double;
+    double operator()( double slope , context_type const& x ) const { return slope * x[0]; }
+};
+
+using individual = gpcxx::semantic_individual< double >;
+
+struct fixture
+{
+    fixture( void ) : fitness_f( slope_eval {} ) , slope_dist( -3.0 , 3.0 )
+    {
+        data.x[0] = { -2.0 , -0.5 , 1.0 , 3.0 };
+        for( double x : data.x[0] ) data.y.push_back( 1.5 * x );
+        for( size_t i=0 ; i<10 ; ++i )
+        {
+            double slope = 0.0;
+            generator( slope );
+            std::vector< double > s;
+            fitness_f.get_outputs( slope , data , s );
+            pop.emplace_back( slope , s );
+            fitness.push_back( fitness_f.from_outputs( pop.back().semantics() , data ) );
+        }
+    }
+
+    void generator( double& slope ) { slope = slope_dist( rng ); }
+
+    std::mt19937 rng;
+    gpcxx::regression_training_data< double , 1 > data;
+    gpcxx::regression_fitness< slope_eval > fitness_f;
+    std::uniform_real_distribution< double > slope_dist;
+    std::vector< individual > pop;
+    std::vector< double > fitness;
+};
+
+}
+
+TEST( TESTNAME , fitness_from_outputs )
+{
+    fixture f;
+    for( auto const& ind : f.pop )
+    {
+        double slope = ( ind.semantics()[2] ) / f.data.x[0][2];
+        EXPECT_NEAR( f.fitness_f.from_outputs( ind.semantics() , f.data ) , f.fitness_f( slope , f.data ) , 1.0e-12 );
+    }
+}
+
+TEST( TESTNAME , crossover )
+{
+    fixture f;
+    auto gen = [&f]( double& slope ) { f.generator( slope ); };
+    auto c = gpcxx::make_crossover( gpcxx::make_geometric_semantic_crossover_strategy( gen , f.fitness_f , f.data ) ,
+                                    gpcxx::make_random_selector( f.rng ) );
+    for( size_t k=0 ; k<20 ; ++k )
+    {
+        auto sel = c.selection( f.pop , f.fitness );
+        auto offspring = c.operation( sel );
+        ASSERT_EQ( offspring.size() , size_t( 2 ) );
+        for( size_t i=0 ; i<f.data.y.size() ; ++i )
+        {
+            double lo = std::min( sel[0]->semantics()[i] , sel[1]->semantics()[i] );
+            double hi = std::max( sel[0]->semantics()[i] , sel[1]->semantics()[i] );
+            for( auto const& o : offspring )
+            {
+                EXPECT_GE( o.semantics()[i] , lo - 1.0e-12 );
+                EXPECT_LE( o.semantics()[i] , hi + 1.0e-12 );
+                EXPECT_NEAR( o.semantics()[i] , o.eval( slope_eval {} , slope_eval::context_type {{ f.data.x[0][i] }} ) , 1.0e-12 );
+            }
+            // the offspring are the mirrored convex combinations
+            EXPECT_NEAR( offspring[0].semantics()[i] + offspring[1].semantics()[i] ,
+                         sel[0]->semantics()[i] + sel[1]->semantics()[i] , 1.0e-12 );
+        }
+        f.pop[k % f.pop.size()] = offspring[0];
+    }
+}
+
+TEST( TESTNAME , mutation )
+{
+    fixture f;
+    auto gen = [&f]( double& slope ) { f.generator( slope ); };
+    double const step = 0.1;
+    auto m = gpcxx::make_mutation( gpcxx::make_geometric_semantic_mutation_strategy( gen , f.fitness_f , f.data , step ) ,
+                                   gpcxx::make_random_selector( f.rng ) );
+    for( size_t k=0 ; k<20 ; ++k )
+    {
+        auto sel = m.selection( f.pop , f.fitness );
+        auto offspring = m.operation( sel );
+        ASSERT_EQ( offspring.size() , size_t( 1 ) );
+        for( size_t i=0 ; i<f.data.y.size() ; ++i )
+        {
+            EXPECT_LT( std::abs( offspring[0].semantics()[i] - sel[0]->semantics()[i] ) , step );
+            EXPECT_NEAR( offspring[0].semantics()[i] ,
+                         offspring[0].eval( slope_eval {} , slope_eval::context_type {{ f.data.x[0][i] }} ) , 1.0e-12 );
+        }
+        f.pop[k % f.pop.size()] = offspring[0];
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * test/operator/height_constrained_crossover_strategy.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/height_constrained_crossover_strategy.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+template <class T>
+struct height_constrained_crossover_strategy_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( height_constrained_crossover_strategy_tests , Implementations );
+
+TYPED_TEST( height_constrained_crossover_strategy_tests , test_trees )
+{
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        auto c = gpcxx::make_height_constrained_crossover_strategy( this->m_gen.rng , size_t( 4 ) );
+        size_t l1 = this->m_test_trees.data.size() + this->m_test_trees.data2.size();
+        EXPECT_TRUE( c( this->m_test_trees.data , this->m_test_trees.data2 ) );
+        EXPECT_EQ( l1 , this->m_test_trees.data.size() + this->m_test_trees.data2.size() );
+        EXPECT_LE( this->m_test_trees.data.root().height() , size_t( 4 ) );
+        EXPECT_LE( this->m_test_trees.data2.root().height() , size_t( 4 ) );
+    }
+}
+
+TYPED_TEST( height_constrained_crossover_strategy_tests , never_fails_at_the_height_limit )
+{
+    size_t const max_height = 7;
+    auto tree_generator = gpcxx::make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , max_height , 0.5 );
+    auto c = gpcxx::make_height_constrained_crossover_strategy( this->m_gen.rng , max_height , 0.9 );
+    for( size_t i=0 ; i<200 ; ++i )
+    {
+        typename TestFixture::tree_type t1 , t2;
+        tree_generator( t1 );
+        tree_generator( t2 );
+        ASSERT_LE( t1.root().height() , max_height );
+        ASSERT_LE( t2.root().height() , max_height );
+
+        size_t size = t1.size() + t2.size();
+        EXPECT_TRUE( c( t1 , t2 ) );
+        EXPECT_EQ( t1.size() + t2.size() , size );
+        EXPECT_LE( t1.root().height() , max_height );
+        EXPECT_LE( t2.root().height() , max_height );
+    }
+}
+
+TYPED_TEST( height_constrained_crossover_strategy_tests , parents_above_the_limit )
+{
+    auto c = gpcxx::make_height_constrained_crossover_strategy( this->m_gen.rng , size_t( 1 ) , 0.0 , 10 );
+    EXPECT_FALSE( c( this->m_test_trees.data , this->m_test_trees.data2 ) );
+}
@@ -0,0 +1,94 @@
+/*
+ * test/operator/hoist_mutation.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/hoist_mutation.hpp>
+#include <gpcxx/operator/mutation.hpp>
+#include <gpcxx/operator/random_selector.hpp>
+#include <gpcxx/generate/ramp.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+template <class T>
+struct hoist_mutation_tests : public test_template< T > { };
+
+using testing::Types;
+using namespace gpcxx;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( hoist_mutation_tests , Implementations );
+
+TYPED_TEST( hoist_mutation_tests , proper_subtrees )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto const& data = this->m_test_trees.data;
+    std::vector< tree_type > subtrees;
+    for( size_t i=1 ; i<data.size() ; ++i ) subtrees.push_back( tree_type( data.rank_is( i ) ) );
+    std::vector< size_t > counts( subtrees.size() , 0 );
+
+    auto strategy = make_hoist_mutation( this->m_gen.rng );
+    size_t n = 5000;
+    for( size_t i=0 ; i<n ; ++i )
+    {
+        tree_type tree = data;
+        strategy( tree );
+        auto iter = std::find( subtrees.begin() , subtrees.end() , tree );
+        ASSERT_TRUE( iter != subtrees.end() );
+        ++counts[ iter - subtrees.begin() ];
+    }
+    for( size_t c : counts )
+        EXPECT_NEAR( double( c ) / double( n ) , 1.0 / double( subtrees.size() ) , 0.03 );
+}
+
+TYPED_TEST( hoist_mutation_tests , single_node )
+{
+    using tree_type = typename TestFixture::tree_type;
+    tree_type tree( this->m_test_trees.data.root().children( 0 ).children( 0 ) );
+    tree_type expected = tree;
+    auto strategy = make_hoist_mutation( this->m_gen.rng );
+    strategy( tree );
+    EXPECT_EQ( tree , expected );
+}
+
+TYPED_TEST( hoist_mutation_tests , random_trees )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto generator = make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , 6 , 0.5 );
+    auto strategy = make_hoist_mutation( this->m_gen.rng );
+    for( size_t i=0 ; i<1000 ; ++i )
+    {
+        tree_type tree;
+        generator( tree );
+        size_t size = tree.size();
+        strategy( tree );
+        EXPECT_LT( tree.size() , size );
+        EXPECT_EQ( tree.size() , tree_type( tree.root() ).size() );
+    }
+}
+
+TYPED_TEST( hoist_mutation_tests , mutation )
+{
+    using tree_type = typename TestFixture::tree_type;
+    std::vector< tree_type > pop = { this->m_test_trees.data , this->m_test_trees.data2 };
+    std::vector< double > fitness( pop.size() , 0.0 );
+    auto m = make_mutation( make_hoist_mutation( this->m_gen.rng ) , make_random_selector( this->m_gen.rng ) );
+    for( size_t i=0 ; i<100 ; ++i )
+    {
+        auto offspring = m( pop , fitness );
+        ASSERT_EQ( offspring.size() , size_t( 1 ) );
+        EXPECT_LT( offspring[0].size() , size_t( 6 ) );
+    }
+}
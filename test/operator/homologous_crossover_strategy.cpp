@@ -0,0 +1,89 @@
+/*
+ * test/operator/homologous_crossover_strategy.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/homologous_crossover_strategy.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+
+template <class T>
+struct homologous_crossover_strategy_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( homologous_crossover_strategy_tests , Implementations );
+
+template< typename Cursor >
+size_t child_position( Cursor c )
+{
+    size_t j = 0;
+    while( c.parent().children( j ) != c ) ++j;
+    return j;
+}
+
+TYPED_TEST( homologous_crossover_strategy_tests , test_trees )
+{
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        auto c = gpcxx::make_homologous_crossover_strategy( this->m_gen.rng , size_t( 4 ) );
+        size_t l1 = this->m_test_trees.data.size() + this->m_test_trees.data2.size();
+        EXPECT_TRUE( c( this->m_test_trees.data , this->m_test_trees.data2 ) );
+        EXPECT_EQ( l1 , this->m_test_trees.data.size() + this->m_test_trees.data2.size() );
+        EXPECT_LE( this->m_test_trees.data.root().height() , size_t( 4 ) );
+        EXPECT_LE( this->m_test_trees.data2.root().height() , size_t( 4 ) );
+    }
+}
+
+TYPED_TEST( homologous_crossover_strategy_tests , common_region_of_equally_shaped_trees )
+{
+    auto c = gpcxx::make_homologous_crossover_strategy( this->m_gen.rng , size_t( 10 ) );
+    typename TestFixture::tree_type t1 = this->m_test_trees.data , t2 = this->m_test_trees.data;
+    typename TestFixture::tree_type::cursor n1 , n2;
+    c.select_points( t1 , t2 , n1 , n2 );
+    EXPECT_EQ( c.common_region_size() , t1.size() );
+}
+
+TYPED_TEST( homologous_crossover_strategy_tests , points_at_the_same_position )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto tree_generator = gpcxx::make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , 8 , 0.5 );
+    auto c = gpcxx::make_homologous_crossover_strategy( this->m_gen.rng , size_t( 8 ) );
+    for( size_t i=0 ; i<500 ; ++i )
+    {
+        tree_type t1 , t2;
+        tree_generator( t1 );
+        tree_generator( t2 );
+        size_t height = std::max( t1.root().height() , t2.root().height() );
+        typename tree_type::cursor n1 , n2;
+        if( ! c.select_points( t1 , t2 , n1 , n2 ) ) continue;
+        EXPECT_GE( c.common_region_size() , size_t( 1 ) );
+        EXPECT_LE( c.common_region_size() , std::min( t1.size() , t2.size() ) );
+
+        // the paths from the roots to the points have the same child positions
+        for( auto p1 = n1 , p2 = n2 ; ! p1.is_root() ; p1 = p1.parent() , p2 = p2.parent() )
+        {
+            ASSERT_FALSE( p2.is_root() );
+            EXPECT_EQ( p1.parent().size() , p2.parent().size() );
+            EXPECT_EQ( child_position( p1 ) , child_position( p2 ) );
+        }
+        EXPECT_EQ( n1.level() , n2.level() );
+
+        swap_subtrees( t1 , n1 , t2 , n2 );
+        EXPECT_LE( t1.root().height() , height );
+        EXPECT_LE( t2.root().height() , height );
+    }
+}
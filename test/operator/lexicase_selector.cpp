@@ -0,0 +1,130 @@
+/*
+ * test/operator/lexicase_selector.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/lexicase_selector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#define TESTNAME lexicase_selector_tests
+
+using namespace std;
+
+TEST( TESTNAME , specialists_are_selected )
+{
+    // individual i is perfect on case i and bad on all others, individual 3 is mediocre everywhere
+    gpcxx::error_matrix<> errors( 4 , 3 );
+    for( size_t i=0 ; i<4 ; ++i )
+        for( size_t c=0 ; c<3 ; ++c )
+            errors( i , c ) = ( i == 3 ) ? 5.0 : ( ( i == c ) ? 0.0 : 10.0 );
+
+    std::mt19937 rng;
+    gpcxx::epsilon_lexicase_selector< std::mt19937 > sel( rng );
+    std::vector< size_t > winners;
+    sel.select( errors , 3000 , winners );
+
+    std::vector< size_t > count( 4 , 0 );
+    for( auto w : winners ) ++count[w];
+    EXPECT_EQ( count[3] , size_t( 0 ) );
+    for( size_t i=0 ; i<3 ; ++i ) EXPECT_NEAR( double( count[i] ) , 1000.0 , 100.0 );
+}
+
+TEST( TESTNAME , median_absolute_deviation )
+{
+    gpcxx::error_matrix<> errors( 5 , 2 );
+    double c0[] = { 1.0 , 2.0 , 3.0 , 4.0 , 100.0 };
+    double c1[] = { 1.0 , 1.0 , 1.0 , NAN , INFINITY };
+    for( size_t i=0 ; i<5 ; ++i )
+    {
+        errors( i , 0 ) = c0[i];
+        errors( i , 1 ) = c1[i];
+    }
+
+    std::mt19937 rng;
+    gpcxx::epsilon_lexicase_selector< std::mt19937 > sel( rng );
+    std::vector< size_t > winners;
+    sel.select( errors , 1000 , winners );
+    ASSERT_EQ( sel.epsilons().size() , size_t( 2 ) );
+    EXPECT_DOUBLE_EQ( sel.epsilons()[0] , 1.0 );
+    EXPECT_DOUBLE_EQ( sel.epsilons()[1] , 0.0 );
+
+    // within epsilon of the best on case 0 are 0 and 1, of these 0 and 1 are equal on case 1
+    std::vector< size_t > count( 5 , 0 );
+    for( auto w : winners ) ++count[w];
+    EXPECT_EQ( count[0] + count[1] , size_t( 1000 ) );
+    EXPECT_GT( count[0] , size_t( 400 ) );
+    EXPECT_GT( count[1] , size_t( 400 ) );
+}
+
+TEST( TESTNAME , non_finite_errors )
+{
+    gpcxx::error_matrix<> errors( 3 , 2 );
+    errors( 0 , 0 ) = NAN;      errors( 0 , 1 ) = 0.0;
+    errors( 1 , 0 ) = 1.0;      errors( 1 , 1 ) = NAN;
+    errors( 2 , 0 ) = INFINITY; errors( 2 , 1 ) = 1.0;
+
+    std::mt19937 rng;
+    gpcxx::epsilon_lexicase_selector< std::mt19937 > sel( rng );
+    std::vector< size_t > winners;
+    sel.select( errors , 1000 , winners );
+    std::vector< size_t > count( 3 , 0 );
+    for( auto w : winners ) ++count[w];
+    EXPECT_EQ( count[2] , size_t( 0 ) );
+    EXPECT_GT( count[0] , size_t( 400 ) );
+    EXPECT_GT( count[1] , size_t( 400 ) );
+}
+
+TEST( TESTNAME , selector_adaptor )
+{
+    gpcxx::error_matrix<> errors( 3 , 2 );
+    for( size_t i=0 ; i<3 ; ++i )
+        for( size_t c=0 ; c<2 ; ++c )
+            errors( i , c ) = ( i == 1 ) ? 0.0 : 1.0;
+
+    std::mt19937 rng;
+    auto sel = gpcxx::make_lexicase_selector( rng , errors );
+    auto copy = sel;
+    std::vector< int > pop = { 10 , 11 , 12 };
+    std::vector< double > fitness( 3 , 0.0 );
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        EXPECT_EQ( *sel( pop , fitness ) , 11 );
+        EXPECT_EQ( *copy( pop , fitness ) , 11 );
+    }
+}
+
+TEST( TESTNAME , selector_adaptor_refills_for_new_epoch )
+{
+    gpcxx::error_matrix<> errors( 3 , 2 );
+    for( size_t i=0 ; i<3 ; ++i )
+        for( size_t c=0 ; c<2 ; ++c )
+            errors( i , c ) = ( i == 1 ) ? 0.0 : 1.0;
+
+    std::mt19937 rng;
+    size_t epoch = 0;
+    auto sel = gpcxx::make_lexicase_selector( rng , errors );
+    sel.set_epoch( epoch );
+    std::vector< int > pop = { 10 , 11 , 12 };
+    std::vector< double > fitness( 3 , 0.0 );
+    EXPECT_EQ( *sel( pop , fitness ) , 11 );
+
+    // the population and the errors are changed in place
+    for( size_t c=0 ; c<2 ; ++c )
+    {
+        errors( 1 , c ) = 1.0;
+        errors( 2 , c ) = 0.0;
+    }
+    ++epoch;
+    EXPECT_EQ( *sel( pop , fitness ) , 12 );
+}
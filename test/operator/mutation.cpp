@@ -31,3 +31,20 @@ TYPED_TEST( mutation_tests , instanciation )
     auto mutated_nodes = m( pop , fitness );
     EXPECT_EQ( mutated_nodes.size() , size_t( 1 ) );
 }
+
+TYPED_TEST( mutation_tests , write_into_slots )
+{
+    std::vector< typename TestFixture::tree_type > pop = { this->m_test_trees.data , this->m_test_trees.data2 };
+    std::vector< double > fitness( 2 );
+    auto m = gpcxx::make_mutation(
+        gpcxx::make_simple_mutation_strategy( this->m_gen.rng , this->m_gen.node_generator ) ,
+        gpcxx::make_random_selector( this->m_gen.rng ) );
+
+    std::vector< typename TestFixture::tree_type > new_pop( 2 );
+    auto iter = m( pop , fitness , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.begin() + 1 );
+    EXPECT_FALSE( new_pop[0].empty() );
+    iter = m.operation( m.selection( pop , fitness ) , iter , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.end() );
+    EXPECT_FALSE( new_pop[1].empty() );
+}
@@ -0,0 +1,54 @@
+/*
+ * test/operator/one_point_crossover_pip_strategy.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/one_point_crossover_pip_strategy.hpp>
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+
+template <class T>
+struct one_point_crossover_pip_strategy_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( one_point_crossover_pip_strategy_tests , Implementations );
+
+TYPED_TEST( one_point_crossover_pip_strategy_tests , heights )
+{
+    auto c = gpcxx::make_one_point_crossover_pip_strategy( this->m_gen.rng , size_t( 5 ) );
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        size_t l1 = this->m_test_trees.data.size() + this->m_test_trees.data2.size();
+        EXPECT_TRUE( c( this->m_test_trees.data , this->m_test_trees.data2 ) );
+        EXPECT_EQ( l1 , this->m_test_trees.data.size() + this->m_test_trees.data2.size() );
+        EXPECT_LE( this->m_test_trees.data.root().height() , size_t( 5 ) );
+        EXPECT_LE( this->m_test_trees.data2.root().height() , size_t( 5 ) );
+    }
+}
+
+TYPED_TEST( one_point_crossover_pip_strategy_tests , selects_nodes_below_unary_nodes )
+{
+    // never favor internal nodes, the x below sin in plus( sin( x ) , minus( y , 2 ) ) is a candidate as well
+    auto c = gpcxx::make_one_point_crossover_pip_strategy( this->m_gen.rng , size_t( 10 ) , size_t( 100 ) , -1.0 );
+    size_t below_unary = 0;
+    for( size_t i=0 ; i<200 ; ++i )
+    {
+        auto t1 = this->m_test_trees.data;
+        auto t2 = this->m_test_trees.data2;
+        EXPECT_TRUE( c( t1 , t2 ) );
+        auto first = t1.root().children( 0 );
+        if( ( *first == this->m_factory( "sin" ) ) && ( *first.children( 0 ) != this->m_factory( "x" ) ) ) ++below_unary;
+    }
+    EXPECT_GT( below_unary , size_t( 0 ) );
+}
@@ -11,6 +11,7 @@
 
 #include <gpcxx/operator/point_mutation.hpp>
 #include <gpcxx/generate/basic_generate_strategy.hpp>
+#include <gpcxx/generate/ramp.hpp>
 #include <gpcxx/io/simple.hpp>
 
 #include "../common/test_template.hpp"
@@ -40,3 +41,38 @@ TYPED_TEST( point_mutation_tests , instanciation )
         EXPECT_LE( tree.root().height() , size_t( 5 ) );
     }
 }
+
+TYPED_TEST( point_mutation_tests , height_budget_never_rejects )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto generator = make_ramp( this->m_gen.rng , this->m_gen.node_generator , 1 , 4 , 0.5 );
+    size_t calls = 0;
+    auto counting_generator = [&]( tree_type& t , size_t max_height ) { ++calls; generator( t , max_height ); };
+    auto strategy = make_point_mutation( this->m_gen.rng , counting_generator , 5 , 1 );
+
+    for( size_t i=0 ; i<1000 ; ++i )
+    {
+        tree_type tree;
+        generator( tree );
+        calls = 0;
+        strategy( tree );
+        EXPECT_EQ( calls , size_t( 1 ) );
+        EXPECT_LE( tree.root().height() , size_t( 5 ) );
+    }
+}
+
+TYPED_TEST( point_mutation_tests , rejection_without_height_budget )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto generator = make_ramp( this->m_gen.rng , this->m_gen.node_generator , 1 , 5 , 0.5 );
+    auto plain_generator = [&]( tree_type& t ) { generator( t ); };
+    auto strategy = make_point_mutation( this->m_gen.rng , plain_generator , 5 , 128 );
+
+    for( size_t i=0 ; i<1000 ; ++i )
+    {
+        tree_type tree;
+        generator( tree );
+        strategy( tree );
+        EXPECT_LE( tree.root().height() , size_t( 5 ) );
+    }
+}
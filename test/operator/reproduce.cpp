@@ -34,3 +34,18 @@ TYPED_TEST( reproduce_tests , instanciation )
     EXPECT_EQ( nodes.size() , size_t( 1 ) );
 }
 
+
+TYPED_TEST( reproduce_tests , write_into_slots )
+{
+    std::vector< typename TestFixture::tree_type > pop = { this->m_test_trees.data , this->m_test_trees.data };
+    std::vector< double > fitness( 2 );
+    auto c = gpcxx::make_reproduce( gpcxx::make_random_selector( this->m_gen.rng ) );
+
+    std::vector< typename TestFixture::tree_type > new_pop( 2 );
+    auto iter = c( pop , fitness , new_pop.begin() , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.begin() + 1 );
+    EXPECT_EQ( new_pop[0] , this->m_test_trees.data );
+    iter = c.operation( c.selection( pop , fitness ) , iter , new_pop.end() );
+    EXPECT_EQ( iter , new_pop.end() );
+    EXPECT_EQ( new_pop[1] , this->m_test_trees.data );
+}
@@ -0,0 +1,95 @@
+/*
+ * test/operator/shrink_mutation.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/shrink_mutation.hpp>
+#include <gpcxx/generate/ramp.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+template <class T>
+struct shrink_mutation_tests : public test_template< T > { };
+
+using testing::Types;
+using namespace gpcxx;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( shrink_mutation_tests , Implementations );
+
+TYPED_TEST( shrink_mutation_tests , replaced_by_own_terminal )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto& f = this->m_factory;
+
+    // data is plus( sin( x ) , minus( y , 2 ) )
+    std::vector< tree_type > expected( 6 );
+    expected[0].insert_below( expected[0].root() , f( "x" ) );
+    expected[1].insert_below( expected[1].root() , f( "y" ) );
+    expected[2].insert_below( expected[2].root() , f( "2" ) );
+    {
+        auto r = expected[3].insert_below( expected[3].root() , f( "plus" ) );
+        expected[3].insert_below( r , f( "x" ) );
+        auto m = expected[3].insert_below( r , f( "minus" ) );
+        expected[3].insert_below( m , f( "y" ) );
+        expected[3].insert_below( m , f( "2" ) );
+    }
+    for( size_t i=4 ; i<6 ; ++i )
+    {
+        auto r = expected[i].insert_below( expected[i].root() , f( "plus" ) );
+        auto s = expected[i].insert_below( r , f( "sin" ) );
+        expected[i].insert_below( s , f( "x" ) );
+        expected[i].insert_below( r , f( ( i == 4 ) ? "y" : "2" ) );
+    }
+
+    auto strategy = make_shrink_mutation( this->m_gen.rng );
+    std::vector< size_t > counts( expected.size() , 0 );
+    for( size_t i=0 ; i<3000 ; ++i )
+    {
+        tree_type tree = this->m_test_trees.data;
+        strategy( tree );
+        auto iter = std::find( expected.begin() , expected.end() , tree );
+        ASSERT_TRUE( iter != expected.end() );
+        ++counts[ iter - expected.begin() ];
+    }
+    for( size_t c : counts ) { EXPECT_GT( c , size_t( 0 ) ); }
+}
+
+TYPED_TEST( shrink_mutation_tests , single_node )
+{
+    using tree_type = typename TestFixture::tree_type;
+    tree_type tree( this->m_test_trees.data.root().children( 0 ).children( 0 ) );
+    tree_type expected = tree;
+    auto strategy = make_shrink_mutation( this->m_gen.rng );
+    strategy( tree );
+    EXPECT_EQ( tree , expected );
+}
+
+TYPED_TEST( shrink_mutation_tests , random_trees )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto generator = make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , 6 , 0.5 );
+    auto strategy = make_shrink_mutation( this->m_gen.rng );
+    for( size_t i=0 ; i<1000 ; ++i )
+    {
+        tree_type tree;
+        generator( tree );
+        size_t size = tree.size() , height = tree.root().height();
+        strategy( tree );
+        EXPECT_LT( tree.size() , size );
+        EXPECT_LE( tree.root().height() , height );
+        EXPECT_EQ( tree.size() , tree_type( tree.root() ).size() );
+    }
+}
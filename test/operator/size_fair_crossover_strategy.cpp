@@ -0,0 +1,76 @@
+/*
+ * test/operator/size_fair_crossover_strategy.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/size_fair_crossover_strategy.hpp>
+#include <gpcxx/generate/ramp.hpp>
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+
+
+template <class T>
+struct size_fair_crossover_strategy_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( size_fair_crossover_strategy_tests , Implementations );
+
+template< typename Cursor >
+size_t subtree_size( Cursor c )
+{
+    size_t s = 1;
+    for( auto child = c.begin() ; child != c.end() ; ++child ) s += subtree_size( child );
+    return s;
+}
+
+TYPED_TEST( size_fair_crossover_strategy_tests , test_trees )
+{
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        auto c = gpcxx::make_size_fair_crossover_strategy( this->m_gen.rng , size_t( 4 ) );
+        size_t l1 = this->m_test_trees.data.size() + this->m_test_trees.data2.size();
+        EXPECT_TRUE( c( this->m_test_trees.data , this->m_test_trees.data2 ) );
+        EXPECT_EQ( l1 , this->m_test_trees.data.size() + this->m_test_trees.data2.size() );
+        EXPECT_LE( this->m_test_trees.data.root().height() , size_t( 4 ) );
+        EXPECT_LE( this->m_test_trees.data2.root().height() , size_t( 4 ) );
+    }
+}
+
+TYPED_TEST( size_fair_crossover_strategy_tests , second_subtree_is_at_most_twice_as_large )
+{
+    using tree_type = typename TestFixture::tree_type;
+    size_t const max_height = 8;
+    auto tree_generator = gpcxx::make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , max_height , 0.5 );
+    auto c = gpcxx::make_size_fair_crossover_strategy( this->m_gen.rng , max_height );
+    double size_change = 0.0;
+    size_t const n = 2000;
+    for( size_t i=0 ; i<n ; ++i )
+    {
+        tree_type t1 , t2;
+        tree_generator( t1 );
+        tree_generator( t2 );
+        tree_type const& ct1 = t1;
+        tree_type const& ct2 = t2;
+        typename tree_type::const_cursor n1 , n2;
+        if( ! c.select_points( ct1 , ct2 , n1 , n2 ) ) continue;
+        size_t s1 = subtree_size( n1 ) , s2 = subtree_size( n2 );
+        EXPECT_LE( s2 , 1 + 2 * s1 );
+        EXPECT_LE( n1.level() + n2.height() , max_height );
+        EXPECT_LE( n2.level() + n1.height() , max_height );
+        size_change += double( s2 ) - double( s1 );
+    }
+    EXPECT_LT( std::abs( size_change / double( n ) ) , 1.0 );
+}
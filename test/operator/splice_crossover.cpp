@@ -0,0 +1,95 @@
+/*
+ * test/operator/splice_crossover.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/operator/splice_crossover.hpp>
+#include <gpcxx/operator/crossover.hpp>
+#include <gpcxx/operator/one_point_crossover_strategy.hpp>
+#include <gpcxx/operator/height_constrained_crossover_strategy.hpp>
+#include <gpcxx/operator/random_selector.hpp>
+#include <gpcxx/generate/ramp.hpp>
+
+#include "../common/test_template.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+template <class T>
+struct splice_crossover_tests : public test_template< T > { };
+
+using testing::Types;
+
+typedef Types< basic_tree_tag , intrusive_tree_tag > Implementations;
+
+TYPED_TEST_CASE( splice_crossover_tests , Implementations );
+
+TYPED_TEST( splice_crossover_tests , splice_tree )
+{
+    auto const& t1 = this->m_test_trees.data;
+    auto const& t2 = this->m_test_trees.data2;
+    typename TestFixture::tree_type expected1 = t1 , expected2 = t2;
+    expected1.swap_subtrees( expected1.root().children( 1 ) , expected2 , expected2.root().children( 0 ) );
+
+    typename TestFixture::tree_type out;
+    gpcxx::detail::splice_tree( out , t1 , t1.root().children( 1 ) , t2.root().children( 0 ) );
+    EXPECT_EQ( out , expected1 );
+    gpcxx::detail::splice_tree( out , t2 , t2.root().children( 0 ) , t1.root().children( 1 ) );
+    EXPECT_EQ( out , expected2 );
+
+    gpcxx::detail::splice_tree( out , t1 , t1.root() , t2.root() );
+    EXPECT_EQ( out , t2 );
+}
+
+TYPED_TEST( splice_crossover_tests , same_offspring_as_crossover )
+{
+    using tree_type = typename TestFixture::tree_type;
+    auto tree_generator = gpcxx::make_ramp( this->m_gen.rng , this->m_gen.node_generator , 2 , 6 , 0.5 );
+    std::vector< tree_type > pop( 20 );
+    for( auto& t : pop ) tree_generator( t );
+    std::vector< double > fitness( pop.size() , 0.0 );
+
+    std::mt19937 rng1( 5 ) , rng2( 5 );
+    auto c = gpcxx::make_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng1 , 6 ) , gpcxx::make_random_selector( rng1 ) );
+    auto s = gpcxx::make_splice_crossover(
+        gpcxx::make_one_point_crossover_strategy( rng2 , 6 ) , gpcxx::make_random_selector( rng2 ) );
+
+    for( size_t i=0 ; i<50 ; ++i )
+    {
+        std::vector< tree_type > slots1( 3 ) , slots2( 3 );
+        // two slots and one slot
+        auto last1 = c( pop , fitness , slots1.begin() , slots1.end() );
+        auto last2 = s( pop , fitness , slots2.begin() , slots2.end() );
+        last1 = c( pop , fitness , last1 , slots1.end() );
+        last2 = s( pop , fitness , last2 , slots2.end() );
+        EXPECT_EQ( last1 , slots1.end() );
+        EXPECT_EQ( last2 , slots2.end() );
+        EXPECT_EQ( slots1 , slots2 );
+    }
+}
+
+TYPED_TEST( splice_crossover_tests , height_constrained_strategy )
+{
+    using tree_type = typename TestFixture::tree_type;
+    std::vector< tree_type > pop = { this->m_test_trees.data , this->m_test_trees.data2 , this->m_test_trees.data };
+    std::vector< double > fitness( 3 );
+    auto s = gpcxx::make_splice_crossover(
+        gpcxx::make_height_constrained_crossover_strategy( this->m_gen.rng , 4 ) ,
+        gpcxx::make_random_selector( this->m_gen.rng ) );
+
+    auto selection = s.selection( pop , fitness );
+    auto offspring = s.operation( selection );
+    ASSERT_EQ( offspring.size() , size_t( 2 ) );
+    EXPECT_LE( offspring[0].root().height() , size_t( 4 ) );
+    EXPECT_LE( offspring[1].root().height() , size_t( 4 ) );
+    EXPECT_EQ( offspring[0].size() + offspring[1].size() , selection[0]->size() + selection[1]->size() );
+}
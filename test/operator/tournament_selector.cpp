@@ -9,6 +9,7 @@
  */
 
 #include <gpcxx/operator/tournament_selector.hpp>
+#include <gpcxx/util/philox_engine.hpp>
 #include "../common/test_template.hpp"
 
 #include <gtest/gtest.h>
@@ -30,3 +31,17 @@ TYPED_TEST( tournament_selector_tests , instanciation )
     /* auto node = */ selector( pop , fitness );
 }
 
+TYPED_TEST( tournament_selector_tests , counter_based_rng_is_reproducible )
+{
+    std::vector< typename TestFixture::tree_type > pop( 10 , typename TestFixture::tree_type() );
+    std::vector< double > fitness = { 5.0 , 3.0 , 9.0 , 1.0 , 4.0 , 7.0 , 2.0 , 8.0 , 6.0 , 0.5 };
+    for( size_t i=0 ; i<10 ; ++i )
+    {
+        auto rng1 = gpcxx::make_philox_stream( 42 , 1 , i , 0 );
+        auto rng2 = gpcxx::make_philox_stream( 42 , 1 , i , 0 );
+        auto selector1 = gpcxx::make_tournament_selector( rng1 , 3 );
+        auto selector2 = gpcxx::make_tournament_selector( rng2 , 3 );
+        EXPECT_EQ( selector1( pop , fitness ) , selector2( pop , fitness ) );
+    }
+}
+
@@ -0,0 +1,78 @@
+/*
+ * test/tree/hash_tree.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "../common/test_tree.hpp"
+#include <gpcxx/tree/hash_tree.hpp>
+#include <gpcxx/tree/intrusive_erc_generator.hpp>
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <cmath>
+#include <string>
+
+
+#define TESTNAME hash_tree_tests
+
+using namespace std;
+
+template< typename T >
+class TESTNAME : public testing::Test
+{
+protected:
+    test_tree< T > m_test_trees;
+};
+
+using Implementations = testing::Types< basic_tree_tag , intrusive_tree_tag >;
+TYPED_TEST_CASE( TESTNAME , Implementations );
+
+TYPED_TEST( TESTNAME , equal_trees_have_equal_hashes )
+{
+    auto copy = this->m_test_trees.data;
+    EXPECT_EQ( gpcxx::hash_tree( this->m_test_trees.data ) , gpcxx::hash_tree( copy ) );
+    EXPECT_NE( gpcxx::hash_tree( this->m_test_trees.data ) , gpcxx::hash_tree( this->m_test_trees.data2 ) );
+    EXPECT_EQ( gpcxx::hash_cursor( this->m_test_trees.data.root().children( 0 ) ) ,
+               gpcxx::hash_cursor( copy.root().children( 0 ) ) );
+}
+
+TYPED_TEST( TESTNAME , order_of_children_matters )
+{
+    typename test_tree< TypeParam >::factory_type factory;
+    typename test_tree< TypeParam >::tree_type t1 , t2;
+    auto r1 = t1.insert_below( t1.root() , factory( "plus" ) );
+    t1.insert_below( r1 , factory( "x" ) );
+    t1.insert_below( r1 , factory( "y" ) );
+    auto r2 = t2.insert_below( t2.root() , factory( "plus" ) );
+    t2.insert_below( r2 , factory( "y" ) );
+    t2.insert_below( r2 , factory( "x" ) );
+    EXPECT_NE( gpcxx::hash_tree( t1 ) , gpcxx::hash_tree( t2 ) );
+}
+
+TEST( TESTNAME , custom_node_hash )
+{
+    gpcxx::basic_tree< std::string > t1 , t2;
+    t1.insert_below( t1.root() , "x" );
+    t2.insert_below( t2.root() , "X" );
+    auto lower = []( std::string const& s ) { return std::hash< std::string >()( std::string( 1 , char( std::tolower( s[0] ) ) ) ); };
+    EXPECT_NE( gpcxx::hash_tree( t1 ) , gpcxx::hash_tree( t2 ) );
+    EXPECT_EQ( gpcxx::hash_tree( t1 , lower ) , gpcxx::hash_tree( t2 , lower ) );
+    EXPECT_EQ( gpcxx::hash_tree( gpcxx::basic_tree< std::string >() ) , std::uint64_t( 0 ) );
+}
+
+TEST( TESTNAME , erc_names_are_exact )
+{
+    EXPECT_EQ( gpcxx::detail::erc_name( 0.5 ) , "0.5" );
+    EXPECT_EQ( gpcxx::detail::erc_name( -2.0 ) , "-2" );
+    EXPECT_EQ( gpcxx::detail::erc_name( 0.1 ) , "0.1" );
+    EXPECT_NE( gpcxx::detail::erc_name( 0.1 ) , gpcxx::detail::erc_name( 0.1000001 ) );
+    EXPECT_NE( gpcxx::detail::erc_name( 0.1 ) , gpcxx::detail::erc_name( std::nextafter( 0.1 , 1.0 ) ) );
+    EXPECT_EQ( std::stod( gpcxx::detail::erc_name( std::nextafter( 0.1 , 1.0 ) ) ) , std::nextafter( 0.1 , 1.0 ) );
+    EXPECT_EQ( gpcxx::detail::erc_name( 42 ) , "42" );
+}
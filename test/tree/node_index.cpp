@@ -0,0 +1,168 @@
+/*
+ * test/tree/node_index.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "../common/test_tree.hpp"
+#include <gpcxx/tree/node_index.hpp>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+
+#define TESTNAME node_index_tests
+
+using namespace std;
+
+template< typename T >
+class TESTNAME : public testing::Test
+{
+protected:
+    using tree_type = typename test_tree< T >::tree_type;
+    using index_type = gpcxx::node_index< typename tree_type::cursor >;
+    test_tree< T > m_test_trees;
+};
+
+using Implementations = testing::Types< basic_tree_tag , intrusive_tree_tag >;
+TYPED_TEST_CASE( TESTNAME , Implementations );
+
+TYPED_TEST( TESTNAME , nodes_in_rank_order )
+{
+    auto& t = this->m_test_trees.data;
+    typename TestFixture::index_type index( t );
+    ASSERT_EQ( index.size() , t.size() );
+    EXPECT_EQ( index.tree_height() , t.root().height() );
+    for( size_t i=0 ; i<t.size() ; ++i )
+    {
+        auto c = t.rank_is( i );
+        EXPECT_EQ( index.cursor( i ) , c );
+        EXPECT_EQ( index.level( i ) , c.level() );
+        EXPECT_EQ( index.height( i ) , c.height() );
+        EXPECT_EQ( index.arity( i ) , c.size() );
+
+        size_t subtree_size = 1;
+        for( size_t j=0 ; j<index.arity( i ) ; ++j )
+        {
+            EXPECT_EQ( index.cursor( index.first_child( i ) + j ) , c.children( j ) );
+            subtree_size += index.subtree_size( index.first_child( i ) + j );
+        }
+        EXPECT_EQ( index.subtree_size( i ) , subtree_size );
+    }
+    EXPECT_EQ( index.subtree_size( 0 ) , t.size() );
+}
+
+TYPED_TEST( TESTNAME , groups )
+{
+    auto& t = this->m_test_trees.data2;
+    typename TestFixture::index_type index( t );
+
+    size_t total = 0;
+    for( size_t a=0 ; a<4 ; ++a )
+    {
+        for( size_t i : index.with_arity( a ) ) EXPECT_EQ( index.arity( i ) , a );
+        total += index.with_arity( a ).size();
+    }
+    EXPECT_EQ( total , t.size() );
+    EXPECT_EQ( index.terminals().size() + index.functions().size() , t.size() );
+    EXPECT_EQ( index.with_arity_at_most( 1 ).size() + index.with_arity_at_least( 2 ).size() , t.size() );
+
+    for( size_t l=0 ; l<index.tree_height() ; ++l )
+    {
+        for( size_t i : index.at_level( l ) ) EXPECT_EQ( index.level( i ) , l );
+        for( size_t i : index.with_level_at_most( l ) ) EXPECT_LE( index.level( i ) , l );
+    }
+    for( size_t h=1 ; h<=index.tree_height() ; ++h )
+    {
+        for( size_t i : index.with_height( h ) ) EXPECT_EQ( index.height( i ) , h );
+        for( size_t i : index.with_height_at_most( h ) ) EXPECT_LE( index.height( i ) , h );
+    }
+    EXPECT_EQ( index.with_height_at_most( index.tree_height() ).size() , t.size() );
+    for( size_t s=1 ; s<=t.size() ; ++s )
+    {
+        for( size_t i : index.with_subtree_size( s ) ) EXPECT_EQ( index.subtree_size( i ) , s );
+        for( size_t i : index.with_subtree_size_between( 2 , s ) )
+        {
+            EXPECT_GE( index.subtree_size( i ) , size_t( 2 ) );
+            EXPECT_LE( index.subtree_size( i ) , s );
+        }
+    }
+    EXPECT_EQ( index.with_subtree_size_between( 1 , t.size() ).size() , t.size() );
+    EXPECT_TRUE( index.with_height( index.tree_height() + 1 ).empty() );
+    EXPECT_TRUE( index.with_arity( 17 ).empty() );
+}
+
+TYPED_TEST( TESTNAME , sample_from_group )
+{
+    auto& t = this->m_test_trees.data;
+    typename TestFixture::index_type index( t );
+    std::mt19937 rng;
+    auto leafs = index.with_height( 1 );
+    for( size_t k=0 ; k<100 ; ++k )
+    {
+        size_t i = TestFixture::index_type::sample( leafs , rng );
+        EXPECT_EQ( index.height( i ) , size_t( 1 ) );
+        EXPECT_LT( index.sample( rng ) , t.size() );
+    }
+}
+
+TYPED_TEST( TESTNAME , rebuild_and_empty_tree )
+{
+    auto& index = gpcxx::scratch_node_index< typename TestFixture::tree_type::cursor >();
+    index.build( this->m_test_trees.data );
+    EXPECT_EQ( index.size() , this->m_test_trees.data.size() );
+    index.build( this->m_test_trees.data2 );
+    EXPECT_EQ( index.size() , this->m_test_trees.data2.size() );
+
+    typename TestFixture::tree_type empty;
+    index.build( empty );
+    EXPECT_TRUE( index.empty() );
+    EXPECT_EQ( index.tree_height() , size_t( 0 ) );
+    EXPECT_TRUE( index.terminals().empty() );
+    EXPECT_TRUE( index.with_height_at_most( 3 ).empty() );
+}
+
+TYPED_TEST( TESTNAME , fitting_nodes )
+{
+    auto& t = this->m_test_trees.data;
+    typename TestFixture::index_type index( t );
+    std::mt19937 rng;
+    for( size_t mh=0 ; mh<=index.tree_height() + 1 ; ++mh )
+    {
+        for( size_t ml=0 ; ml<=index.tree_height() ; ++ml )
+        {
+            std::vector< size_t > fitting;
+            for( size_t i=0 ; i<index.size() ; ++i )
+                if( ( index.height( i ) <= mh ) && ( index.level( i ) <= ml ) ) fitting.push_back( i );
+            EXPECT_EQ( index.count_fitting( mh , ml ) , fitting.size() );
+
+            std::vector< size_t > drawn( index.size() , 0 );
+            for( size_t k=0 ; k<200 ; ++k )
+            {
+                size_t i = index.sample_fitting( mh , ml , rng );
+                if( fitting.empty() )
+                {
+                    EXPECT_EQ( i , index.size() );
+                }
+                else
+                {
+                    ASSERT_LT( i , index.size() );
+                    ++drawn[i];
+                }
+            }
+            size_t fitting_draws = 0;
+            for( size_t i : fitting )
+            {
+                EXPECT_GT( drawn[i] , size_t( 0 ) );
+                fitting_draws += drawn[i];
+            }
+            if( ! fitting.empty() ) { EXPECT_EQ( fitting_draws , size_t( 200 ) ); }
+        }
+    }
+}
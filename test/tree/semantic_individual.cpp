@@ -0,0 +1,96 @@
+/*
+ * test/tree/semantic_individual.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/tree/semantic_individual.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#define TESTNAME semantic_individual_tests
+
+using namespace std;
+
+namespace {
+
+// the tree is the slope of a line through the origin
+struct slope_eval
+{
+    double operator()( double slope , std::array< double , 1 > const& x ) const { return slope * x[0]; }
+};
+
+using individual = gpcxx::semantic_individual< double >;
+
+std::vector< double > const xs = { -2.0 , -0.5 , 1.0 , 3.0 };
+
+individual make_individual( double slope )
+{
+    std::vector< double > s;
+    for( double x : xs ) s.push_back( slope * x );
+    return individual( slope , s );
+}
+
+void check_semantics( individual const& ind )
+{
+    ASSERT_EQ( ind.cases() , xs.size() );
+    for( size_t i=0 ; i<xs.size() ; ++i )
+        EXPECT_NEAR( ind.semantics()[i] , ind.eval( slope_eval {} , std::array< double , 1 >{{ xs[i] }} ) , 1.0e-12 );
+}
+
+}
+
+TEST( TESTNAME , leaf )
+{
+    individual empty;
+    EXPECT_TRUE( empty.empty() );
+    EXPECT_EQ( empty.cases() , size_t( 0 ) );
+
+    individual a = make_individual( 2.0 );
+    EXPECT_FALSE( a.empty() );
+    EXPECT_EQ( a.expression_size() , size_t( 1 ) );
+    check_semantics( a );
+}
+
+TEST( TESTNAME , crossover_and_mutation )
+{
+    individual a = make_individual( 2.0 ) , b = make_individual( -1.0 ) , r = make_individual( 0.5 );
+    individual c = gpcxx::semantic_crossover( a , b , r );
+    check_semantics( c );
+    for( size_t i=0 ; i<xs.size() ; ++i )
+    {
+        double l = 1.0 / ( 1.0 + std::exp( -0.5 * xs[i] ) );
+        EXPECT_NEAR( c.semantics()[i] , l * 2.0 * xs[i] + ( 1.0 - l ) * ( -1.0 ) * xs[i] , 1.0e-12 );
+    }
+    EXPECT_EQ( c.expression_size() , size_t( 4 ) );
+
+    individual m = gpcxx::semantic_mutation( c , r , b , 0.1 );
+    check_semantics( m );
+    EXPECT_EQ( m.expression_size() , size_t( 5 ) );
+}
+
+TEST( TESTNAME , shared_operands_grow_linearly )
+{
+    individual a = make_individual( 2.0 ) , b = make_individual( -1.0 );
+    size_t const generations = 40;
+    for( size_t g=0 ; g<generations ; ++g )
+    {
+        individual r = make_individual( 0.1 * double( g ) - 1.0 );
+        individual a2 = gpcxx::semantic_crossover( a , b , r );
+        b = gpcxx::semantic_crossover( b , a , r );
+        a = a2;
+    }
+    // the expanded tree has more than 2^40 nodes
+    EXPECT_EQ( a.expression_size() , 2 + 3 * generations - 1 );
+    check_semantics( a );
+    check_semantics( b );
+}
@@ -0,0 +1,53 @@
+/*
+ * test/util/alias_table.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/alias_table.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#define TESTNAME alias_table_tests
+
+using namespace std;
+
+TEST( TESTNAME , probabilities_of_the_table )
+{
+    std::vector< double > weights = { 5.0 , 2.0 , 0.0 , 1.0 , 0.5 };
+    gpcxx::alias_table table( weights.begin() , weights.end() );
+    ASSERT_EQ( table.size() , weights.size() );
+    for( size_t i=0 ; i<weights.size() ; ++i )
+        EXPECT_NEAR( table.probability( i ) , weights[i] / 8.5 , 1.0e-12 );
+}
+
+TEST( TESTNAME , frequencies )
+{
+    gpcxx::alias_table table { 1.0 , 3.0 , 4.0 };
+    std::mt19937 rng;
+    std::vector< size_t > counts( 3 , 0 );
+    size_t const n = 800000;
+    for( size_t i=0 ; i<n ; ++i ) ++counts[ table( rng ) ];
+    EXPECT_NEAR( double( counts[0] ) / double( n ) , 0.125 , 0.003 );
+    EXPECT_NEAR( double( counts[1] ) / double( n ) , 0.375 , 0.003 );
+    EXPECT_NEAR( double( counts[2] ) / double( n ) , 0.5 , 0.003 );
+}
+
+TEST( TESTNAME , single_and_empty )
+{
+    gpcxx::alias_table empty;
+    EXPECT_TRUE( empty.empty() );
+
+    gpcxx::alias_table single { 2.0 };
+    std::mt19937 rng;
+    for( size_t i=0 ; i<100 ; ++i ) EXPECT_EQ( single( rng ) , size_t( 0 ) );
+    EXPECT_DOUBLE_EQ( single.probability( 0 ) , 1.0 );
+}
@@ -0,0 +1,136 @@
+/*
+ * test/util/philox_engine.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/philox_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <vector>
+
+#define TESTNAME philox_engine_tests
+
+using engine = gpcxx::philox_engine;
+
+
+TEST( TESTNAME , known_answer_zero )
+{
+    auto r = engine::generate_block( {{ 0 , 0 , 0 , 0 }} , {{ 0 , 0 }} );
+    EXPECT_EQ( r[0] , 0x6627e8d5u );
+    EXPECT_EQ( r[1] , 0xe169c58du );
+    EXPECT_EQ( r[2] , 0xbc57ac4cu );
+    EXPECT_EQ( r[3] , 0x9b00dbd8u );
+}
+
+TEST( TESTNAME , known_answer_ones )
+{
+    auto r = engine::generate_block( {{ 0xffffffffu , 0xffffffffu , 0xffffffffu , 0xffffffffu }} , {{ 0xffffffffu , 0xffffffffu }} );
+    EXPECT_EQ( r[0] , 0x408f276du );
+    EXPECT_EQ( r[1] , 0x41c83b0eu );
+    EXPECT_EQ( r[2] , 0xa20bc7c6u );
+    EXPECT_EQ( r[3] , 0x6d5451fdu );
+}
+
+TEST( TESTNAME , known_answer_pi )
+{
+    auto r = engine::generate_block( {{ 0x243f6a88u , 0x85a308d3u , 0x13198a2eu , 0x03707344u }} , {{ 0xa4093822u , 0x299f31d0u }} );
+    EXPECT_EQ( r[0] , 0xd16cfe09u );
+    EXPECT_EQ( r[1] , 0x94fdccebu );
+    EXPECT_EQ( r[2] , 0x5001e420u );
+    EXPECT_EQ( r[3] , 0x24126ea1u );
+}
+
+TEST( TESTNAME , satisfies_uniform_random_bit_generator )
+{
+    static_assert( std::is_unsigned< engine::result_type >::value , "result_type must be unsigned" );
+    static_assert( engine::min() < engine::max() , "min must be smaller than max" );
+    engine e;
+    std::uniform_int_distribution< size_t > dist( 0 , 9 );
+    for( size_t i=0 ; i<1000 ; ++i )
+    {
+        size_t x = dist( e );
+        EXPECT_LE( x , size_t( 9 ) );
+    }
+}
+
+TEST( TESTNAME , streams_are_reproducible )
+{
+    auto e1 = gpcxx::make_philox_stream( 42 , 3 , 17 , 1 );
+    auto e2 = gpcxx::make_philox_stream( 42 , 3 , 17 , 1 );
+    for( size_t i=0 ; i<100 ; ++i )
+        EXPECT_EQ( e1() , e2() );
+}
+
+TEST( TESTNAME , generate_equals_single_draws )
+{
+    for( size_t skip : { 0 , 1 , 3 } )
+    {
+        auto e1 = gpcxx::make_philox_stream( 42 , 3 , 17 , 1 );
+        auto e2 = e1;
+        for( size_t i=0 ; i<skip ; ++i ) EXPECT_EQ( e1() , e2() );
+        std::vector< engine::result_type > x( 23 );
+        e1.generate( x.data() , x.size() );
+        for( auto v : x ) EXPECT_EQ( v , e2() );
+        EXPECT_EQ( e1 , e2 );
+        EXPECT_EQ( e1() , e2() );
+    }
+}
+
+TEST( TESTNAME , streams_are_distinct )
+{
+    std::vector< engine > streams = {
+        gpcxx::make_philox_stream( 42 , 3 , 17 , 1 ) ,
+        gpcxx::make_philox_stream( 43 , 3 , 17 , 1 ) ,
+        gpcxx::make_philox_stream( 42 , 4 , 17 , 1 ) ,
+        gpcxx::make_philox_stream( 42 , 3 , 18 , 1 ) ,
+        gpcxx::make_philox_stream( 42 , 3 , 17 , 2 ) };
+    std::vector< engine::result_type > first;
+    for( auto& s : streams ) first.push_back( s() );
+    for( size_t i=0 ; i<first.size() ; ++i )
+        for( size_t j=i+1 ; j<first.size() ; ++j )
+            EXPECT_NE( first[i] , first[j] );
+}
+
+TEST( TESTNAME , discard )
+{
+    for( size_t offset = 0 ; offset < 6 ; ++offset )
+    {
+        engine e1( 7 ) , e2( 7 );
+        for( size_t i=0 ; i<offset ; ++i ) { e1(); e2(); }
+        for( size_t i=0 ; i<13 ; ++i ) e1();
+        e2.discard( 13 );
+        EXPECT_EQ( e1 , e2 );
+        EXPECT_EQ( e1() , e2() );
+    }
+}
+
+TEST( TESTNAME , serialization )
+{
+    engine e1( 1234 , 1 , 2 , 3 );
+    e1();
+    e1();
+    std::stringstream str;
+    str << e1;
+    engine e2;
+    str >> e2;
+    EXPECT_EQ( e1 , e2 );
+    for( size_t i=0 ; i<10 ; ++i )
+        EXPECT_EQ( e1() , e2() );
+}
+
+TEST( TESTNAME , seed_sequence )
+{
+    std::seed_seq seq1 { 1 , 2 , 3 } , seq2 { 1 , 2 , 3 };
+    engine e1( seq1 ) , e2;
+    e2.seed( seq2 );
+    EXPECT_EQ( e1 , e2 );
+}
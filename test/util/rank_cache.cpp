@@ -0,0 +1,81 @@
+/*
+ * test/util/rank_cache.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/rank_cache.hpp>
+#include <gpcxx/util/sort_indices.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#define TESTNAME rank_cache_tests
+
+
+TEST( TESTNAME , best_is_sorted_incrementally )
+{
+    std::vector< double > c = { 2.0 , 5.0 , 2.5 , NAN , 1.0 , -2.0 , INFINITY , -INFINITY , 4.5 };
+    gpcxx::rank_cache ranks;
+    EXPECT_FALSE( ranks.valid() );
+
+    auto b1 = ranks.best( c , 1 );
+    EXPECT_TRUE( ranks.valid() );
+    ASSERT_EQ( b1.size() , 1 );
+    EXPECT_EQ( b1[0] , size_t( 5 ) );
+
+    auto b3 = ranks.best( c , 3 );
+    ASSERT_EQ( b3.size() , 3 );
+    EXPECT_EQ( b3[0] , size_t( 5 ) );
+    EXPECT_EQ( b3[1] , size_t( 4 ) );
+    EXPECT_EQ( b3[2] , size_t( 0 ) );
+
+    EXPECT_EQ( ranks.number_of_finite( c ) , size_t( 6 ) );
+    auto const& all = ranks.ranking( c );
+    ASSERT_EQ( all.size() , size_t( 9 ) );
+    EXPECT_EQ( all[3] , size_t( 2 ) );
+    EXPECT_EQ( all[4] , size_t( 8 ) );
+    EXPECT_EQ( all[5] , size_t( 1 ) );
+    EXPECT_EQ( ranks.best( c , 100 ).size() , 9 );
+}
+
+TEST( TESTNAME , matches_sort_indices )
+{
+    std::mt19937 rng;
+    std::uniform_real_distribution< double > dist( 0.0 , 1.0 );
+    std::vector< double > c( 1000 );
+    for( auto& x : c ) x = dist( rng );
+
+    std::vector< size_t > idx;
+    gpcxx::sort_indices( c , idx );
+
+    gpcxx::rank_cache ranks;
+    for( size_t k : { 1 , 7 , 7 , 100 , 50 , 1000 } )
+    {
+        auto b = ranks.best( c , k );
+        ASSERT_EQ( size_t( b.size() ) , k );
+        for( size_t i=0 ; i<k ; ++i ) EXPECT_EQ( b[i] , idx[i] );
+    }
+}
+
+TEST( TESTNAME , invalidate )
+{
+    std::vector< double > c = { 3.0 , 2.0 , 1.0 };
+    gpcxx::rank_cache ranks;
+    EXPECT_EQ( ranks.best( c , 1 )[0] , size_t( 2 ) );
+    c[0] = 0.0;
+    EXPECT_EQ( ranks.best( c , 1 )[0] , size_t( 2 ) );
+    ranks.invalidate();
+    EXPECT_EQ( ranks.best( c , 1 )[0] , size_t( 0 ) );
+    c.push_back( -1.0 );
+    ranks.invalidate();
+    EXPECT_EQ( ranks.best( c , 1 )[0] , size_t( 3 ) );
+}
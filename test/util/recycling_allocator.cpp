@@ -0,0 +1,75 @@
+/*
+ * test/util/recycling_allocator.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/recycling_allocator.hpp>
+#include <gpcxx/tree/basic_tree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#define TESTNAME recycling_allocator_tests
+
+
+TEST( TESTNAME , freed_blocks_are_reused )
+{
+    gpcxx::recycling_allocator< double > alloc;
+    double* p1 = alloc.allocate( 3 );
+    alloc.deallocate( p1 , 3 );
+    double* p2 = alloc.allocate( 3 );
+    EXPECT_EQ( p1 , p2 );
+    double* p3 = alloc.allocate( 3 );
+    EXPECT_NE( p2 , p3 );
+    alloc.deallocate( p2 , 3 );
+    alloc.deallocate( p3 , 3 );
+}
+
+TEST( TESTNAME , large_blocks )
+{
+    gpcxx::recycling_allocator< double > alloc;
+    double* p = alloc.allocate( 1000 );
+    for( size_t i=0 ; i<1000 ; ++i ) p[i] = double( i );
+    alloc.deallocate( p , 1000 );
+}
+
+TEST( TESTNAME , allocators_compare_equal )
+{
+    gpcxx::recycling_allocator< double > a1;
+    gpcxx::recycling_allocator< int > a2( a1 );
+    EXPECT_TRUE( a1 == a2 );
+    EXPECT_FALSE( a1 != a2 );
+}
+
+TEST( TESTNAME , vector )
+{
+    std::vector< int , gpcxx::recycling_allocator< int > > v;
+    for( int i=0 ; i<1000 ; ++i ) v.push_back( i );
+    for( int i=0 ; i<1000 ; ++i ) EXPECT_EQ( v[i] , i );
+}
+
+TEST( TESTNAME , tree_nodes_are_recycled )
+{
+    using tree_type = gpcxx::basic_tree< std::string , gpcxx::recycling_allocator< std::string > >;
+    tree_type t1;
+    auto c = t1.insert_below( t1.root() , "plus" );
+    t1.insert_below( c , "x" );
+    t1.insert_below( c , "y" );
+
+    tree_type t2 = t1;
+    EXPECT_EQ( t1 , t2 );
+    auto root = &( *t2.root() );
+    t2.clear();
+    tree_type t3 = t1;
+    EXPECT_EQ( t3 , t1 );
+    EXPECT_EQ( &( *t3.root() ) , root );
+    gpcxx::detail::recycling_pool::release();
+}
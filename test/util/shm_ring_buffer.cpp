@@ -0,0 +1,140 @@
+/*
+ * test/util/shm_ring_buffer.cpp
+ * Date: 2026-10-19
+ * Author: Karsten Ahnert (karsten.ahnert@gmx.de)
+ * Copyright: Karsten Ahnert
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or
+ * copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <gpcxx/util/shm_ring_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define TESTNAME shm_ring_buffer_tests
+
+using gpcxx::shm_ring_buffer;
+
+namespace {
+
+std::string test_name( std::string const& suffix )
+{
+    return "/gpcxx_test_" + std::to_string( ::getpid() ) + "_" + suffix;
+}
+
+} // namespace
+
+
+TEST( TESTNAME , push_and_pop )
+{
+    std::string name = test_name( "push_and_pop" );
+    auto producer = shm_ring_buffer::create( name , 64 );
+    auto consumer = shm_ring_buffer::open( name );
+    shm_ring_buffer::unlink( name );
+
+    EXPECT_EQ( consumer.capacity() , size_t( 64 ) );
+    EXPECT_TRUE( consumer.empty() );
+    std::string msg;
+    EXPECT_FALSE( consumer.try_pop( msg ) );
+
+    EXPECT_TRUE( producer.try_push( "hello" ) );
+    EXPECT_TRUE( producer.try_push( std::string() ) );
+    EXPECT_TRUE( producer.try_push( std::string( "a\0b" , 3 ) ) );
+    EXPECT_FALSE( consumer.empty() );
+
+    EXPECT_TRUE( consumer.try_pop( msg ) );
+    EXPECT_EQ( msg , "hello" );
+    EXPECT_TRUE( consumer.try_pop( msg ) );
+    EXPECT_EQ( msg , "" );
+    EXPECT_TRUE( consumer.try_pop( msg ) );
+    EXPECT_EQ( msg , std::string( "a\0b" , 3 ) );
+    EXPECT_FALSE( consumer.try_pop( msg ) );
+}
+
+TEST( TESTNAME , full_buffer_and_wrap_around )
+{
+    std::string name = test_name( "wrap_around" );
+    auto buffer = shm_ring_buffer::create( name , 30 );
+    shm_ring_buffer::unlink( name );
+
+    std::string msg;
+    for( size_t i=0 ; i<20 ; ++i )
+    {
+        std::string m1( 10 , char( 'a' + i ) ) , m2( 8 , char( 'A' + i ) );
+        EXPECT_TRUE( buffer.try_push( m1 ) );
+        EXPECT_TRUE( buffer.try_push( m2 ) );
+        EXPECT_FALSE( buffer.try_push( m1 ) );
+        EXPECT_TRUE( buffer.try_pop( msg ) );
+        EXPECT_EQ( msg , m1 );
+        EXPECT_TRUE( buffer.try_pop( msg ) );
+        EXPECT_EQ( msg , m2 );
+    }
+    EXPECT_THROW( buffer.try_push( std::string( 27 , 'x' ) ) , gpcxx::gpcxx_exception );
+}
+
+TEST( TESTNAME , open_missing_buffer_throws )
+{
+    EXPECT_THROW( shm_ring_buffer::open( test_name( "does_not_exist" ) ) , gpcxx::gpcxx_exception );
+}
+
+TEST( TESTNAME , open_mismatched_size_throws )
+{
+    std::string name = test_name( "mismatched" );
+    {
+        auto buffer = shm_ring_buffer::create( name , 256 );
+    }
+    // the object is smaller than the capacity in its header
+    int fd = ::shm_open( name.c_str() , O_RDWR , 0600 );
+    ASSERT_GE( fd , 0 );
+    EXPECT_EQ( ::ftruncate( fd , 128 ) , 0 );
+    EXPECT_THROW( shm_ring_buffer::open( name ) , gpcxx::gpcxx_exception );
+
+    // too small for the header
+    EXPECT_EQ( ::ftruncate( fd , 8 ) , 0 );
+    EXPECT_THROW( shm_ring_buffer::open( name ) , gpcxx::gpcxx_exception );
+    ::close( fd );
+    shm_ring_buffer::unlink( name );
+}
+
+TEST( TESTNAME , between_processes )
+{
+    std::string name = test_name( "processes" );
+    auto consumer = shm_ring_buffer::create( name , 256 );
+    size_t const n = 10000;
+
+    pid_t pid = ::fork();
+    ASSERT_GE( pid , 0 );
+    if( pid == 0 )
+    {
+        auto producer = shm_ring_buffer::open( name );
+        for( size_t i=0 ; i<n ; ++i )
+        {
+            std::string msg = std::to_string( i );
+            while( ! producer.try_push( msg ) ) std::this_thread::yield();
+        }
+        ::_exit( 0 );
+    }
+
+    std::string msg;
+    for( size_t i=0 ; i<n ; ++i )
+    {
+        while( ! consumer.try_pop( msg ) ) std::this_thread::yield();
+        ASSERT_EQ( msg , std::to_string( i ) );
+    }
+    int status = 0;
+    ::waitpid( pid , &status , 0 );
+    EXPECT_TRUE( WIFEXITED( status ) );
+    EXPECT_EQ( WEXITSTATUS( status ) , 0 );
+    shm_ring_buffer::unlink( name );
+}
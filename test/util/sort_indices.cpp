@@ -5,6 +5,7 @@
  */
 
 #include <gpcxx/util/sort_indices.hpp>
+#include <algorithm>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -40,3 +41,34 @@ TEST( TESTNAME , sort_indices2 )
     EXPECT_EQ( ind[4] , size_t( 8 ) );
     EXPECT_EQ( ind[5] , size_t( 1 ) );
 }
+
+TEST( TESTNAME , partial_sort_indices1 )
+{
+    std::vector< double > c = { 2.0 , 5.0 , 2.5 , 1.0 , -2.0 , 4.5 };
+    std::vector< size_t >  ind;
+    auto iter = gpcxx::partial_sort_indices( c , ind , 3 );
+    EXPECT_EQ( ind.size() , size_t( 6 ) );
+    EXPECT_EQ( iter , ind.end() );
+    EXPECT_EQ( ind[0] , size_t( 4 ) );
+    EXPECT_EQ( ind[1] , size_t( 3 ) );
+    EXPECT_EQ( ind[2] , size_t( 0 ) );
+    std::sort( ind.begin() + 3 , ind.end() );
+    EXPECT_EQ( ind[3] , size_t( 1 ) );
+    EXPECT_EQ( ind[4] , size_t( 2 ) );
+    EXPECT_EQ( ind[5] , size_t( 5 ) );
+}
+
+TEST( TESTNAME , partial_sort_indices2 )
+{
+    std::vector< double > c = { 2.0 , 5.0 , 2.5 , NAN , 1.0 , -2.0 , INFINITY , -INFINITY , 4.5 };
+    std::vector< size_t >  ind;
+    auto iter = gpcxx::partial_sort_indices( c , ind , 20 );
+    EXPECT_EQ( ind.size() , size_t( 9 ) );
+    EXPECT_EQ( iter - ind.begin() , 6 );
+    EXPECT_EQ( ind[0] , size_t( 5 ) );
+    EXPECT_EQ( ind[1] , size_t( 4 ) );
+    EXPECT_EQ( ind[2] , size_t( 0 ) );
+    EXPECT_EQ( ind[3] , size_t( 2 ) );
+    EXPECT_EQ( ind[4] , size_t( 8 ) );
+    EXPECT_EQ( ind[5] , size_t( 1 ) );
+}